@@ -0,0 +1,699 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xaxivdma_example_frmmgr.c
+ *
+ * This example demonstrates how to use the frame store manager to pass video
+ * frames through software. The write channel captures into three frame
+ * stores and the read channel displays from three others; software copies
+ * the latest captured frame into a free read frame store. Both channels are
+ * kept in park mode by their frame store manager, which is serviced from the
+ * frame count interrupt of the channel with a frame count of 1.
+ *
+ * Like xaxivdma_example_intr.c, this example does not work by itself. It
+ * needs a video IP writing frames to the write channel and one reading frames
+ * from the read channel.
+ *
+ * @note
+ * The values of DDR_BASE_ADDR and DDR_HIGH_ADDR should be as per the HW system.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 6.1   ms   10/19/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+#include "xaxivdma.h"
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xil_cache.h"
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#else
+#include "xscugic.h"
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device related constants. These need to defined as per the HW system.
+ */
+#define DMA_DEVICE_ID		XPAR_AXIVDMA_0_DEVICE_ID
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#define INTC_DEVICE_ID		XPAR_INTC_0_DEVICE_ID
+#define WRITE_INTR_ID		XPAR_INTC_0_AXIVDMA_0_S2MM_INTROUT_VEC_ID
+#define READ_INTR_ID		XPAR_INTC_0_AXIVDMA_0_MM2S_INTROUT_VEC_ID
+#else
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#define WRITE_INTR_ID		XPAR_FABRIC_AXIVDMA_0_S2MM_INTROUT_VEC_ID
+#define READ_INTR_ID		XPAR_FABRIC_AXIVDMA_0_MM2S_INTROUT_VEC_ID
+#endif
+
+#ifdef XPAR_V6DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_V6DDR_0_S_AXI_BASEADDR
+#define DDR_HIGH_ADDR		XPAR_V6DDR_0_S_AXI_HIGHADDR
+#elif XPAR_S6DDR_0_S0_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_S6DDR_0_S0_AXI_BASEADDR
+#define DDR_HIGH_ADDR		XPAR_S6DDR_0_S0_AXI_HIGHADDR
+#elif XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_HIGH_ADDR		XPAR_AXI_7SDDR_0_S_AXI_HIGHADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR		XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_HIGH_ADDR	 	XPAR_MIG7SERIES_0_HIGHADDR
+#else
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define DDR_BASE_ADDR		0x10000000
+#define DDR_HIGH_ADDR		0x20000000
+#endif
+
+/* Frame size related constants
+ */
+#define FRAME_HORIZONTAL_LEN  0x1E00   /* 1920 pixels, each pixel 4 bytes */
+#define FRAME_VERTICAL_LEN    0x438    /* 1080 pixels */
+#define FRAME_SIZE            (FRAME_HORIZONTAL_LEN * FRAME_VERTICAL_LEN)
+
+/* Number of frame stores per channel
+ *
+ * With three frame stores neither software nor hardware has to wait for the
+ * other.
+ */
+#define NUMBER_OF_FRAMES	3
+
+/* Memory space for the frame buffers
+ *
+ * The read channel frame stores are followed by the write channel ones.
+ */
+#define READ_ADDRESS_BASE	(DDR_BASE_ADDR + 0x01000000)
+#define WRITE_ADDRESS_BASE	(READ_ADDRESS_BASE + \
+					(FRAME_SIZE * NUMBER_OF_FRAMES))
+
+/* Number of frames to pass through software
+ */
+#define NUM_TEST_FRAMES		100
+
+/*
+ * Device instance definitions
+ */
+XAxiVdma AxiVdma;
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+static XIntc Intc;	/* Instance of the Interrupt Controller */
+#else
+static XScuGic Intc;	/* Instance of the Interrupt Controller */
+#endif
+
+/* Frame store managers, one per channel
+ */
+static XAxiVdma_FrameMgr ReadMgr;
+static XAxiVdma_FrameMgr WriteMgr;
+
+/* DMA channel setup
+ */
+static XAxiVdma_DmaSetup ReadCfg;
+static XAxiVdma_DmaSetup WriteCfg;
+
+/* Transfer statics
+ */
+static volatile int ReadError;
+static volatile int WriteError;
+
+/******************* Function Prototypes ************************************/
+
+static int ChannelSetup(XAxiVdma *InstancePtr, u16 Direction,
+			XAxiVdma_DmaSetup *CfgPtr, UINTPTR BaseAddr);
+static int PassFrame(void);
+static void PrintStats(const char *Name, XAxiVdma_FrameMgr *MgrPtr);
+
+static int SetupIntrSystem(XAxiVdma *AxiVdmaPtr, u16 ReadIntrId,
+				u16 WriteIntrId);
+
+static void DisableIntrSystem(u16 ReadIntrId, u16 WriteIntrId);
+
+/* Interrupt call back functions
+ */
+static void FrameCallBack(void *CallbackRef, u32 Mask);
+static void ReadErrorCallBack(void *CallbackRef, u32 Mask);
+static void WriteErrorCallBack(void *CallbackRef, u32 Mask);
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry point of the frame store manager example.
+* It starts both channels, parks them through their frame store managers,
+* and copies captured frames to the read channel until NUM_TEST_FRAMES
+* frames have been passed through or a transfer error occurs.
+*
+* @return
+*		- XST_SUCCESS if example finishes successfully
+*		- XST_FAILURE if example fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	int Passed;
+	XAxiVdma_Config *Config;
+	XAxiVdma_FrameCounter FrameCfg;
+
+	ReadError = 0;
+	WriteError = 0;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+	Config = XAxiVdma_LookupConfig(DMA_DEVICE_ID);
+	if (!Config) {
+		xil_printf(
+		    "No video DMA found for ID %d\r\n", DMA_DEVICE_ID);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_CfgInitialize(&AxiVdma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Configuration Initialization failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	/* Frame count interrupt on every frame, no delay interrupt, so that
+	 * the frame store managers are serviced once per frame
+	 */
+	FrameCfg.ReadFrameCount = 1;
+	FrameCfg.WriteFrameCount = 1;
+	FrameCfg.ReadDelayTimerCount = 0;
+	FrameCfg.WriteDelayTimerCount = 0;
+
+	Status = XAxiVdma_SetFrameCounter(&AxiVdma, &FrameCfg);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+			"Set frame counter failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	Status = ChannelSetup(&AxiVdma, XAXIVDMA_WRITE, &WriteCfg,
+					WRITE_ADDRESS_BASE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = ChannelSetup(&AxiVdma, XAXIVDMA_READ, &ReadCfg,
+					READ_ADDRESS_BASE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_FrameMgrInitialize(&WriteMgr, &AxiVdma,
+					XAXIVDMA_WRITE, NUMBER_OF_FRAMES);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Write frame store manager init failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_FrameMgrInitialize(&ReadMgr, &AxiVdma,
+					XAXIVDMA_READ, NUMBER_OF_FRAMES);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Read frame store manager init failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	Status = SetupIntrSystem(&AxiVdma, READ_INTR_ID, WRITE_INTR_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Setup interrupt system failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	/* The frame count callback of each channel services its manager
+	 */
+	XAxiVdma_SetCallBack(&AxiVdma, XAXIVDMA_HANDLER_GENERAL,
+	    FrameCallBack, (void *)&ReadMgr, XAXIVDMA_READ);
+
+	XAxiVdma_SetCallBack(&AxiVdma, XAXIVDMA_HANDLER_ERROR,
+	    ReadErrorCallBack, (void *)&AxiVdma, XAXIVDMA_READ);
+
+	XAxiVdma_SetCallBack(&AxiVdma, XAXIVDMA_HANDLER_GENERAL,
+	    FrameCallBack, (void *)&WriteMgr, XAXIVDMA_WRITE);
+
+	XAxiVdma_SetCallBack(&AxiVdma, XAXIVDMA_HANDLER_ERROR,
+	    WriteErrorCallBack, (void *)&AxiVdma, XAXIVDMA_WRITE);
+
+	/* Start both channels and park them on their first frame store
+	 * before the interrupts can service the managers
+	 */
+	Status = XAxiVdma_DmaStart(&AxiVdma, XAXIVDMA_WRITE);
+	if (Status == XST_SUCCESS) {
+		Status = XAxiVdma_FrameMgrStart(&WriteMgr);
+	}
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Start write channel failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_DmaStart(&AxiVdma, XAXIVDMA_READ);
+	if (Status == XST_SUCCESS) {
+		Status = XAxiVdma_FrameMgrStart(&ReadMgr);
+	}
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Start read channel failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	XAxiVdma_IntrEnable(&AxiVdma, XAXIVDMA_IXR_FRMCNT_MASK |
+				XAXIVDMA_IXR_ERROR_MASK, XAXIVDMA_WRITE);
+	XAxiVdma_IntrEnable(&AxiVdma, XAXIVDMA_IXR_FRMCNT_MASK |
+				XAXIVDMA_IXR_ERROR_MASK, XAXIVDMA_READ);
+
+	Passed = 0;
+	while ((Passed < NUM_TEST_FRAMES) && !ReadError && !WriteError) {
+		if (PassFrame() == XST_SUCCESS) {
+			Passed++;
+		}
+	}
+
+	XAxiVdma_IntrDisable(&AxiVdma, XAXIVDMA_IXR_ALL_MASK, XAXIVDMA_WRITE);
+	XAxiVdma_IntrDisable(&AxiVdma, XAXIVDMA_IXR_ALL_MASK, XAXIVDMA_READ);
+
+	DisableIntrSystem(READ_INTR_ID, WRITE_INTR_ID);
+
+	PrintStats("Write", &WriteMgr);
+	PrintStats("Read", &ReadMgr);
+
+	if (ReadError || WriteError) {
+		xil_printf("Test has transfer error %d/%d\r\n",
+		    ReadError, WriteError);
+
+		return XST_FAILURE;
+	}
+
+	xil_printf("Test passed\r\n");
+
+	xil_printf("--- Exiting main() --- \r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up one channel to transfer full frames from or to
+* NUMBER_OF_FRAMES consecutive frame stores.
+*
+* @param	InstancePtr is the instance pointer to the DMA engine.
+* @param	Direction is the channel to set up, XAXIVDMA_READ/WRITE.
+* @param	CfgPtr is the setup of the channel to fill.
+* @param	BaseAddr is the address of the first frame store.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int ChannelSetup(XAxiVdma *InstancePtr, u16 Direction,
+			XAxiVdma_DmaSetup *CfgPtr, UINTPTR BaseAddr)
+{
+	int Index;
+	int Status;
+
+	Status = XAxiVdma_SetFrmStore(InstancePtr, NUMBER_OF_FRAMES,
+							Direction);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Setting Frame Store Number Failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	CfgPtr->VertSizeInput = FRAME_VERTICAL_LEN;
+	CfgPtr->HoriSizeInput = FRAME_HORIZONTAL_LEN;
+
+	CfgPtr->Stride = FRAME_HORIZONTAL_LEN;
+	CfgPtr->FrameDelay = 0;
+
+	CfgPtr->EnableCircularBuf = 1;
+	CfgPtr->EnableSync = 0;  /* No Gen-Lock */
+
+	CfgPtr->PointNum = 0;    /* No Gen-Lock */
+	CfgPtr->EnableFrameCounter = 0; /* Endless transfers */
+
+	/* Parking is done through the frame store manager */
+	CfgPtr->FixedFrameStoreAddr = 0;
+
+	Status = XAxiVdma_DmaConfig(InstancePtr, Direction, CfgPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Channel config failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	for (Index = 0; Index < NUMBER_OF_FRAMES; Index++) {
+		CfgPtr->FrameStoreStartAddr[Index] = BaseAddr +
+						(Index * FRAME_SIZE);
+	}
+
+	Status = XAxiVdma_DmaSetBufferAddr(InstancePtr, Direction,
+			CfgPtr->FrameStoreStartAddr);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Channel set buffer address failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	memset((void *)BaseAddr, 0, FRAME_SIZE * NUMBER_OF_FRAMES);
+	Xil_DCacheFlushRange(BaseAddr, FRAME_SIZE * NUMBER_OF_FRAMES);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies the latest captured frame into a free read channel
+* frame store and queues it for display.
+*
+* @return
+*		- XST_SUCCESS if a frame was passed through.
+*		- XST_NO_DATA if nothing was captured yet or all read
+*		  channel frame stores are in use.
+*
+* @note		None.
+*
+******************************************************************************/
+static int PassFrame(void)
+{
+	int WriteFrame;
+	int ReadFrame;
+	int Status;
+
+	Status = XAxiVdma_FrameMgrAcquire(&WriteMgr, &WriteFrame);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	Status = XAxiVdma_FrameMgrAcquire(&ReadMgr, &ReadFrame);
+	if (Status != XST_SUCCESS) {
+		XAxiVdma_FrameMgrRelease(&WriteMgr, WriteFrame);
+
+		return Status;
+	}
+
+	/* Process the frame; this example only copies it
+	 */
+	Xil_DCacheInvalidateRange(WriteCfg.FrameStoreStartAddr[WriteFrame],
+					FRAME_SIZE);
+	memcpy((void *)ReadCfg.FrameStoreStartAddr[ReadFrame],
+		(void *)WriteCfg.FrameStoreStartAddr[WriteFrame], FRAME_SIZE);
+	Xil_DCacheFlushRange(ReadCfg.FrameStoreStartAddr[ReadFrame],
+					FRAME_SIZE);
+
+	XAxiVdma_FrameMgrRelease(&ReadMgr, ReadFrame);
+	XAxiVdma_FrameMgrRelease(&WriteMgr, WriteFrame);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the statistics of a frame store manager.
+*
+* @param	Name is the name of the channel.
+* @param	MgrPtr is the frame store manager of the channel.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void PrintStats(const char *Name, XAxiVdma_FrameMgr *MgrPtr)
+{
+	XAxiVdma_FrameMgrStats Stats;
+
+	XAxiVdma_FrameMgrGetStats(MgrPtr, &Stats);
+
+	xil_printf("%s: published %d consumed %d dropped %d repeated %d\r\n",
+	    Name, Stats.Published, Stats.Consumed, Stats.Dropped,
+	    Stats.Repeated);
+}
+
+/*****************************************************************************/
+/*
+*
+* This function setups the interrupt system so interrupts can occur for the
+* DMA.  This function assumes INTC component exists in the hardware system.
+*
+* Both channel interrupts have the same priority, so the frame store managers
+* are never serviced from interrupts that preempt each other.
+*
+* @param	AxiDmaPtr is a pointer to the instance of the DMA engine
+* @param	ReadIntrId is the read channel Interrupt ID.
+* @param	WriteIntrId is the write channel Interrupt ID.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SetupIntrSystem(XAxiVdma *AxiVdmaPtr, u16 ReadIntrId,
+				u16 WriteIntrId)
+{
+	int Status;
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc *IntcInstancePtr =&Intc;
+
+	/* Initialize the interrupt controller and connect the ISRs */
+	Status = XIntc_Initialize(IntcInstancePtr, INTC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf( "Failed init intc\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, ReadIntrId,
+	         (XInterruptHandler)XAxiVdma_ReadIntrHandler, AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Failed read channel connect intc %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, WriteIntrId,
+	         (XInterruptHandler)XAxiVdma_WriteIntrHandler, AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+		    "Failed write channel connect intc %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Start the interrupt controller */
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+		xil_printf( "Failed to start intc\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Enable interrupts from the hardware */
+	XIntc_Enable(IntcInstancePtr, ReadIntrId);
+	XIntc_Enable(IntcInstancePtr, WriteIntrId);
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+			(Xil_ExceptionHandler)XIntc_InterruptHandler,
+			(void *)IntcInstancePtr);
+
+	Xil_ExceptionEnable();
+
+#else
+
+	XScuGic *IntcInstancePtr = &Intc;	/* Instance of the Interrupt Controller */
+	XScuGic_Config *IntcConfig;
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+					IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, ReadIntrId, 0xA0, 0x3);
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, WriteIntrId, 0xA0, 0x3);
+
+	Status = XScuGic_Connect(IntcInstancePtr, ReadIntrId,
+				(Xil_InterruptHandler)XAxiVdma_ReadIntrHandler,
+				AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	Status = XScuGic_Connect(IntcInstancePtr, WriteIntrId,
+				(Xil_InterruptHandler)XAxiVdma_WriteIntrHandler,
+				AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	XScuGic_Enable(IntcInstancePtr, ReadIntrId);
+	XScuGic_Enable(IntcInstancePtr, WriteIntrId);
+
+	Xil_ExceptionInit();
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_IRQ_INT,
+				(Xil_ExceptionHandler)XScuGic_InterruptHandler,
+				IntcInstancePtr);
+
+	Xil_ExceptionEnable();
+
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function disables the interrupts
+*
+* @param	ReadIntrId is interrupt ID associated w/ DMA read channel
+* @param	WriteIntrId is interrupt ID associated w/ DMA write channel
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void DisableIntrSystem(u16 ReadIntrId, u16 WriteIntrId)
+{
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc *IntcInstancePtr =&Intc;
+
+	/* Disconnect the interrupts for the DMA TX and RX channels */
+	XIntc_Disconnect(IntcInstancePtr, ReadIntrId);
+	XIntc_Disconnect(IntcInstancePtr, WriteIntrId);
+#else
+	XScuGic *IntcInstancePtr = &Intc;
+
+	XScuGic_Disable(IntcInstancePtr, ReadIntrId);
+	XScuGic_Disable(IntcInstancePtr, WriteIntrId);
+
+	XScuGic_Disconnect(IntcInstancePtr, ReadIntrId);
+	XScuGic_Disconnect(IntcInstancePtr, WriteIntrId);
+#endif
+}
+
+/*****************************************************************************/
+/*
+ * Call back function for the frame count interrupt of both channels
+ *
+ * With a frame count of 1 this is called once per frame, which is when the
+ * frame store manager of the channel has to be serviced.
+ *
+ * @param	CallbackRef is the frame store manager of the channel
+ * @param	Mask is the interrupt mask passed in from the driver
+ *
+ * @return	None
+*
+******************************************************************************/
+static void FrameCallBack(void *CallbackRef, u32 Mask)
+{
+
+	if (Mask & XAXIVDMA_IXR_FRMCNT_MASK) {
+		XAxiVdma_FrameMgrService((XAxiVdma_FrameMgr *)CallbackRef);
+	}
+}
+
+/*****************************************************************************/
+/*
+ * Call back function for read channel error interrupt
+ *
+ * @param	CallbackRef is the call back reference pointer
+ * @param	Mask is the interrupt mask passed in from the driver
+ *
+ * @return	None
+*
+******************************************************************************/
+static void ReadErrorCallBack(void *CallbackRef, u32 Mask)
+{
+
+	if (Mask & XAXIVDMA_IXR_ERROR_MASK) {
+		ReadError += 1;
+	}
+}
+
+/*****************************************************************************/
+/*
+* Call back function for write channel error interrupt
+*
+* @param	CallbackRef is the call back reference pointer
+* @param	Mask is the interrupt mask passed in from the driver
+*
+* @return	None
+*
+******************************************************************************/
+static void WriteErrorCallBack(void *CallbackRef, u32 Mask)
+{
+
+	if (Mask & XAXIVDMA_IXR_ERROR_MASK) {
+		WriteError += 1;
+	}
+}
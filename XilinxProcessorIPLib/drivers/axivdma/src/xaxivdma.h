@@ -171,6 +171,35 @@
 * XAxiVdma_DmaStart() to start the transfer again. Note that the transfer
 * always starts from the first video frame.
 *
+* <b>Frame Store Manager</b>
+*
+* For software that renders into (read channel) or consumes from (write
+* channel) the frame stores while the VDMA is running, the frame store
+* manager in xaxivdma_frmmgr.c keeps the channel in park mode and moves the
+* park pointer between the frame stores, so that software and hardware never
+* touch the same frame store at the same time:
+*  - XAxiVdma_FrameMgrInitialize() and XAxiVdma_FrameMgrStart() after the
+*    channel has been started with XAxiVdma_DmaStart().
+*  - XAxiVdma_FrameMgrAcquire() gives software a frame store: a free one to
+*    render into on the read channel, the latest captured one on the write
+*    channel. XAxiVdma_FrameMgrRelease() hands it back; on the read channel
+*    this queues it for display.
+*  - XAxiVdma_FrameMgrService() must be called once per frame, typically from
+*    the frame count (IOC) callback of the channel with a frame count of 1.
+*    It moves the park pointer and retires frame stores once
+*    XAxiVdma_CurrFrameStore() shows the hardware has moved on.
+*
+* With three or more frame stores neither side ever waits for the other;
+* frames that are replaced before the consumer sees them, and frames the
+* consumer gets twice, are counted in XAxiVdma_FrameMgrStats.
+*
+* Each field of the manager is written by only one side, so Acquire/Release
+* may be preempted by Service without any locking. Both must run on the
+* same processor.
+*
+* xaxivdma_example_frmmgr.c shows the frame store managers of both channels
+* serviced from their frame count callbacks.
+*
 * <b> Examples</b>
 *
 * We provide one example on how to use the AXI VDMA with AXI Video IPs. This
@@ -286,6 +315,8 @@
 * 6.0   vak  27/07/15  Added 64 bit addressing support to the driver.
 * 6.0   vak  26/08/15  Added checks to align hsize and stride based on channel direction
 *                      (read or write)(CR 874861)
+* 6.1   ms   10/19/26  Added the frame store manager (xaxivdma_frmmgr.c) for
+*                      lock-free N-buffering on top of park mode.
 *
 * </pre>
 *
@@ -355,6 +386,11 @@ extern "C" {
 #define XAXIVDMA_ENABLE_DBG_DLY_CNTR	0x08
 #define XAXIVDMA_ENABLE_DBG_ALL_FEATURES	0x0F
 
+/**
+ * Frame store manager: no frame store
+ */
+#define XAXIVDMA_FRAMEMGR_NONE		(-1)
+
 /* Defined for backward compatiblity.
  * This  is a typical DMA Internal Error, which on detection doesnt require a
  * reset (as opposed to other errors). So user on seeing this need only to
@@ -524,6 +560,52 @@ typedef struct {
 	int AddrWidth;		  /**< Address Width */
 } XAxiVdma;
 
+/**
+ * Frame store manager statistics
+ */
+typedef struct {
+	u32 Published;	/**< Frames handed over by the producer */
+	u32 Consumed;	/**< Frames the consumer picked up */
+	u32 Dropped;	/**< Frames replaced before the consumer saw them */
+	u32 Repeated;	/**< Times the consumer got the same frame again */
+} XAxiVdma_FrameMgrStats;
+
+/**
+ * Frame store manager for one channel.
+ *
+ * On the read channel software is the producer and the hardware the
+ * consumer; on the write channel it is the other way around. Every field
+ * below is written by one side only, noted at the start of its comment:
+ * sw (Acquire/Release), svc (Service), or producer/consumer, which maps to
+ * sw or svc depending on the direction.
+ */
+typedef struct {
+	XAxiVdma *InstancePtr;		/**< VDMA instance the channel belongs
+					  *  to */
+	u16 Direction;			/**< XAXIVDMA_READ or XAXIVDMA_WRITE */
+	int NumFrames;			/**< Number of frame stores managed */
+
+	volatile int Held;		/**< sw: frame store held by software */
+	volatile int HwFrame;		/**< svc: frame store the park pointer
+					  *  points at */
+	volatile int Retiring;		/**< svc: read channel frame store
+					  *  that the hardware may still be
+					  *  reading */
+	volatile int Latest;		/**< Producer: latest published frame */
+	volatile u32 LatestSeq;		/**< Producer: frames published so
+					  *  far */
+	volatile u32 TakenSeq;		/**< Consumer: sequence of the last
+					  *  frame picked up */
+	int NextFrame;			/**< Producer: where to start the search
+					  *  for a free frame store */
+
+	volatile u32 Consumed;		/**< Consumer: frames picked up */
+	volatile u32 Dropped;		/**< Consumer: frames skipped */
+	volatile u32 Repeated;		/**< Consumer: frames picked up again */
+	volatile u32 Overwritten;	/**< svc: write channel frames lost
+					  *  because no frame store was free */
+} XAxiVdma_FrameMgr;
+
 
 /************************** Function Prototypes ******************************/
 /* Initialization */
@@ -596,6 +678,18 @@ int XAxiVdma_SetCallBack(XAxiVdma * InstancePtr, u32 HandlerType,
         void *CallBackFunc, void *CallBackRef, u16 Direction);
 int XAxiVdma_Selftest(XAxiVdma * InstancePtr);
 
+/*
+ * Frame store manager functions in xaxivdma_frmmgr.c
+ */
+int XAxiVdma_FrameMgrInitialize(XAxiVdma_FrameMgr *MgrPtr,
+        XAxiVdma *InstancePtr, u16 Direction, int NumFrames);
+int XAxiVdma_FrameMgrStart(XAxiVdma_FrameMgr *MgrPtr);
+int XAxiVdma_FrameMgrAcquire(XAxiVdma_FrameMgr *MgrPtr, int *FrameIndexPtr);
+int XAxiVdma_FrameMgrRelease(XAxiVdma_FrameMgr *MgrPtr, int FrameIndex);
+void XAxiVdma_FrameMgrService(XAxiVdma_FrameMgr *MgrPtr);
+void XAxiVdma_FrameMgrGetStats(XAxiVdma_FrameMgr *MgrPtr,
+        XAxiVdma_FrameMgrStats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,467 @@
+/******************************************************************************
+*
+* Copyright (C) 2012 - 2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxivdma_frmmgr.c
+* @addtogroup axivdma_v6_0
+* @{
+*
+* Frame store manager: hands frame stores to software while the VDMA runs in
+* park mode, and moves the park pointer once per frame.
+*
+* Read channel (software renders, hardware displays):
+*  - Acquire returns a frame store that is neither queued nor being read.
+*  - Release queues it; a frame still queued when the next one is released
+*    is dropped.
+*  - Service parks the channel on the newest queued frame. The frame store
+*    displayed before stays busy until XAxiVdma_CurrFrameStore() reports the
+*    hardware has switched, since the park pointer is only latched at frame
+*    sync. When there is nothing new to show, the frame is repeated.
+*
+* Write channel (hardware captures, software consumes):
+*  - Service publishes the frame store just written as the latest frame and
+*    parks the channel on a store that is neither that one nor the one held
+*    by software. A published frame replaced before software picked it up is
+*    dropped.
+*  - Acquire returns the latest frame; getting the same frame twice counts
+*    as a repeat.
+*
+* There is no lock: each field of XAxiVdma_FrameMgr is written by one side
+* only, and software announces the frame store it holds before Service can
+* reuse it. This relies on Service not running concurrently on another
+* processor. Service must run before the next frame sync for the new park
+* pointer to take effect for the next frame.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.1   ms   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxivdma.h"
+#include "xaxivdma_i.h"
+
+/*****************************************************************************/
+/**
+ * Point the park reference of the managed channel at a frame store
+ *
+ * Only the reference field of the channel is changed, in a single register
+ * write, so the hardware picks up either the old or the new frame store at
+ * the next frame sync.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ * @param FrameIndex is the frame store to park on
+ *
+ * @return
+ *   None
+ *
+ * @note
+ * The park pointer register is shared by both channels. If the read and
+ * write channel managers are serviced from interrupts that can preempt each
+ * other, the caller has to serialize them.
+ *****************************************************************************/
+static void XAxiVdma_FrameMgrPark(XAxiVdma_FrameMgr *MgrPtr, int FrameIndex)
+{
+	u32 RegValue;
+
+	RegValue = XAxiVdma_ReadReg(MgrPtr->InstancePtr->BaseAddr,
+	              XAXIVDMA_PARKPTR_OFFSET);
+
+	if (MgrPtr->Direction == XAXIVDMA_READ) {
+		RegValue &= ~XAXIVDMA_PARKPTR_READREF_MASK;
+		RegValue |= (FrameIndex << XAXIVDMA_READREF_SHIFT) &
+		              XAXIVDMA_PARKPTR_READREF_MASK;
+	}
+	else {
+		RegValue &= ~XAXIVDMA_PARKPTR_WRTREF_MASK;
+		RegValue |= (FrameIndex << XAXIVDMA_WRTREF_SHIFT) &
+		              XAXIVDMA_PARKPTR_WRTREF_MASK;
+	}
+
+	XAxiVdma_WriteReg(MgrPtr->InstancePtr->BaseAddr,
+	    XAXIVDMA_PARKPTR_OFFSET, RegValue);
+}
+
+/*****************************************************************************/
+/**
+ * Find a frame store that is not one of the given busy ones
+ *
+ * The search starts after the last frame store handed out so that all frame
+ * stores are used in turn.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ * @param Busy0 is a busy frame store, or XAXIVDMA_FRAMEMGR_NONE
+ * @param Busy1 is a busy frame store, or XAXIVDMA_FRAMEMGR_NONE
+ * @param Busy2 is a busy frame store, or XAXIVDMA_FRAMEMGR_NONE
+ *
+ * @return
+ * The free frame store, or XAXIVDMA_FRAMEMGR_NONE if all are busy
+ *****************************************************************************/
+static int XAxiVdma_FrameMgrFindFree(XAxiVdma_FrameMgr *MgrPtr, int Busy0,
+        int Busy1, int Busy2)
+{
+	int Frame;
+	int Count;
+
+	Frame = MgrPtr->NextFrame;
+
+	for (Count = 0; Count < MgrPtr->NumFrames; Count++) {
+		if ((Frame != Busy0) && (Frame != Busy1) && (Frame != Busy2)) {
+			MgrPtr->NextFrame = (Frame + 1) % MgrPtr->NumFrames;
+
+			return Frame;
+		}
+
+		Frame = (Frame + 1) % MgrPtr->NumFrames;
+	}
+
+	return XAXIVDMA_FRAMEMGR_NONE;
+}
+
+/*****************************************************************************/
+/**
+ * Initialize a frame store manager for one channel
+ *
+ * The manager uses frame stores 0 to NumFrames - 1 of the channel, with the
+ * addresses set up through XAxiVdma_DmaSetBufferAddr().
+ *
+ * @param MgrPtr is the pointer to the frame store manager to initialize
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ * @param Direction is the channel to work on, use XAXIVDMA_READ/WRITE
+ * @param NumFrames is the number of frame stores to manage, at least 2.
+ *        Use 3 or more so that neither side has to wait for the other.
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_INVALID_PARAM if Direction or NumFrames is invalid
+ * - XST_DEVICE_NOT_FOUND if the channel is invalid
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameMgrInitialize(XAxiVdma_FrameMgr *MgrPtr,
+        XAxiVdma *InstancePtr, u16 Direction, int NumFrames)
+{
+	XAxiVdma_Channel *Channel;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XAXIVDMA_DEVICE_READY);
+
+	Channel = XAxiVdma_GetChannel(InstancePtr, Direction);
+
+	if (!Channel) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (!Channel->IsValid) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	if ((NumFrames < 2) || (NumFrames > Channel->NumFrames)) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "Invalid number of frame stores %d\r\n", NumFrames);
+
+		return XST_INVALID_PARAM;
+	}
+
+	memset(MgrPtr, 0, sizeof(XAxiVdma_FrameMgr));
+
+	MgrPtr->InstancePtr = InstancePtr;
+	MgrPtr->Direction = Direction;
+	MgrPtr->NumFrames = NumFrames;
+
+	MgrPtr->Held = XAXIVDMA_FRAMEMGR_NONE;
+	MgrPtr->HwFrame = 0;
+	MgrPtr->Retiring = XAXIVDMA_FRAMEMGR_NONE;
+	MgrPtr->Latest = XAXIVDMA_FRAMEMGR_NONE;
+	MgrPtr->NextFrame = 1;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Park the channel on its first frame store
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_FAILURE if the channel is not running
+ *
+ * @note
+ * The channel must have been started with XAxiVdma_DmaStart()
+ *****************************************************************************/
+int XAxiVdma_FrameMgrStart(XAxiVdma_FrameMgr *MgrPtr)
+{
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	return XAxiVdma_StartParking(MgrPtr->InstancePtr, MgrPtr->HwFrame,
+	    MgrPtr->Direction);
+}
+
+/*****************************************************************************/
+/**
+ * Get a frame store for software to work on
+ *
+ * On the read channel, this is a frame store to render into that the
+ * hardware is neither reading nor about to read. On the write channel, this
+ * is the latest frame captured; the hardware will not write it until it is
+ * released.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ * @param FrameIndexPtr returns the frame store
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_DEVICE_BUSY if software already holds a frame store
+ * - XST_NO_DATA if no frame store is available: on the read channel all are
+ *   in use by the hardware, on the write channel nothing was captured yet
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameMgrAcquire(XAxiVdma_FrameMgr *MgrPtr, int *FrameIndexPtr)
+{
+	int Frame;
+	int HwFrame;
+	u32 Seq;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(FrameIndexPtr != NULL);
+
+	if (MgrPtr->Held != XAXIVDMA_FRAMEMGR_NONE) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (MgrPtr->Direction == XAXIVDMA_READ) {
+		/* Service only ever moves HwFrame to Latest and the old
+		 * HwFrame to Retiring, so reading HwFrame before Retiring
+		 * never misses a frame store the hardware still uses
+		 */
+		HwFrame = MgrPtr->HwFrame;
+		Frame = XAxiVdma_FrameMgrFindFree(MgrPtr, MgrPtr->Latest,
+		    HwFrame, MgrPtr->Retiring);
+		if (Frame == XAXIVDMA_FRAMEMGR_NONE) {
+			return XST_NO_DATA;
+		}
+
+		MgrPtr->Held = Frame;
+	}
+	else {
+		/* Announce the frame store before using it, and retry if
+		 * Service published a newer one in between, as it may have
+		 * reused the one announced
+		 */
+		do {
+			Seq = MgrPtr->LatestSeq;
+			Frame = MgrPtr->Latest;
+			if (Frame == XAXIVDMA_FRAMEMGR_NONE) {
+				return XST_NO_DATA;
+			}
+
+			MgrPtr->Held = Frame;
+		} while (Seq != MgrPtr->LatestSeq);
+
+		if (Seq == MgrPtr->TakenSeq) {
+			MgrPtr->Repeated++;
+		}
+		else {
+			MgrPtr->Dropped += Seq - MgrPtr->TakenSeq - 1;
+			MgrPtr->Consumed++;
+			MgrPtr->TakenSeq = Seq;
+		}
+	}
+
+	*FrameIndexPtr = Frame;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Hand a frame store back to the manager
+ *
+ * On the read channel the frame store is queued for display, replacing any
+ * frame queued before that the hardware has not picked up yet. On the write
+ * channel the frame store becomes available to the hardware again.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ * @param FrameIndex is the frame store returned by XAxiVdma_FrameMgrAcquire()
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_INVALID_PARAM if software does not hold FrameIndex
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameMgrRelease(XAxiVdma_FrameMgr *MgrPtr, int FrameIndex)
+{
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	if ((FrameIndex == XAXIVDMA_FRAMEMGR_NONE) ||
+	    (FrameIndex != MgrPtr->Held)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (MgrPtr->Direction == XAXIVDMA_READ) {
+		/* Latest first: Service keys on LatestSeq, and must not see
+		 * the new sequence with the old frame store
+		 */
+		MgrPtr->Latest = FrameIndex;
+		MgrPtr->LatestSeq++;
+	}
+
+	MgrPtr->Held = XAXIVDMA_FRAMEMGR_NONE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Move the park pointer for the next frame
+ *
+ * This function must be called once per frame of the channel, typically
+ * from the general (frame count) callback with a frame count of 1, before
+ * the next frame sync.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FrameMgrService(XAxiVdma_FrameMgr *MgrPtr)
+{
+	int Current;
+	int Frame;
+	u32 Seq;
+
+	Xil_AssertVoid(MgrPtr != NULL);
+
+	Current = (int)XAxiVdma_CurrFrameStore(MgrPtr->InstancePtr,
+	    MgrPtr->Direction);
+
+	if (MgrPtr->Direction == XAXIVDMA_READ) {
+		/* The previous frame store is free once the hardware reads
+		 * the one it was parked on last
+		 */
+		if ((MgrPtr->Retiring != XAXIVDMA_FRAMEMGR_NONE) &&
+		    (Current == MgrPtr->HwFrame)) {
+			MgrPtr->Retiring = XAXIVDMA_FRAMEMGR_NONE;
+		}
+
+		Seq = MgrPtr->LatestSeq;
+		if ((MgrPtr->Retiring != XAXIVDMA_FRAMEMGR_NONE) ||
+		    (Seq == MgrPtr->TakenSeq)) {
+			if (MgrPtr->Consumed) {
+				MgrPtr->Repeated++;
+			}
+
+			return;
+		}
+
+		Frame = MgrPtr->Latest;
+		if (Frame != MgrPtr->HwFrame) {
+			XAxiVdma_FrameMgrPark(MgrPtr, Frame);
+
+			MgrPtr->Retiring = MgrPtr->HwFrame;
+			MgrPtr->HwFrame = Frame;
+			MgrPtr->Dropped += Seq - MgrPtr->TakenSeq - 1;
+			MgrPtr->Consumed++;
+		}
+		else {
+			/* Already parked on it: the frame published before
+			 * was never shown
+			 */
+			MgrPtr->Dropped += Seq - MgrPtr->TakenSeq;
+		}
+
+		MgrPtr->TakenSeq = Seq;
+	}
+	else {
+		/* The hardware did not pick up the last park pointer in time
+		 * and wrote over the frame store it used before
+		 */
+		if (Current != MgrPtr->HwFrame) {
+			MgrPtr->Overwritten++;
+
+			return;
+		}
+
+		Frame = XAxiVdma_FrameMgrFindFree(MgrPtr, MgrPtr->HwFrame,
+		    MgrPtr->Held, XAXIVDMA_FRAMEMGR_NONE);
+		if (Frame == XAXIVDMA_FRAMEMGR_NONE) {
+			/* Keep writing the same frame store */
+			MgrPtr->Overwritten++;
+
+			return;
+		}
+
+		XAxiVdma_FrameMgrPark(MgrPtr, Frame);
+
+		MgrPtr->Latest = MgrPtr->HwFrame;
+		MgrPtr->LatestSeq++;
+		MgrPtr->HwFrame = Frame;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Get the frame store manager statistics
+ *
+ * Frames the consumer skipped are counted as dropped when the consumer
+ * picks up a newer frame, so Published - Consumed - Dropped is the one
+ * frame, if any, still waiting for the consumer.
+ *
+ * @param MgrPtr is the pointer to the frame store manager
+ * @param StatsPtr returns the statistics
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FrameMgrGetStats(XAxiVdma_FrameMgr *MgrPtr,
+        XAxiVdma_FrameMgrStats *StatsPtr)
+{
+	Xil_AssertVoid(MgrPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	StatsPtr->Published = MgrPtr->LatestSeq + MgrPtr->Overwritten;
+	StatsPtr->Consumed = MgrPtr->Consumed;
+	StatsPtr->Dropped = MgrPtr->Dropped + MgrPtr->Overwritten;
+	StatsPtr->Repeated = MgrPtr->Repeated;
+}
+/** @} */
@@ -57,6 +57,8 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  01/20/15 Initial creation.
+ * 3.0   ms   10/19/26 Enabled the DPCD shadow, invalidated by the HPD
+ *                     interrupts.
  * </pre>
  *
 *******************************************************************************/
@@ -242,6 +244,9 @@ static u32 Dptx_SetupInterruptHandler(XDp *InstancePtr, INTC *IntcPtr,
 	XDp_TxSetHpdEventHandler(InstancePtr, HpdEventHandler, InstancePtr);
 	XDp_TxSetHpdPulseHandler(InstancePtr, HpdPulseHandler, InstancePtr);
 
+	/* HPD interrupts keep the DPCD shadow coherent with the RX device. */
+	XDp_TxDpcdCacheEnable(InstancePtr, 1);
+
 	/* Initialize interrupt controller driver. */
 #ifdef XPAR_INTC_0_DEVICE_ID
 	Status = XIntc_Initialize(IntcPtr, IntrId);
@@ -0,0 +1,849 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2015 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xdp_tx_mst_sim_example.c
+ *
+ * Contains a host-side test of the XDp driver's multi-stream transport (MST)
+ * topology discovery against a simulated topology of MST branch devices and
+ * sinks. No hardware is required.
+ *
+ * The example replaces the AUX channel layer of xdp.c (XDp_TxAuxRead,
+ * XDp_TxAuxWrite and XDp_WaitUs) with a model of the topology which decodes
+ * the sideband messages written to the DOWN_REQ buffer and answers through the
+ * DOWN_REP buffer and the DOWN_REP_MSG_RDY bit, as a real branch device does.
+ * Time is simulated: AUX transactions, waits and the processing and relaying
+ * of sideband messages by the branch devices each advance a clock. For each
+ * topology, discovery is run with one and with XDP_TX_SBMSG_MAX_OUTSTANDING
+ * sideband messages outstanding, and the resulting node table and sink list
+ * are checked against the model. The sideband message CRCs are checked by the
+ * model with a bitwise implementation independent from the driver's tables.
+ *
+ * @note	This example is built and run on the host, linking xdp_mst.c
+ *		without xdp.c. For example, from the dp/src directory:
+ *		    gcc -fcommon -I. -I../../video_common/src -I<bsp>/common
+ *			-I<bsp>/microblaze -I<dir with an empty xparameters.h>
+ *			../examples/xdp_tx_mst_sim_example.c xdp_mst.c
+ *			-o xdp_tx_mst_sim
+ *		where <bsp> is lib/bsp/standalone/src.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 3.0   ms   10/19/26 Initial creation.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "xdp.h"
+
+/**************************** Constant Definitions ****************************/
+
+/* The simulated time taken by an AUX transaction of up to 16 data bytes: the
+ * request, the reply and the turnaround, plus the time per data byte. */
+#define SIM_AUX_TRANSACTION_US	60
+#define SIM_AUX_BYTE_US		8
+/* The simulated time taken by a branch device to process a sideband message,
+ * and to relay a sideband message or a reply over one link. */
+#define SIM_SBMSG_PROCESS_US	1500
+#define SIM_SBMSG_HOP_US	400
+/* The simulated time for the next fragment of a reply to be placed in the
+ * DOWN_REP buffer after the previous fragment. */
+#define SIM_SBMSG_FRAGMENT_US	200
+
+/* The maximum length of a sideband message fragment. */
+#define SIM_SBMSG_MAX_LENGTH	48
+
+#define SIM_MAX_NODES		63
+#define SIM_MAX_FRAGMENTS	64
+
+/* The peer device types reported in the LINK_ADDRESS reply. */
+#define SIM_PEER_NONE		0
+#define SIM_PEER_SOURCE		1
+#define SIM_PEER_BRANCH		2
+#define SIM_PEER_SINK		3
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * A simulated DisplayPort device. Output ports are numbered from 1; port 0 is
+ * the input port of a branch device.
+ */
+typedef struct {
+	u8 IsBranch;
+	u8 NumPorts;
+	s8 Child[XDP_MAX_NPORTS];
+	u8 Guid[XDP_GUID_NBYTES];
+	u8 DpcdRev;
+	u8 MsgCap;
+	u8 LinkCountTotal;
+	u8 RelativeAddress[15];
+} SimNode;
+
+/**
+ * A sideband reply fragment waiting to be placed in the DOWN_REP buffer.
+ */
+typedef struct {
+	u32 ReadyUs;
+	u8 Length;
+	u8 Data[SIM_SBMSG_MAX_LENGTH];
+} SimFragment;
+
+/**************************** Function Prototypes *****************************/
+
+static void Dptx_SimReset(void);
+static s8 Dptx_SimAddNode(s8 Parent, u8 Port, u8 IsBranch, u8 NumPorts,
+							u8 MsgCap, u8 GuidSeed);
+static u8 Dptx_SimCrc(const u8 *Data, u32 NumberOfBits, u8 Polynomial);
+static void Dptx_SimDownReq(u8 *Data, u32 Length);
+static void Dptx_SimQueueReply(u8 *ReqHeader, u8 ReqHeaderLength, u8 SeqNum,
+				u8 LinkCountTotal, u8 *Body, u16 BodyLength);
+static u32 Dptx_SimRun(const char *Name, u8 MaxOutstanding);
+static void Dptx_SimExpectSinks(s8 Node);
+static void Dptx_SimBuildDaisyChain(void);
+static void Dptx_SimBuildTree(void);
+
+/************************** Variable Definitions ******************************/
+
+static XDp DpInstance;
+
+static SimNode Nodes[SIM_MAX_NODES];
+static u8 NumNodes;
+static u8 NumSinks;
+
+static SimFragment Fragments[SIM_MAX_FRAGMENTS];
+static u8 NumFragments;
+
+static u32 SimTimeUs;
+static u32 AuxTransactions;
+static u32 SbMsgRequests;
+static u32 CrcErrors;
+
+static s8 ExpectedSinks[SIM_MAX_NODES];
+static u8 NumExpectedSinks;
+
+/**************************** Function Definitions ****************************/
+
+/******************************************************************************/
+/**
+ * This function is the main function of the simulated MST topology example.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if discovery of every simulated topology matched
+ *		  the model.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int main(void)
+{
+	u32 Failures = 0;
+
+	Dptx_SimBuildDaisyChain();
+	Failures += Dptx_SimRun("4-monitor daisy chain", 1);
+	Failures += Dptx_SimRun("4-monitor daisy chain",
+						XDP_TX_SBMSG_MAX_OUTSTANDING);
+
+	Dptx_SimBuildTree();
+	Failures += Dptx_SimRun("3-level tree", 1);
+	Failures += Dptx_SimRun("3-level tree", XDP_TX_SBMSG_MAX_OUTSTANDING);
+
+	printf("%s\n", Failures ? "FAILED" : "PASSED");
+
+	return Failures ? XST_FAILURE : XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function runs topology discovery against the current model and checks
+ * the resulting topology.
+ *
+ * @param	Name is the name of the topology to print.
+ * @param	MaxOutstanding is the number of LINK_ADDRESS sideband messages
+ *		which may be outstanding.
+ *
+ * @return	The number of mismatches found.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 Dptx_SimRun(const char *Name, u8 MaxOutstanding)
+{
+	u32 Status;
+	u32 Failures = 0;
+	u8 Index;
+	u8 Index2;
+	XDp_TxTopology *Topology = &DpInstance.TxInstance.Topology;
+	XDp_TxTopologyNode *TopologyNode;
+	SimNode *Sink;
+	static const u8 NoGuid[XDP_GUID_NBYTES];
+
+	/* Clear the GUIDs issued by a previous run. */
+	for (Index = 0; Index < NumNodes; Index++) {
+		if (Nodes[Index].MsgCap) {
+			memset(Nodes[Index].Guid, 0, XDP_GUID_NBYTES);
+		}
+	}
+
+	memset(&DpInstance, 0, sizeof(DpInstance));
+	DpInstance.Config.IsRx = 0;
+	DpInstance.IsReady = XIL_COMPONENT_IS_READY;
+	DpInstance.TxInstance.SbMsgMaxOutstanding = MaxOutstanding;
+
+	NumFragments = 0;
+	SimTimeUs = 0;
+	AuxTransactions = 0;
+	SbMsgRequests = 0;
+	CrcErrors = 0;
+
+	Status = XDp_TxDiscoverTopology(&DpInstance);
+
+	printf("%-22s outstanding %d: %6u us, %4u AUX transactions, "
+		"%3u sideband messages, %2d nodes, %2d sinks\n", Name,
+		MaxOutstanding, SimTimeUs, AuxTransactions, SbMsgRequests,
+		Topology->NodeTotal, Topology->SinkTotal);
+
+	if (Status != XST_SUCCESS) {
+		printf("  discovery failed\n");
+		Failures++;
+	}
+	if (CrcErrors != 0) {
+		printf("  %u sideband messages with a bad CRC\n", CrcErrors);
+		Failures++;
+	}
+	if ((Topology->NodeTotal != NumNodes) ||
+					(Topology->SinkTotal != NumSinks)) {
+		printf("  expected %d nodes and %d sinks\n", NumNodes,
+								NumSinks);
+		return Failures + 1;
+	}
+
+	/* The sinks are listed depth first with the sinks of a branch device
+	 * before the devices downstream of its branch devices. */
+	NumExpectedSinks = 0;
+	Dptx_SimExpectSinks(0);
+	for (Index = 0; Index < Topology->SinkTotal; Index++) {
+		TopologyNode = Topology->SinkList[Index];
+		Sink = &Nodes[ExpectedSinks[Index]];
+
+		if ((TopologyNode->LinkCountTotal != Sink->LinkCountTotal) ||
+				memcmp(TopologyNode->RelativeAddress,
+				Sink->RelativeAddress,
+				Sink->LinkCountTotal - 1)) {
+			printf("  sink %d is at the wrong address\n", Index);
+			Failures++;
+		}
+		else if (memcmp(TopologyNode->Guid, Sink->Guid,
+							XDP_GUID_NBYTES)) {
+			printf("  sink %d has the wrong GUID\n", Index);
+			Failures++;
+		}
+	}
+
+	/* Every device has a GUID and the node table holds it. */
+	for (Index = 0; Index < Topology->NodeTotal; Index++) {
+		TopologyNode = &Topology->NodeTable[Index];
+
+		for (Index2 = 0; Index2 < NumNodes; Index2++) {
+			if ((Nodes[Index2].LinkCountTotal ==
+					TopologyNode->LinkCountTotal) &&
+					!memcmp(Nodes[Index2].RelativeAddress,
+					TopologyNode->RelativeAddress,
+					TopologyNode->LinkCountTotal - 1)) {
+				break;
+			}
+		}
+		if ((Index2 == NumNodes) || memcmp(TopologyNode->Guid,
+				Nodes[Index2].Guid, XDP_GUID_NBYTES)) {
+			printf("  node %d does not match the model\n", Index);
+			Failures++;
+		}
+		else if (Nodes[Index2].MsgCap && !memcmp(Nodes[Index2].Guid,
+						NoGuid, XDP_GUID_NBYTES)) {
+			printf("  node %d was not issued a GUID\n", Index);
+			Failures++;
+		}
+	}
+
+	return Failures;
+}
+
+/******************************************************************************/
+/**
+ * This function lists the sinks downstream of a branch device of the model in
+ * depth first order.
+ *
+ * @param	Node is the index of the branch device.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimExpectSinks(s8 Node)
+{
+	u8 Port;
+	s8 Child;
+
+	for (Port = 1; Port <= Nodes[Node].NumPorts; Port++) {
+		Child = Nodes[Node].Child[Port];
+		if ((Child >= 0) && !Nodes[Child].IsBranch) {
+			ExpectedSinks[NumExpectedSinks++] = Child;
+		}
+	}
+	for (Port = 1; Port <= Nodes[Node].NumPorts; Port++) {
+		Child = Nodes[Node].Child[Port];
+		if ((Child >= 0) && Nodes[Child].IsBranch) {
+			Dptx_SimExpectSinks(Child);
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function builds a daisy chain of 4 monitors, each of which has an MST
+ * branch device with the monitor's sink on port 1 and the next monitor on
+ * port 2.
+ *
+ * @param	None.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimBuildDaisyChain(void)
+{
+	s8 Branch;
+	u8 Index;
+
+	Dptx_SimReset();
+
+	Branch = Dptx_SimAddNode(-1, 0, 1, 2, 1, 0);
+	for (Index = 0; Index < 4; Index++) {
+		Dptx_SimAddNode(Branch, 1, 0, 0, Index & 0x1, 0x10 + Index);
+		if (Index < 3) {
+			Branch = Dptx_SimAddNode(Branch, 2, 1, 2, 1, 0);
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function builds a tree of hubs: a 4 port hub with a sink and 3 more
+ * hubs downstream, each with 2 sinks, one of which has another hub with 2
+ * sinks downstream. Port numbers are interleaved between sinks and branch
+ * devices.
+ *
+ * @param	None.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimBuildTree(void)
+{
+	s8 Root;
+	s8 Hub;
+	u8 Index;
+
+	Dptx_SimReset();
+
+	Root = Dptx_SimAddNode(-1, 0, 1, 4, 1, 0);
+	for (Index = 0; Index < 3; Index++) {
+		Hub = Dptx_SimAddNode(Root, Index + 1, 1, 3, 1, 0);
+		Dptx_SimAddNode(Hub, 1, 0, 0, 1, 0x20 + (2 * Index));
+		Dptx_SimAddNode(Hub, 3, 0, 0, 0, 0x21 + (2 * Index));
+		if (Index == 1) {
+			Hub = Dptx_SimAddNode(Hub, 2, 1, 2, 1, 0);
+			Dptx_SimAddNode(Hub, 1, 0, 0, 1, 0x30);
+			Dptx_SimAddNode(Hub, 2, 0, 0, 1, 0x31);
+		}
+	}
+	Dptx_SimAddNode(Root, 4, 0, 0, 0, 0x40);
+}
+
+/******************************************************************************/
+/**
+ * This function empties the model.
+ *
+ * @param	None.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimReset(void)
+{
+	memset(Nodes, 0, sizeof(Nodes));
+	NumNodes = 0;
+	NumSinks = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function adds a device to the model.
+ *
+ * @param	Parent is the index of the upstream branch device, or -1 for
+ *		the device connected to the DisplayPort TX.
+ * @param	Port is the output port of the parent the device is connected
+ *		to.
+ * @param	IsBranch is 1 for an MST branch device and 0 for a sink.
+ * @param	NumPorts is the number of output ports of a branch device.
+ * @param	MsgCap is 1 if the device handles sideband messages. Branch
+ *		devices, and sinks with MsgCap set, start without a GUID and
+ *		expect discovery to issue one.
+ * @param	GuidSeed is used to make up the GUID of a sink without MsgCap.
+ *
+ * @return	The index of the new device.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static s8 Dptx_SimAddNode(s8 Parent, u8 Port, u8 IsBranch, u8 NumPorts,
+							u8 MsgCap, u8 GuidSeed)
+{
+	SimNode *Node = &Nodes[NumNodes];
+	u8 Index;
+
+	Node->IsBranch = IsBranch;
+	Node->NumPorts = NumPorts;
+	memset(Node->Child, -1, sizeof(Node->Child));
+	Node->DpcdRev = 0x12;
+	Node->MsgCap = MsgCap;
+
+	if (!MsgCap) {
+		for (Index = 0; Index < XDP_GUID_NBYTES; Index++) {
+			Node->Guid[Index] = GuidSeed + Index;
+		}
+	}
+
+	if (Parent < 0) {
+		Node->LinkCountTotal = 1;
+	}
+	else {
+		Nodes[Parent].Child[Port] = NumNodes;
+		Node->LinkCountTotal = Nodes[Parent].LinkCountTotal + 1;
+		memcpy(Node->RelativeAddress, Nodes[Parent].RelativeAddress,
+					Nodes[Parent].LinkCountTotal - 1);
+		Node->RelativeAddress[Node->LinkCountTotal - 2] = Port;
+	}
+
+	if (!IsBranch) {
+		NumSinks++;
+	}
+
+	return NumNodes++;
+}
+
+/******************************************************************************/
+/**
+ * This function is the reference bitwise CRC of sideband messages used to
+ * check the driver's messages and to compute the CRCs of the model's replies.
+ *
+ * @param	Data is a pointer to the nibbles (CRC4) or bytes (CRC8).
+ * @param	NumberOfBits is the number of data bits.
+ * @param	Polynomial is 4 for the header CRC and 8 for the body CRC.
+ *
+ * @return	The CRC value.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 Dptx_SimCrc(const u8 *Data, u32 NumberOfBits, u8 Polynomial)
+{
+	u32 Bit;
+	u32 Width = Polynomial;
+	u16 Generator = (Polynomial == 4) ? 0x13 : 0x1D5;
+	u16 Remainder = 0;
+
+	/* Long division of the data followed by Width zero bits. */
+	for (Bit = 0; Bit < (NumberOfBits + Width); Bit++) {
+		Remainder <<= 1;
+		if (Bit < NumberOfBits) {
+			Remainder |= (Data[Bit / Width] >>
+					(Width - 1 - (Bit % Width))) & 0x1;
+		}
+		if (Remainder & (1 << Width)) {
+			Remainder ^= Generator;
+		}
+	}
+
+	return Remainder;
+}
+
+/******************************************************************************/
+/**
+ * This function handles a sideband message written to the DOWN_REQ buffer by
+ * the driver: LINK_ADDRESS and REMOTE_DPCD_WRITE are answered, other requests
+ * and requests with a bad relative address are NACK'ed.
+ *
+ * @param	Data is a pointer to the message fragment.
+ * @param	Length is the number of bytes written.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimDownReq(u8 *Data, u32 Length)
+{
+	u8 Nibbles[20];
+	u8 Reply[256];
+	u16 ReplyLength = 0;
+	u8 LinkCountTotal = Data[0] >> 4;
+	u8 HeaderLength = 3 + (LinkCountTotal / 2);
+	u8 BodyLength = Data[HeaderLength - 2] & 0x3F;
+	u8 SeqNum = (Data[HeaderLength - 1] >> 4) & 0x1;
+	u8 *Body = &Data[HeaderLength];
+	u8 NumNibbles = 0;
+	u8 Index;
+	u8 Port;
+	u32 Address;
+	s8 Node = 0;
+	s8 Child;
+
+	SbMsgRequests++;
+
+	/* Check the header and body CRCs. */
+	for (Index = 0; Index < (HeaderLength - 1); Index++) {
+		Nibbles[NumNibbles++] = Data[Index] >> 4;
+		Nibbles[NumNibbles++] = Data[Index] & 0xF;
+	}
+	Nibbles[NumNibbles++] = Data[HeaderLength - 1] >> 4;
+	if ((Dptx_SimCrc(Nibbles, 4 * NumNibbles, 4) !=
+				(Data[HeaderLength - 1] & 0xF)) ||
+			(Dptx_SimCrc(Body, 8 * (BodyLength - 1), 8) !=
+				Body[BodyLength - 1]) ||
+			(Length != (u32)(HeaderLength + BodyLength))) {
+		CrcErrors++;
+		return;
+	}
+
+	/* Follow the relative address to the target branch device. */
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		Port = (Data[1 + (Index / 2)] >> ((Index & 0x1) ? 0 : 4)) & 0xF;
+		Node = Nodes[Node].IsBranch ? Nodes[Node].Child[Port] : -1;
+		if (Node < 0) {
+			break;
+		}
+	}
+
+	if ((Node >= 0) && Nodes[Node].IsBranch &&
+				(Body[0] == XDP_SBMSG_LINK_ADDRESS)) {
+		Reply[ReplyLength++] = XDP_SBMSG_LINK_ADDRESS;
+		memcpy(&Reply[ReplyLength], Nodes[Node].Guid, XDP_GUID_NBYTES);
+		ReplyLength += XDP_GUID_NBYTES;
+		Reply[ReplyLength++] = Nodes[Node].NumPorts + 1;
+
+		/* Input port. */
+		Reply[ReplyLength++] = 0x80 | (SIM_PEER_SOURCE << 4);
+		Reply[ReplyLength++] = 0xC0;
+
+		for (Port = 1; Port <= Nodes[Node].NumPorts; Port++) {
+			Child = Nodes[Node].Child[Port];
+			if (Child < 0) {
+				Reply[ReplyLength++] = (SIM_PEER_NONE << 4) |
+									Port;
+				Reply[ReplyLength++] = 0x00;
+				Reply[ReplyLength++] = 0x00;
+				memset(&Reply[ReplyLength], 0, XDP_GUID_NBYTES);
+			}
+			else {
+				Reply[ReplyLength++] = ((Nodes[Child].IsBranch ?
+					SIM_PEER_BRANCH : SIM_PEER_SINK) << 4) |
+									Port;
+				Reply[ReplyLength++] =
+					(Nodes[Child].MsgCap << 7) | 0x40;
+				Reply[ReplyLength++] = Nodes[Child].DpcdRev;
+				memcpy(&Reply[ReplyLength], Nodes[Child].Guid,
+							XDP_GUID_NBYTES);
+			}
+			ReplyLength += XDP_GUID_NBYTES;
+			Reply[ReplyLength++] = 0x11;
+		}
+	}
+	else if ((Node >= 0) && Nodes[Node].IsBranch &&
+				(Body[0] == XDP_SBMSG_REMOTE_DPCD_WRITE) &&
+				(Nodes[Node].Child[Body[1] >> 4] >= 0)) {
+		Child = Nodes[Node].Child[Body[1] >> 4];
+		Address = ((Body[1] & 0xF) << 16) | (Body[2] << 8) | Body[3];
+		if ((Address == XDP_DPCD_GUID) &&
+					(Body[4] == XDP_GUID_NBYTES)) {
+			memcpy(Nodes[Child].Guid, &Body[5], XDP_GUID_NBYTES);
+		}
+		Reply[ReplyLength++] = XDP_SBMSG_REMOTE_DPCD_WRITE;
+		Reply[ReplyLength++] = Body[1] >> 4;
+	}
+	else {
+		Reply[ReplyLength++] = 0x80 | Body[0];
+		memset(&Reply[ReplyLength], 0, XDP_GUID_NBYTES);
+		ReplyLength += XDP_GUID_NBYTES;
+		Reply[ReplyLength++] = XDP_SBMSG_NAK_REASON_INVALID_RAD;
+		Reply[ReplyLength++] = 0;
+	}
+
+	Dptx_SimQueueReply(Data, HeaderLength, SeqNum, LinkCountTotal, Reply,
+								ReplyLength);
+}
+
+/******************************************************************************/
+/**
+ * This function splits a reply into fragments and queues them for the DOWN_REP
+ * buffer in order of the time they become ready, so that the replies to
+ * concurrent requests may interleave.
+ *
+ * @param	ReqHeader is a pointer to the header of the request, whose
+ *		relative address is echoed.
+ * @param	ReqHeaderLength is the length of the request header.
+ * @param	SeqNum is the message sequence number of the request.
+ * @param	LinkCountTotal is the link count total of the request.
+ * @param	Body is a pointer to the reply body.
+ * @param	BodyLength is the number of bytes in the reply body.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Dptx_SimQueueReply(u8 *ReqHeader, u8 ReqHeaderLength, u8 SeqNum,
+				u8 LinkCountTotal, u8 *Body, u16 BodyLength)
+{
+	u8 Nibbles[20];
+	u8 NumNibbles;
+	u8 ChunkMax = SIM_SBMSG_MAX_LENGTH - ReqHeaderLength - 1;
+	u8 Chunk;
+	u16 Offset = 0;
+	u8 Index;
+	u32 ReadyUs = SimTimeUs + SIM_SBMSG_PROCESS_US +
+				(2 * SIM_SBMSG_HOP_US * (LinkCountTotal - 1));
+	SimFragment Fragment;
+
+	while (Offset < BodyLength) {
+		Chunk = ((BodyLength - Offset) > ChunkMax) ? ChunkMax :
+							(BodyLength - Offset);
+
+		/* Header: the request's relative address with the link count
+		 * remaining cleared, the fragment length and the sequence
+		 * number. */
+		memcpy(Fragment.Data, ReqHeader, ReqHeaderLength - 2);
+		Fragment.Data[0] &= 0xF0;
+		Fragment.Data[ReqHeaderLength - 2] = Chunk + 1;
+		Fragment.Data[ReqHeaderLength - 1] =
+				((Offset == 0) << 7) |
+				(((Offset + Chunk) == BodyLength) << 6) |
+				(SeqNum << 4);
+		NumNibbles = 0;
+		for (Index = 0; Index < (ReqHeaderLength - 1); Index++) {
+			Nibbles[NumNibbles++] = Fragment.Data[Index] >> 4;
+			Nibbles[NumNibbles++] = Fragment.Data[Index] & 0xF;
+		}
+		Nibbles[NumNibbles++] = Fragment.Data[ReqHeaderLength - 1] >> 4;
+		Fragment.Data[ReqHeaderLength - 1] |=
+				Dptx_SimCrc(Nibbles, 4 * NumNibbles, 4);
+
+		memcpy(&Fragment.Data[ReqHeaderLength], &Body[Offset], Chunk);
+		Fragment.Data[ReqHeaderLength + Chunk] =
+				Dptx_SimCrc(&Body[Offset], 8 * Chunk, 8);
+		Fragment.Length = ReqHeaderLength + Chunk + 1;
+		Fragment.ReadyUs = ReadyUs;
+
+		/* Insert in ready time order. */
+		for (Index = NumFragments; (Index > 0) &&
+			(Fragments[Index - 1].ReadyUs > ReadyUs); Index--) {
+			Fragments[Index] = Fragments[Index - 1];
+		}
+		Fragments[Index] = Fragment;
+		NumFragments++;
+
+		Offset += Chunk;
+		ReadyUs += SIM_SBMSG_FRAGMENT_US;
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function simulates AUX read transactions to the device connected to
+ * the DisplayPort TX.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	DpcdAddress is the starting DPCD address to read.
+ * @param	BytesToRead is the number of bytes to read.
+ * @param	ReadData is a pointer to the buffer for the data.
+ *
+ * @return	XST_SUCCESS.
+ *
+ * @note	The DOWN_REP_MSG_RDY bit of the ESI0 register is set while the
+ *		next reply fragment is ready; the DOWN_REP buffer holds it.
+ *
+*******************************************************************************/
+u32 XDp_TxAuxRead(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToRead,
+								void *ReadData)
+{
+	u8 *Data = ReadData;
+	u8 Ready = (NumFragments > 0) && (Fragments[0].ReadyUs <= SimTimeUs);
+	u32 Index;
+
+	AuxTransactions += (BytesToRead + 15) / 16;
+	SimTimeUs += (((BytesToRead + 15) / 16) * SIM_AUX_TRANSACTION_US) +
+					(BytesToRead * SIM_AUX_BYTE_US);
+
+	memset(Data, 0, BytesToRead);
+	if (DpcdAddress == XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0) {
+		Data[0] = Ready ? 0x10 : 0x00;
+	}
+	else if ((DpcdAddress >= XDP_DPCD_DOWN_REP) && Ready) {
+		for (Index = 0; Index < BytesToRead; Index++) {
+			if ((DpcdAddress - XDP_DPCD_DOWN_REP + Index) <
+						SIM_SBMSG_MAX_LENGTH) {
+				Data[Index] = Fragments[0].Data[DpcdAddress -
+						XDP_DPCD_DOWN_REP + Index];
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function simulates AUX write transactions to the device connected to
+ * the DisplayPort TX.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	DpcdAddress is the starting DPCD address to write.
+ * @param	BytesToWrite is the number of bytes to write.
+ * @param	WriteData is a pointer to the data.
+ *
+ * @return	XST_SUCCESS.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XDp_TxAuxWrite(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToWrite,
+							void *WriteData)
+{
+	u8 *Data = WriteData;
+
+	AuxTransactions += (BytesToWrite + 15) / 16;
+	SimTimeUs += (((BytesToWrite + 15) / 16) * SIM_AUX_TRANSACTION_US) +
+					(BytesToWrite * SIM_AUX_BYTE_US);
+
+	if (DpcdAddress == XDP_DPCD_DOWN_REQ) {
+		Dptx_SimDownReq(Data, BytesToWrite);
+	}
+	else if ((DpcdAddress == XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0) &&
+			(Data[0] & 0x10) && (NumFragments > 0) &&
+			(Fragments[0].ReadyUs <= SimTimeUs)) {
+		/* The fragment in the DOWN_REP buffer was read. */
+		NumFragments--;
+		memmove(&Fragments[0], &Fragments[1],
+					NumFragments * sizeof(SimFragment));
+		if ((NumFragments > 0) && (Fragments[0].ReadyUs <
+				(SimTimeUs + SIM_SBMSG_FRAGMENT_US))) {
+			Fragments[0].ReadyUs = SimTimeUs +
+						SIM_SBMSG_FRAGMENT_US;
+		}
+	}
+	else if ((DpcdAddress == XDP_DPCD_GUID) &&
+					(BytesToWrite == XDP_GUID_NBYTES)) {
+		memcpy(Nodes[0].Guid, Data, XDP_GUID_NBYTES);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function advances the simulated time.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	MicroSeconds is the number of microseconds to wait.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_WaitUs(XDp *InstancePtr, u32 MicroSeconds)
+{
+	SimTimeUs += MicroSeconds;
+}
+
+/* The remaining functions of xdp.c, xdp_edid.c and the BSP referenced by
+ * xdp_mst.c are not used by topology discovery. */
+u32 XDp_TxIicRead(XDp *InstancePtr, u8 IicAddress, u16 Offset,
+					u16 BytesToRead, void *ReadData)
+{
+	return XST_FAILURE;
+}
+
+u32 XDp_TxIicWrite(XDp *InstancePtr, u8 IicAddress, u8 BytesToWrite,
+							void *WriteData)
+{
+	return XST_FAILURE;
+}
+
+u32 XDp_TxGetRemoteTiledDisplayDb(XDp *InstancePtr, u8 *EdidExt,
+		u8 LinkCountTotal, u8 *RelativeAddress, u8 **DataBlockPtr)
+{
+	return XST_FAILURE;
+}
+
+u32 Xil_In32(u32 Addr)
+{
+	return 0;
+}
+
+void Xil_Out32(u32 Addr, u32 Value)
+{
+}
+
+u32 Xil_AssertStatus;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assertion failed at %s:%d\n", File, Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
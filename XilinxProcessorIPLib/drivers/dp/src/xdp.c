@@ -51,6 +51,12 @@
  * 2.0   als  06/08/15 Updated RX initialization with MST support.
  *                     Added callbacks for lane count changes, link rate changes
  *                     and pre-emphasis + voltage swing adjust requests.
+ * 3.0   ms   10/19/26 Added a DPCD shadow for the receiver capability and link
+ *                     configuration fields. AUX and HPD polling loops sample
+ *                     before waiting so back to back transactions are not
+ *                     delayed when the core is already idle.
+ *       ms   10/19/26 Default the number of outstanding sideband messages used
+ *                     by topology discovery to XDP_TX_SBMSG_MAX_OUTSTANDING.
  * </pre>
  *
 *******************************************************************************/
@@ -142,6 +148,10 @@ static u32 XDp_TxAuxRequest(XDp *InstancePtr, XDp_AuxTransaction *Request);
 static u32 XDp_TxAuxRequestSend(XDp *InstancePtr, XDp_AuxTransaction *Request);
 static u32 XDp_TxAuxWaitReply(XDp *InstancePtr);
 static u32 XDp_TxAuxWaitReady(XDp *InstancePtr);
+static u32 XDp_TxDpcdCacheRead(XDp *InstancePtr, u32 Address, u32 NumBytes,
+								u8 *Data);
+static void XDp_TxDpcdCacheUpdate(XDp *InstancePtr, u32 Address,
+			u32 NumBytes, u8 *Data, u32 Start, u32 Generation);
 /* Miscellaneous functions. */
 static u32 XDp_TxSetClkSpeed(XDp *InstancePtr, u32 Speed);
 static u32 XDp_WaitPhyReady(XDp *InstancePtr, u32 Mask);
@@ -191,6 +201,11 @@ void XDp_CfgInitialize(XDp *InstancePtr, XDp_Config *ConfigPtr,
 		XDp_TxCfgTxPeLevel(InstancePtr, 1, XDP_TX_PE_LEVEL_1);
 		XDp_TxCfgTxPeLevel(InstancePtr, 2, XDP_TX_PE_LEVEL_2);
 		XDp_TxCfgTxPeLevel(InstancePtr, 3, XDP_TX_PE_LEVEL_3);
+
+		/* Query up to XDP_TX_SBMSG_MAX_OUTSTANDING branch devices at
+		 * once during topology discovery. */
+		InstancePtr->TxInstance.SbMsgMaxOutstanding =
+						XDP_TX_SBMSG_MAX_OUTSTANDING;
 	}
 
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
@@ -620,18 +635,23 @@ u32 XDp_TxIsConnected(XDp *InstancePtr)
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
 
-	do {
-		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+	Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
 				XDP_TX_INTERRUPT_SIG_STATE) &
 				XDP_TX_INTERRUPT_SIG_STATE_HPD_STATE_MASK;
 
+	/* Only wait if the HPD signal is not asserted yet. */
+	while (Status == 0) {
 		if (Retries > XDP_IS_CONNECTED_MAX_TIMEOUT_COUNT) {
 			return 0;
 		}
 
 		Retries++;
 		XDp_WaitUs(InstancePtr, 1000);
-	} while (Status == 0);
+
+		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+				XDP_TX_INTERRUPT_SIG_STATE) &
+				XDP_TX_INTERRUPT_SIG_STATE_HPD_STATE_MASK;
+	}
 
 	return 1;
 }
@@ -656,13 +676,16 @@ u32 XDp_TxIsConnected(XDp *InstancePtr)
  *		- XST_ERROR_COUNT_MAX if the AUX request timed out.
  *		- XST_FAILURE otherwise.
  *
- * @note	None.
+ * @note	If the DPCD shadow is enabled, reads which fall entirely within
+ *		the receiver capability and link configuration fields are served
+ *		from the shadow once the bytes have been read from the RX device.
  *
 *******************************************************************************/
 u32 XDp_TxAuxRead(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToRead,
 								void *ReadData)
 {
 	u32 Status;
+	u32 Generation;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -673,12 +696,25 @@ u32 XDp_TxAuxRead(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToRead,
 	Xil_AssertNonvoid(ReadData != NULL);
 
 	if (!XDp_TxIsConnected(InstancePtr)) {
+		XDp_TxDpcdCacheInvalidate(InstancePtr);
 		return XST_DEVICE_NOT_FOUND;
 	}
 
+	/* Use the shadowed values if all requested bytes are held. */
+	Status = XDp_TxDpcdCacheRead(InstancePtr, DpcdAddress, BytesToRead,
+							(u8 *)ReadData);
+	if (Status == XST_SUCCESS) {
+		return Status;
+	}
+
 	/* Send AUX read transaction. */
+	Generation = InstancePtr->TxInstance.DpcdCache.Generation;
 	Status = XDp_TxAuxCommon(InstancePtr, XDP_TX_AUX_CMD_READ, DpcdAddress,
 						BytesToRead, (u8 *)ReadData);
+	if (Status == XST_SUCCESS) {
+		XDp_TxDpcdCacheUpdate(InstancePtr, DpcdAddress, BytesToRead,
+				(u8 *)ReadData, XDP_DPCD_REV, Generation);
+	}
 
 	return Status;
 }
@@ -703,13 +739,15 @@ u32 XDp_TxAuxRead(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToRead,
  *		- XST_ERROR_COUNT_MAX if the AUX request timed out.
  *		- XST_FAILURE otherwise.
  *
- * @note	None.
+ * @note	Bytes written to the link configuration field are also written
+ *		to the DPCD shadow.
  *
 *******************************************************************************/
 u32 XDp_TxAuxWrite(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToWrite,
 								void *WriteData)
 {
 	u32 Status;
+	u32 Generation;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -720,12 +758,23 @@ u32 XDp_TxAuxWrite(XDp *InstancePtr, u32 DpcdAddress, u32 BytesToWrite,
 	Xil_AssertNonvoid(WriteData != NULL);
 
 	if (!XDp_TxIsConnected(InstancePtr)) {
+		XDp_TxDpcdCacheInvalidate(InstancePtr);
 		return XST_DEVICE_NOT_FOUND;
 	}
 
 	/* Send AUX write transaction. */
+	Generation = InstancePtr->TxInstance.DpcdCache.Generation;
 	Status = XDp_TxAuxCommon(InstancePtr, XDP_TX_AUX_CMD_WRITE, DpcdAddress,
 						BytesToWrite, (u8 *)WriteData);
+	if (Status == XST_SUCCESS) {
+		XDp_TxDpcdCacheUpdate(InstancePtr, DpcdAddress, BytesToWrite,
+			(u8 *)WriteData, XDP_DPCD_LINK_BW_SET, Generation);
+	}
+	else {
+		/* A partially completed write leaves the RX device's values
+		 * unknown. */
+		XDp_TxDpcdCacheInvalidate(InstancePtr);
+	}
 
 	return Status;
 }
@@ -894,6 +943,60 @@ u32 XDp_TxIicWrite(XDp *InstancePtr, u8 IicAddress, u8 BytesToWrite,
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * This function enables or disables the shadow of the RX device's receiver
+ * capability and link configuration fields of the DisplayPort Configuration
+ * Data (DPCD). While enabled, XDp_TxAuxRead serves reads of these fields from
+ * the shadow once they have been read from the RX device, which avoids AUX
+ * round trips during link training and capability checks.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Enable set to 1 enables the shadow, 0 disables it.
+ *
+ * @return	None.
+ *
+ * @note	The shadow is invalidated by the driver's HPD interrupt handling.
+ *		When HPD events are polled instead, XDp_TxDpcdCacheInvalidate
+ *		must be called whenever an HPD event or pulse is detected.
+ *
+*******************************************************************************/
+void XDp_TxDpcdCacheEnable(XDp *InstancePtr, u8 Enable)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertVoid((Enable == 0) || (Enable == 1));
+
+	XDp_TxDpcdCacheInvalidate(InstancePtr);
+	InstancePtr->TxInstance.DpcdCache.Enabled = Enable;
+}
+
+/******************************************************************************/
+/**
+ * This function invalidates the shadow of the RX device's DisplayPort
+ * Configuration Data (DPCD) such that subsequent reads are sent to the RX
+ * device.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxDpcdCacheInvalidate(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	InstancePtr->TxInstance.DpcdCache.Generation++;
+	memset(InstancePtr->TxInstance.DpcdCache.Valid, 0,
+			sizeof(InstancePtr->TxInstance.DpcdCache.Valid));
+}
+
 /******************************************************************************/
 /**
  * This function enables or disables 0.5% spreading of the clock for both the
@@ -3040,17 +3143,19 @@ static u32 XDp_TxAuxRequestSend(XDp *InstancePtr, XDp_AuxTransaction *Request)
 
 	/* Ensure that any pending AUX transactions have completed. */
 	TimeoutCount = 0;
-	do {
-		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+	Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
 							XDP_TX_REPLY_STATUS);
-
-		XDp_WaitUs(InstancePtr, 20);
+	while ((Status & XDP_TX_REPLY_STATUS_REQUEST_IN_PROGRESS_MASK) &&
+			(Status & XDP_TX_REPLY_STATUS_REPLY_IN_PROGRESS_MASK)) {
 		TimeoutCount++;
 		if (TimeoutCount >= XDP_AUX_MAX_TIMEOUT_COUNT) {
 			return XST_ERROR_COUNT_MAX;
 		}
-	} while ((Status & XDP_TX_REPLY_STATUS_REQUEST_IN_PROGRESS_MASK) &&
-			(Status & XDP_TX_REPLY_STATUS_REPLY_IN_PROGRESS_MASK));
+		XDp_WaitUs(InstancePtr, 20);
+
+		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+							XDP_TX_REPLY_STATUS);
+	}
 
 	/* Set the address for the request. */
 	XDp_WriteReg(InstancePtr->Config.BaseAddr, XDP_TX_AUX_ADDRESS,
@@ -3101,16 +3206,18 @@ static u32 XDp_TxAuxRequestSend(XDp *InstancePtr, XDp_AuxTransaction *Request)
 
 		/* Wait until all data has been received. */
 		TimeoutCount = 0;
-		do {
-			Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
 						XDP_TX_REPLY_DATA_COUNT);
-
-			XDp_WaitUs(InstancePtr, 100);
+		while (Status != Request->NumBytes) {
 			TimeoutCount++;
 			if (TimeoutCount >= XDP_AUX_MAX_TIMEOUT_COUNT) {
 				return XST_ERROR_COUNT_MAX;
 			}
-		} while (Status != Request->NumBytes);
+			XDp_WaitUs(InstancePtr, 100);
+
+			Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+						XDP_TX_REPLY_DATA_COUNT);
+		}
 
 		/* Obtain the read data from the reply FIFO. */
 		for (Index = 0; Index < Request->NumBytes; Index++) {
@@ -3186,21 +3293,111 @@ static u32 XDp_TxAuxWaitReady(XDp *InstancePtr)
 	u32 Timeout = 100;
 
 	/* Wait until the DisplayPort TX core is ready. */
-	do {
-		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+	Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
 						XDP_TX_INTERRUPT_SIG_STATE);
-
+	while (Status & XDP_TX_REPLY_STATUS_REPLY_IN_PROGRESS_MASK) {
 		/* Protect against an infinite loop. */
 		if (!Timeout--) {
 			return XST_ERROR_COUNT_MAX;
 		}
 		XDp_WaitUs(InstancePtr, 20);
+
+		Status = XDp_ReadReg(InstancePtr->Config.BaseAddr,
+						XDP_TX_INTERRUPT_SIG_STATE);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function copies the requested bytes from the DisplayPort Configuration
+ * Data (DPCD) shadow if all of them are held by the shadow.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Address is the starting DPCD address to read from.
+ * @param	NumBytes is the number of bytes to read.
+ * @param	Data is a pointer to the data buffer that will be filled with
+ *		the shadowed values.
+ *
+ * @return
+ *		- XST_SUCCESS if the read was served from the shadow.
+ *		- XST_FAILURE if the shadow is disabled or does not hold all
+ *		  requested bytes.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxDpcdCacheRead(XDp *InstancePtr, u32 Address, u32 NumBytes,
+								u8 *Data)
+{
+	XDp_TxDpcdCache *Cache = &InstancePtr->TxInstance.DpcdCache;
+	u32 Index;
+
+	if (!Cache->Enabled || (NumBytes == 0) ||
+			((Address + NumBytes) > XDP_TX_DPCD_CACHE_SIZE)) {
+		return XST_FAILURE;
 	}
-	while (Status & XDP_TX_REPLY_STATUS_REPLY_IN_PROGRESS_MASK);
+
+	for (Index = Address; Index < (Address + NumBytes); Index++) {
+		if (!(Cache->Valid[Index / 32] & (1U << (Index % 32)))) {
+			Cache->Misses++;
+			return XST_FAILURE;
+		}
+	}
+
+	memcpy(Data, &Cache->Data[Address], NumBytes);
+	Cache->Hits++;
 
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function stores the values of the RX device's DisplayPort Configuration
+ * Data (DPCD) which have just been read or written into the DPCD shadow.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Address is the starting DPCD address of the values.
+ * @param	NumBytes is the number of bytes read or written.
+ * @param	Data is a pointer to the values.
+ * @param	Start is the lowest DPCD address to store. Bytes below Start are
+ *		skipped.
+ * @param	Generation is the value of the shadow's generation counter
+ *		sampled before the AUX transaction was started.
+ *
+ * @return	None.
+ *
+ * @note	Nothing is stored if the shadow was invalidated (e.g. by the HPD
+ *		interrupt) since Generation was sampled, as the values may
+ *		belong to the previously connected RX device.
+ *
+*******************************************************************************/
+static void XDp_TxDpcdCacheUpdate(XDp *InstancePtr, u32 Address,
+			u32 NumBytes, u8 *Data, u32 Start, u32 Generation)
+{
+	XDp_TxDpcdCache *Cache = &InstancePtr->TxInstance.DpcdCache;
+	u32 Index;
+
+	if (!Cache->Enabled || (Cache->Generation != Generation)) {
+		return;
+	}
+
+	for (Index = Address; (Index < (Address + NumBytes)) &&
+				(Index < XDP_TX_DPCD_CACHE_SIZE); Index++) {
+		if (Index >= Start) {
+			Cache->Data[Index] = Data[Index - Address];
+			Cache->Valid[Index / 32] |= (1U << (Index % 32));
+		}
+	}
+
+	/* An invalidation while the bytes were being stored may have been
+	 * overwritten by the valid bits set above. */
+	if (Cache->Generation != Generation) {
+		memset(Cache->Valid, 0, sizeof(Cache->Valid));
+	}
+}
+
 /******************************************************************************/
 /**
  * This function sets the clock frequency for the DisplayPort PHY corresponding
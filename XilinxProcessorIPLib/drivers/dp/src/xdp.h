@@ -348,6 +348,14 @@
  *                     Added callbacks for lane count changes, link rate changes
  *                     and pre-emphasis + voltage swing adjust requests.
  * 3.0   als  10/07/15 Added MSA callback.
+ *       ms   10/19/26 Added XDp_TxDpcdCache shadow of the receiver capability
+ *                     and link configuration fields of the DPCD. New APIs:
+ *                         XDp_TxDpcdCacheEnable, XDp_TxDpcdCacheInvalidate
+ *       ms   10/19/26 Added SbMsgMaxOutstanding to XDp_Tx to bound the number
+ *                     of sideband message requests in flight during topology
+ *                     discovery.
+ *       ms   10/19/26 Added a generation count to XDp_TxDpcdCache so that AUX
+ *                     reads which straddle an HPD event are not shadowed.
  * </pre>
  *
 *******************************************************************************/
@@ -364,6 +372,16 @@
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions ******************************/
+
+/* Size of the DPCD shadow, covering the receiver capability field and the
+ * link configuration field (DPCD addresses 0x00000 to 0x001FF). */
+#define XDP_TX_DPCD_CACHE_SIZE	0x200
+/* The maximum number of sideband message requests which may be awaiting a
+ * reply at once. Replies are matched to requests by the 1-bit message sequence
+ * number. */
+#define XDP_TX_SBMSG_MAX_OUTSTANDING	2
+
 /****************************** Type Definitions ******************************/
 
 /**
@@ -757,6 +775,35 @@ typedef void (*XDp_TimerHandler)(void *InstancePtr, u32 MicroSeconds);
 *******************************************************************************/
 typedef void (*XDp_IntrHandler)(void *InstancePtr);
 
+/**
+ * This typedef contains a shadow copy of the RX device's DisplayPort
+ * Configuration Data (DPCD) receiver capability and link configuration fields.
+ * The receiver capability field only changes across a hot-plug-detect (HPD)
+ * event or pulse and the link configuration field is only written by the TX,
+ * so reads of these fields are served from the shadow until the next HPD
+ * interrupt invalidates it.
+ */
+typedef struct {
+	u8 Enabled;				/**< Serve DPCD reads from the
+							shadow. */
+	u8 Data[XDP_TX_DPCD_CACHE_SIZE];	/**< Shadowed DPCD bytes. */
+	u32 Valid[XDP_TX_DPCD_CACHE_SIZE / 32];	/**< Bitmap of the bytes in
+							Data which hold the RX
+							device's values. */
+	u32 Hits;				/**< Number of AUX reads served
+							from the shadow. */
+	u32 Misses;				/**< Number of AUX reads of the
+							shadowed fields which
+							were sent to the RX
+							device. */
+	volatile u32 Generation;		/**< Incremented on each
+							invalidation so that
+							values from an AUX
+							transaction which
+							straddles an HPD event
+							are not stored. */
+} XDp_TxDpcdCache;
+
 /**
  * The XDp driver instance data representing the TX mode of operation.
  */
@@ -801,6 +848,20 @@ typedef struct {
 							sideband messages for
 							multi-stream transport
 							(MST) mode. */
+	u8 SbMsgMaxOutstanding;			/**< Number of LINK_ADDRESS
+							sideband messages sent
+							before waiting for their
+							replies during topology
+							discovery. Must not
+							exceed the maximum of 2
+							outstanding messages.
+							Set to 1 to query one
+							branch device at a
+							time. */
+	XDp_TxDpcdCache DpcdCache;		/**< Shadow of the RX device's
+							receiver capability and
+							link configuration
+							fields. */
 	XDp_IntrHandler TxSetMsaCallback;	/**< Callback function for
 							setting the TX MSA. */
 	void *TxMsaCallbackRef;			/**< A pointer to the user data
@@ -1092,6 +1153,8 @@ u32 XDp_TxIicRead(XDp *InstancePtr, u8 IicAddress, u16 Offset,
 					u16 BytesToRead, void *ReadData);
 u32 XDp_TxIicWrite(XDp *InstancePtr, u8 IicAddress, u8 BytesToWrite,
 							void *WriteData);
+void XDp_TxDpcdCacheEnable(XDp *InstancePtr, u8 Enable);
+void XDp_TxDpcdCacheInvalidate(XDp *InstancePtr);
 
 /* xdp.c: TX functions for controlling the link configuration. */
 u32 XDp_TxSetDownspread(XDp *InstancePtr, u8 Enable);
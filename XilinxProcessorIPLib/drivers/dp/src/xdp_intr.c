@@ -50,6 +50,7 @@
  *                     Guard against uninitialized callbacks.
  *                     Added HDCP interrupts.
  *                     Added unplug interrupt.
+ * 3.0   ms   10/19/26 Invalidate the TX DPCD shadow on HPD events and pulses.
  * </pre>
  *
 *******************************************************************************/
@@ -1024,6 +1025,12 @@ static void XDp_TxInterruptHandler(XDp *InstancePtr)
 	HpdPulseDetected = IntrStatus &
 				XDP_TX_INTERRUPT_STATUS_HPD_PULSE_DETECTED_MASK;
 
+	/* The RX device may have been replaced or its capabilities may have
+	 * changed. */
+	if (HpdEventDetected || HpdPulseDetected) {
+		XDp_TxDpcdCacheInvalidate(InstancePtr);
+	}
+
 	if (HpdEventDetected && InstancePtr->TxInstance.HpdEventHandler) {
 		InstancePtr->TxInstance.HpdEventHandler(
 				InstancePtr->TxInstance.HpdEventCallbackRef);
@@ -43,6 +43,12 @@
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  01/20/15 Initial release. TX code merged from the dptx driver.
  * 2.0   als  06/08/15 Added MST functionality to RX.
+ * 3.0   ms   10/19/26 Topology discovery sends LINK_ADDRESS to up to
+ *                     SbMsgMaxOutstanding branch devices before collecting
+ *                     the replies, which are matched by sequence number.
+ *                     Sideband replies are read by fragment length and polled
+ *                     without a fixed 1 ms wait. Table-driven CRC4 and CRC8.
+ *                     Fixed the sink GUID copy from the LINK_ADDRESS reply.
  * </pre>
  *
 *******************************************************************************/
@@ -57,9 +63,18 @@
 /* The maximum length of a sideband message. Longer messages must be split into
  * multiple fragments. */
 #define XDP_MAX_LENGTH_SBMSG 48
-/* Error out if waiting for a sideband message reply or waiting for the payload
- * ID table to be updated takes more than 5000 AUX read iterations. */
-#define XDP_TX_MAX_SBMSG_REPLY_TIMEOUT_COUNT 5000
+/* Error out if waiting for a sideband message reply takes more than 50000 AUX
+ * read iterations (5 seconds worth of polling intervals). */
+#define XDP_TX_MAX_SBMSG_REPLY_TIMEOUT_COUNT 50000
+/* The time in microseconds between reads of the DOWN_REP_MSG_RDY bit while
+ * waiting for a sideband message reply. */
+#define XDP_TX_SBMSG_REPLY_POLL_US 100
+/* The number of bytes of a sideband message reply fragment read before its
+ * length is known. This covers the longest header and a full AUX transaction. */
+#define XDP_TX_SBMSG_REPLY_HEAD_NBYTES 16
+/* The maximum number of branch devices waiting to be sent a LINK_ADDRESS
+ * sideband message during topology discovery. */
+#define XDP_TX_TOPOLOGY_QUEUE_SIZE 63
 /* Error out if waiting for the RX device to indicate that it has received an
  * ACT trigger takes more than 30 AUX read iterations. */
 #define XDP_TX_VCP_TABLE_MAX_TIMEOUT_COUNT 30
@@ -169,21 +184,29 @@ static void XDp_TxAddBranchToList(XDp *InstancePtr,
 static void XDp_TxAddSinkToList(XDp *InstancePtr,
 			XDp_SbMsgLinkAddressReplyPortDetail *SinkDevice,
 			u8 LinkCountTotal, u8 *RelativeAddress);
+static u8 XDp_TxSinkPrecedes(XDp_TxTopologyNode *Sink0,
+					XDp_TxTopologyNode *Sink1);
+static void XDp_TxSortSinksDepthFirst(XDp *InstancePtr, u8 SinkStart);
 static void XDp_TxGetDeviceInfoFromSbMsgLinkAddress(
 			XDp_SidebandReply *SbReply,
 			XDp_SbMsgLinkAddressReplyDeviceInfo *FormatReply);
 static u32 XDp_TxGetFirstAvailableTs(XDp *InstancePtr, u8 *FirstTs);
 static u32 XDp_TxSendActTrigger(XDp *InstancePtr);
+static u32 XDp_TxIssueSbMsgLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
+					u8 *RelativeAddress, u8 SeqNum);
 static u32 XDp_SendSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
+static u32 XDp_WriteSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 static void XDp_RxReadDownReq(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply);
+static u32 XDp_TxReceiveSbMsgReplies(XDp *InstancePtr, u8 Pending,
+				u8 *Received, XDp_SidebandReply *SbReplies);
+static u32 XDp_TxReceiveSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 static u32 XDp_TxWaitSbReply(XDp *InstancePtr);
 static u32 XDp_Transaction2MsgFormat(u8 *Transaction, XDp_SidebandMsg *Msg);
 static u32 XDp_RxWriteRawDownReply(XDp *InstancePtr, u8 *Data, u8 DataLength);
 static u32 XDp_RxSendSbMsg(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 static u8 XDp_Crc4CalculateHeader(XDp_SidebandMsgHeader *Header);
 static u8 XDp_Crc8CalculateBody(XDp_SidebandMsg *Msg);
-static u8 XDp_CrcCalculate(const u8 *Data, u32 NumberOfBits, u8 Polynomial);
 static u32 XDp_TxIsSameTileDisplay(u8 *DispIdSecTile0, u8 *DispIdSecTile1);
 
 /**************************** Variable Definitions ****************************/
@@ -228,6 +251,56 @@ u8 GuidTable[16][XDP_GUID_NBYTES] = {
 				0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33}
 };
 
+/**
+ * This table contains the sideband message header CRC (generator polynomial
+ * x^4 + x + 1) of each nibble value. It is indexed by the running CRC XOR'ed
+ * with the next nibble of the header.
+ */
+static const u8 XDp_Crc4Table[16] = {
+	0x0, 0x3, 0x6, 0x5, 0xC, 0xF, 0xA, 0x9,
+	0xB, 0x8, 0xD, 0xE, 0x7, 0x4, 0x1, 0x2
+};
+
+/**
+ * This table contains the sideband message body CRC (generator polynomial
+ * x^8 + x^7 + x^6 + x^4 + x^2 + 1) of each byte value. It is indexed by the
+ * running CRC XOR'ed with the next byte of the body.
+ */
+static const u8 XDp_Crc8Table[256] = {
+	0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54,
+	0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D,
+	0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06,
+	0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F,
+	0xA4, 0x71, 0xDB, 0x0E, 0x5A, 0x8F, 0x25, 0xF0,
+	0x8D, 0x58, 0xF2, 0x27, 0x73, 0xA6, 0x0C, 0xD9,
+	0xF6, 0x23, 0x89, 0x5C, 0x08, 0xDD, 0x77, 0xA2,
+	0xDF, 0x0A, 0xA0, 0x75, 0x21, 0xF4, 0x5E, 0x8B,
+	0x9D, 0x48, 0xE2, 0x37, 0x63, 0xB6, 0x1C, 0xC9,
+	0xB4, 0x61, 0xCB, 0x1E, 0x4A, 0x9F, 0x35, 0xE0,
+	0xCF, 0x1A, 0xB0, 0x65, 0x31, 0xE4, 0x4E, 0x9B,
+	0xE6, 0x33, 0x99, 0x4C, 0x18, 0xCD, 0x67, 0xB2,
+	0x39, 0xEC, 0x46, 0x93, 0xC7, 0x12, 0xB8, 0x6D,
+	0x10, 0xC5, 0x6F, 0xBA, 0xEE, 0x3B, 0x91, 0x44,
+	0x6B, 0xBE, 0x14, 0xC1, 0x95, 0x40, 0xEA, 0x3F,
+	0x42, 0x97, 0x3D, 0xE8, 0xBC, 0x69, 0xC3, 0x16,
+	0xEF, 0x3A, 0x90, 0x45, 0x11, 0xC4, 0x6E, 0xBB,
+	0xC6, 0x13, 0xB9, 0x6C, 0x38, 0xED, 0x47, 0x92,
+	0xBD, 0x68, 0xC2, 0x17, 0x43, 0x96, 0x3C, 0xE9,
+	0x94, 0x41, 0xEB, 0x3E, 0x6A, 0xBF, 0x15, 0xC0,
+	0x4B, 0x9E, 0x34, 0xE1, 0xB5, 0x60, 0xCA, 0x1F,
+	0x62, 0xB7, 0x1D, 0xC8, 0x9C, 0x49, 0xE3, 0x36,
+	0x19, 0xCC, 0x66, 0xB3, 0xE7, 0x32, 0x98, 0x4D,
+	0x30, 0xE5, 0x4F, 0x9A, 0xCE, 0x1B, 0xB1, 0x64,
+	0x72, 0xA7, 0x0D, 0xD8, 0x8C, 0x59, 0xF3, 0x26,
+	0x5B, 0x8E, 0x24, 0xF1, 0xA5, 0x70, 0xDA, 0x0F,
+	0x20, 0xF5, 0x5F, 0x8A, 0xDE, 0x0B, 0xA1, 0x74,
+	0x09, 0xDC, 0x76, 0xA3, 0xF7, 0x22, 0x88, 0x5D,
+	0xD6, 0x03, 0xA9, 0x7C, 0x28, 0xFD, 0x57, 0x82,
+	0xFF, 0x2A, 0x80, 0x55, 0x01, 0xD4, 0x7E, 0xAB,
+	0x84, 0x51, 0xFB, 0x2E, 0x7A, 0xAF, 0x05, 0xD0,
+	0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9
+};
+
 /**************************** Function Definitions ****************************/
 
 /******************************************************************************/
@@ -638,20 +711,23 @@ u32 XDp_TxDiscoverTopology(XDp *InstancePtr)
 /**
  * This function will explore the DisplayPort topology of downstream devices
  * starting from the branch device specified by the LinkCountTotal and
- * RelativeAddress parameters. It will recursively go through each branch
- * device, obtain its information by sending a LINK_ADDRESS sideband message,
- * and add this information to the the topology's node table. For each sink
- * device connected to a branch's downstream port, this function will obtain
- * the details of the sink, add it to the topology's node table, as well as
- * add it to the topology's sink list.
+ * RelativeAddress parameters. It will go through each branch device, obtain
+ * its information by sending a LINK_ADDRESS sideband message, and add this
+ * information to the the topology's node table. For each sink device connected
+ * to a branch's downstream port, this function will obtain the details of the
+ * sink, add it to the topology's node table, as well as add it to the
+ * topology's sink list.
+ *
+ * Branch devices are explored breadth first. Up to SbMsgMaxOutstanding
+ * LINK_ADDRESS sideband messages, each with its own sequence number, are sent
+ * before the replies are collected, so that branch devices at the same depth
+ * are queried concurrently.
  *
  * @param	InstancePtr is a pointer to the XDp instance.
  * @param	LinkCountTotal is the total DisplayPort links connecting the
- *		DisplayPort TX to the current downstream device in the
- *		recursion.
+ *		DisplayPort TX to the branch device to start from.
  * @param	RelativeAddress is the relative address from the DisplayPort
- *		source to the current target DisplayPort device in the
- *		recursion.
+ *		source to the branch device to start from.
  *
  * @return
  *		- XST_SUCCESS if the topology discovery is successful.
@@ -659,19 +735,33 @@ u32 XDp_TxDiscoverTopology(XDp *InstancePtr)
  *		  message to one of the branch devices in the topology failed.
  *
  * @note	The contents of the InstancePtr->TxInstance.Topology structure
- *		will be modified.
+ *		will be modified. The sinks found are ordered in the sink list
+ *		depth first, with the sinks of a branch device preceding the
+ *		devices downstream of its branch devices.
  *
 *******************************************************************************/
 u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 							u8 *RelativeAddress)
 {
-	u32 Status;
 	u8 Index;
-	u8 NumDownBranches = 0;
+	u8 Slot;
+	u8 NumSlots;
+	u8 MaxOutstanding;
+	u8 Pending;
+	u8 Received;
+	u8 SinkStart;
+	u8 QueueHead = 0;
+	u8 QueueTail = 0;
 	u8 OverallFailures = 0;
+	u8 *Rad;
 	XDp_TxTopology *Topology;
 	XDp_SbMsgLinkAddressReplyPortDetail *PortDetails;
+	u8 SlotLct[XDP_TX_SBMSG_MAX_OUTSTANDING];
+	u8 SlotRad[XDP_TX_SBMSG_MAX_OUTSTANDING][15];
+	static XDp_SidebandReply SbReplies[XDP_TX_SBMSG_MAX_OUTSTANDING];
 	static XDp_SbMsgLinkAddressReplyDeviceInfo DeviceInfo;
+	static u8 QueueLct[XDP_TX_TOPOLOGY_QUEUE_SIZE];
+	static u8 QueueRad[XDP_TX_TOPOLOGY_QUEUE_SIZE][15];
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -681,79 +771,122 @@ u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
 
 	Topology = &InstancePtr->TxInstance.Topology;
+	SinkStart = Topology->SinkTotal;
 
-	/* Send a LINK_ADDRESS sideband message to the branch device in order to
-	 * obtain information on it and its downstream devices. */
-	Status = XDp_TxSendSbMsgLinkAddress(InstancePtr, LinkCountTotal,
-						RelativeAddress, &DeviceInfo);
-	if (Status != XST_SUCCESS) {
-		/* The LINK_ADDRESS was sent to a device that cannot reply; exit
-		 * from this recursion path. */
-		return XST_FAILURE;
+	MaxOutstanding = InstancePtr->TxInstance.SbMsgMaxOutstanding;
+	if (MaxOutstanding == 0) {
+		MaxOutstanding = 1;
+	}
+	else if (MaxOutstanding > XDP_TX_SBMSG_MAX_OUTSTANDING) {
+		MaxOutstanding = XDP_TX_SBMSG_MAX_OUTSTANDING;
+	}
+
+	/* Start from the specified branch device. */
+	QueueLct[QueueTail] = LinkCountTotal;
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		QueueRad[QueueTail][Index] = RelativeAddress[Index];
 	}
+	QueueTail++;
+
+	while (QueueHead < QueueTail) {
+		/* Send a LINK_ADDRESS sideband message to each of the next
+		 * branch devices in the queue, using the reply slot as the
+		 * sequence number, without waiting for the replies. */
+		Pending = 0;
+		for (NumSlots = 0; (NumSlots < MaxOutstanding) &&
+				(QueueHead < QueueTail); NumSlots++) {
+			SlotLct[NumSlots] = QueueLct[QueueHead];
+			memcpy(SlotRad[NumSlots], QueueRad[QueueHead], 15);
+			QueueHead++;
+
+			if (XDp_TxIssueSbMsgLinkAddress(InstancePtr,
+					SlotLct[NumSlots], SlotRad[NumSlots],
+					NumSlots) == XST_SUCCESS) {
+				Pending |= (1 << NumSlots);
+			}
+		}
+
+		/* Collect the replies. If this fails, the replies which have
+		 * not been received are treated as failures below. */
+		XDp_TxReceiveSbMsgReplies(InstancePtr, Pending, &Received,
+								SbReplies);
+
+		for (Slot = 0; Slot < NumSlots; Slot++) {
+			if (((Received & (1 << Slot)) == 0) ||
+				((SbReplies[Slot].Data[0] & 0x80) == 0x80)) {
+				/* The LINK_ADDRESS was sent to a device that
+				 * cannot reply or the reply was a NACK; don't
+				 * explore downstream of it. */
+				OverallFailures++;
+				continue;
+			}
+			XDp_TxGetDeviceInfoFromSbMsgLinkAddress(
+						&SbReplies[Slot], &DeviceInfo);
+
+			LinkCountTotal = SlotLct[Slot];
+			Rad = SlotRad[Slot];
 
-	/* Write GUID to the branch device if it doesn't already have one. */
-	XDp_TxIssueGuid(InstancePtr, LinkCountTotal, RelativeAddress, Topology,
-							DeviceInfo.Guid);
+			/* Write GUID to the branch device if it doesn't
+			 * already have one. */
+			XDp_TxIssueGuid(InstancePtr, LinkCountTotal, Rad,
+						Topology, DeviceInfo.Guid);
 
-	/* Add the branch device to the topology table. */
-	XDp_TxAddBranchToList(InstancePtr, &DeviceInfo, LinkCountTotal,
-							RelativeAddress);
+			/* Add the branch device to the topology table. */
+			XDp_TxAddBranchToList(InstancePtr, &DeviceInfo,
+							LinkCountTotal, Rad);
 
-	/* Downstream devices will be an extra link away from the source than
-	 * this branch device. */
-	LinkCountTotal++;
+			/* Downstream devices will be an extra link away from
+			 * the source than this branch device. */
+			LinkCountTotal++;
 
-	u8 DownBranchesDownPorts[DeviceInfo.NumPorts];
-	for (Index = 0; Index < DeviceInfo.NumPorts; Index++) {
-		PortDetails = &DeviceInfo.PortDetails[Index];
-		/* Any downstream device downstream device will have the RAD of
-		 * the current branch device appended with the port number. */
-		RelativeAddress[LinkCountTotal - 2] = PortDetails->PortNum;
+			for (Index = 0; Index < DeviceInfo.NumPorts; Index++) {
+				PortDetails = &DeviceInfo.PortDetails[Index];
+				/* Any downstream device will have the RAD of
+				 * the current branch device appended with the
+				 * port number. */
+				Rad[LinkCountTotal - 2] = PortDetails->PortNum;
 
-		if ((PortDetails->InputPort == 0) &&
+				if ((PortDetails->InputPort == 0) &&
 					(PortDetails->PeerDeviceType != 0x2) &&
 					(PortDetails->DpDevPlugStatus == 1)) {
 
-			if ((PortDetails->MsgCapStatus == 1) &&
+					if ((PortDetails->MsgCapStatus == 1) &&
 					(PortDetails->DpcdRev >= 0x12)) {
-				/* Write GUID to the branch device if it
-				 * doesn't already have one. */
-				XDp_TxIssueGuid(InstancePtr,
-					LinkCountTotal, RelativeAddress,
-					Topology, PortDetails->Guid);
+						/* Write GUID to the sink device
+						 * if it doesn't already have
+						 * one. */
+						XDp_TxIssueGuid(InstancePtr,
+							LinkCountTotal, Rad,
+							Topology,
+							PortDetails->Guid);
+					}
+
+					XDp_TxAddSinkToList(InstancePtr,
+						PortDetails, LinkCountTotal,
+						Rad);
+				}
+
+				if (PortDetails->PeerDeviceType != 0x2) {
+					continue;
+				}
+
+				/* Found a branch device; queue it to be
+				 * explored with the appended RAD. */
+				if (QueueTail == XDP_TX_TOPOLOGY_QUEUE_SIZE) {
+					OverallFailures++;
+					continue;
+				}
+				QueueLct[QueueTail] = LinkCountTotal;
+				memcpy(QueueRad[QueueTail], Rad,
+							LinkCountTotal - 1);
+				QueueTail++;
 			}
-
-			XDp_TxAddSinkToList(InstancePtr, PortDetails,
-					LinkCountTotal,
-					RelativeAddress);
-		}
-
-		if (PortDetails->PeerDeviceType == 0x2) {
-			DownBranchesDownPorts[NumDownBranches] =
-							PortDetails->PortNum;
-			NumDownBranches++;
 		}
 	}
 
-	for (Index = 0; Index < NumDownBranches; Index++) {
-		/* Any downstream device downstream device will have the RAD of
-		 * the current branch device appended with the port number. */
-		RelativeAddress[LinkCountTotal - 2] =
-						DownBranchesDownPorts[Index];
-
-		/* Found a branch device; recurse the algorithm to see what
-		 * DisplayPort devices are connected to it with the appended
-		 * RAD. */
-		Status = XDp_TxFindAccessibleDpDevices(InstancePtr,
-					LinkCountTotal, RelativeAddress);
-		if (Status != XST_SUCCESS) {
-			/* Keep trying to discover the topology, but the top
-			 * level function call should indicate that a failure
-			 * was detected. */
-			OverallFailures++;
-		}
-	}
+	/* Present the sinks in the order a depth first exploration finds
+	 * them. */
+	XDp_TxSortSinksDepthFirst(InstancePtr, SinkStart);
 
 	if (OverallFailures != 0) {
 		return XST_FAILURE;
@@ -1933,9 +2066,7 @@ u32 XDp_TxSendSbMsgLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
 	u8 *RelativeAddress, XDp_SbMsgLinkAddressReplyDeviceInfo *DeviceInfo)
 {
 	u32 Status;
-	XDp_SidebandMsg Msg;
 	XDp_SidebandReply SbMsgReply;
-	u8 Index;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1945,29 +2076,9 @@ u32 XDp_TxSendSbMsgLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
 	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
 	Xil_AssertNonvoid(DeviceInfo != NULL);
 
-	Msg.FragmentNum = 0;
-
-	/* Prepare the sideband message header. */
-	Msg.Header.LinkCountTotal = LinkCountTotal;
-	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
-		Msg.Header.RelativeAddress[Index] = RelativeAddress[Index];
-	}
-	Msg.Header.LinkCountRemaining = Msg.Header.LinkCountTotal - 1;
-	Msg.Header.BroadcastMsg = 0;
-	Msg.Header.PathMsg = 0;
-	Msg.Header.MsgBodyLength = 2;
-	Msg.Header.StartOfMsgTransaction = 1;
-	Msg.Header.EndOfMsgTransaction = 1;
-	Msg.Header.MsgSequenceNum = 0;
-	Msg.Header.Crc = XDp_Crc4CalculateHeader(&Msg.Header);
-
-	/* Prepare the sideband message body. */
-	Msg.Body.MsgData[0] = XDP_SBMSG_LINK_ADDRESS;
-	Msg.Body.MsgDataLength = Msg.Header.MsgBodyLength - 1;
-	Msg.Body.Crc = XDp_Crc8CalculateBody(&Msg);
-
 	/* Submit the LINK_ADDRESS transaction message request. */
-	Status = XDp_SendSbMsgFragment(InstancePtr, &Msg);
+	Status = XDp_TxIssueSbMsgLinkAddress(InstancePtr, LinkCountTotal,
+							RelativeAddress, 0);
 	if (Status != XST_SUCCESS) {
 		/* The AUX write transaction used to send the sideband message
 		 * failed. */
@@ -3327,6 +3438,86 @@ static void XDp_TxAddSinkToList(XDp *InstancePtr,
 	Topology->SinkTotal++;
 }
 
+/******************************************************************************/
+/**
+ * This function determines whether or not a sink device is found before
+ * another by a depth first exploration of the topology, which visits the sinks
+ * of a branch device before the devices downstream of its branch devices, each
+ * in port number order.
+ *
+ * @param	Sink0 is a pointer to the topology node of one sink device.
+ * @param	Sink1 is a pointer to the topology node of the other sink
+ *		device.
+ *
+ * @return
+ *		- 1 if Sink0 precedes Sink1.
+ *		- 0 otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxSinkPrecedes(XDp_TxTopologyNode *Sink0,
+					XDp_TxTopologyNode *Sink1)
+{
+	u8 Index = 0;
+	u8 PortIndex0 = Sink0->LinkCountTotal - 2;
+	u8 PortIndex1 = Sink1->LinkCountTotal - 2;
+
+	/* Skip the branch devices which both sinks are downstream of. */
+	while ((Index < PortIndex0) && (Index < PortIndex1) &&
+				(Sink0->RelativeAddress[Index] ==
+				Sink1->RelativeAddress[Index])) {
+		Index++;
+	}
+
+	/* A sink connected to the branch device where the paths diverge
+	 * precedes a sink further downstream. */
+	if ((Index == PortIndex0) && (Index != PortIndex1)) {
+		return 1;
+	}
+	if ((Index != PortIndex0) && (Index == PortIndex1)) {
+		return 0;
+	}
+
+	return (Sink0->RelativeAddress[Index] < Sink1->RelativeAddress[Index]);
+}
+
+/******************************************************************************/
+/**
+ * This function sorts the sinks added to the topology's sink list by topology
+ * discovery into depth first order.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	SinkStart is the index of the first sink in the sink list added
+ *		by the discovery.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxSortSinksDepthFirst(XDp *InstancePtr, u8 SinkStart)
+{
+	u8 Index;
+	u8 Index2;
+	XDp_TxTopology *Topology = &InstancePtr->TxInstance.Topology;
+	XDp_TxTopologyNode *Sink;
+
+	/* Insertion sort; the list is short and mostly in order already. */
+	for (Index = SinkStart + 1; Index < Topology->SinkTotal; Index++) {
+		Sink = Topology->SinkList[Index];
+
+		for (Index2 = Index; (Index2 > SinkStart) &&
+				XDp_TxSinkPrecedes(Sink,
+					Topology->SinkList[Index2 - 1]);
+								Index2--) {
+			Topology->SinkList[Index2] =
+					Topology->SinkList[Index2 - 1];
+		}
+		Topology->SinkList[Index2] = Sink;
+	}
+}
+
 /******************************************************************************/
 /**
  * This function will fill in a device information structure from data obtained
@@ -3379,7 +3570,7 @@ static void XDp_TxGetDeviceInfoFromSbMsgLinkAddress(XDp_SidebandReply
 
 			memset(PortDetails->Guid, 0, XDP_GUID_NBYTES);
 			for (Index2 = 0; Index2 < XDP_GUID_NBYTES; Index2++) {
-				PortDetails->Guid[Index] =
+				PortDetails->Guid[Index2] =
 						SbReply->Data[ReplyIndex++];
 			}
 
@@ -3500,6 +3691,67 @@ static u32 XDp_TxSendActTrigger(XDp *InstancePtr)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function will send a LINK_ADDRESS sideband message to a target
+ * DisplayPort branch device without waiting for the reply.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the number of DisplayPort links from the
+ *		DisplayPort source to the target DisplayPort branch device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the target DisplayPort branch device.
+ * @param	SeqNum is the message sequence number which the reply will
+ *		carry.
+ *
+ * @return
+ *		- XST_SUCCESS if the write transaction used to transmit the
+ *		  sideband message was successful.
+ *		- XST_DEVICE_NOT_FOUND if no device is connected.
+ *		- XST_ERROR_COUNT_MAX if the request timed out.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	A sequence number of 0 must only be used when no other
+ *		sideband message is outstanding, since a stale DOWN_REP_MSG_RDY
+ *		is cleared before the message is sent.
+ *
+*******************************************************************************/
+static u32 XDp_TxIssueSbMsgLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
+					u8 *RelativeAddress, u8 SeqNum)
+{
+	XDp_SidebandMsg Msg;
+	u8 Index;
+
+	Msg.FragmentNum = 0;
+
+	/* Prepare the sideband message header. */
+	Msg.Header.LinkCountTotal = LinkCountTotal;
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		Msg.Header.RelativeAddress[Index] = RelativeAddress[Index];
+	}
+	Msg.Header.LinkCountRemaining = Msg.Header.LinkCountTotal - 1;
+	Msg.Header.BroadcastMsg = 0;
+	Msg.Header.PathMsg = 0;
+	Msg.Header.MsgBodyLength = 2;
+	Msg.Header.StartOfMsgTransaction = 1;
+	Msg.Header.EndOfMsgTransaction = 1;
+	Msg.Header.MsgSequenceNum = SeqNum;
+	Msg.Header.Crc = XDp_Crc4CalculateHeader(&Msg.Header);
+
+	/* Prepare the sideband message body. */
+	Msg.Body.MsgData[0] = XDP_SBMSG_LINK_ADDRESS;
+	Msg.Body.MsgDataLength = Msg.Header.MsgBodyLength - 1;
+	Msg.Body.Crc = XDp_Crc8CalculateBody(&Msg);
+
+	if (SeqNum == 0) {
+		return XDp_SendSbMsgFragment(InstancePtr, &Msg);
+	}
+
+	/* Clearing DOWN_REP_MSG_RDY now would drop the reply to the message
+	 * which is already outstanding. */
+	return XDp_WriteSbMsgFragment(InstancePtr, &Msg);
+}
+
 /******************************************************************************/
 /**
  * Operating in TX mode, this function will send a sideband message by creating
@@ -3524,26 +3776,55 @@ static u32 XDp_TxSendActTrigger(XDp *InstancePtr)
 static u32 XDp_SendSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg)
 {
 	u32 Status;
-	u8 Data[XDP_MAX_LENGTH_SBMSG];
-	XDp_SidebandMsgHeader *Header = &Msg->Header;
-	XDp_SidebandMsgBody *Body = &Msg->Body;
-	u8 FragmentOffset;
-	u8 Index;
-
-	XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
+	u8 AuxData;
 
 	if (XDp_GetCoreType(InstancePtr) == XDP_TX) {
 		/* First, clear the DOWN_REP_MSG_RDY in case the RX device is in
 		 * a weird state. */
-		Data[0] = 0x10;
+		AuxData = 0x10;
 		Status = XDp_TxAuxWrite(InstancePtr,
 				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0, 1,
-				Data);
+				&AuxData);
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
 	}
 
+	return XDp_WriteSbMsgFragment(InstancePtr, Msg);
+}
+
+/******************************************************************************/
+/**
+ * This function will create a data array from the supplied sideband message
+ * structure and write it as a down request in TX mode, or as a down reply in
+ * RX mode.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Msg is a pointer to the sideband message structure that holds
+ *		the contents of the data to be submitted.
+ *
+ * @return
+ *		- XST_SUCCESS if the write transaction used to transmit the
+ *		  sideband message was successful.
+ *		- XST_DEVICE_NOT_FOUND if no device is connected.
+ *		- XST_ERROR_COUNT_MAX if the request timed out.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	Unlike XDp_SendSbMsgFragment, the DOWN_REP_MSG_RDY bit is left
+ *		untouched.
+ *
+*******************************************************************************/
+static u32 XDp_WriteSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg)
+{
+	u32 Status;
+	u8 Data[XDP_MAX_LENGTH_SBMSG];
+	XDp_SidebandMsgHeader *Header = &Msg->Header;
+	XDp_SidebandMsgBody *Body = &Msg->Body;
+	u8 FragmentOffset;
+	u8 Index;
+
+	XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
+
 	/* Add the header to the sideband message transaction. */
 	Msg->Header.MsgHeaderLength = 0;
 	Data[Msg->Header.MsgHeaderLength++] =
@@ -3646,62 +3927,189 @@ static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply)
 {
 	u32 Status;
 	u8 Index = 0;
-	u8 AuxData[80];
 	XDp_SidebandMsg Msg;
 
-	Msg.FragmentNum = 0;
 	SbReply->Length = 0;
 
 	do {
-		XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
-
-		/* Wait for a reply. */
-		Status = XDp_TxWaitSbReply(InstancePtr);
+		Status = XDp_TxReceiveSbMsgFragment(InstancePtr, &Msg);
 		if (Status != XST_SUCCESS) {
+			/* Either an AUX read or write transaction failed, there
+			 * was a time out waiting for a reply, or a CRC check
+			 * failed. */
 			return Status;
 		}
 
-		/* Receive reply. */
-		Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_DOWN_REP, 80,
-								AuxData);
+		/* Collect body data into an array. */
+		for (Index = 0; Index < Msg.Body.MsgDataLength; Index++) {
+			SbReply->Data[SbReply->Length++] =
+							Msg.Body.MsgData[Index];
+		}
+	}
+	while (Msg.Header.EndOfMsgTransaction == 0);
+
+	/* Check if the reply indicates a NACK. */
+	if ((SbReply->Data[0] & 0x80) == 0x80) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will wait for the replies to several outstanding sideband
+ * messages. The fragments of each reply are collected into the reply structure
+ * indexed by the message sequence number of the reply, so replies may arrive
+ * in any order and interleaved.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Pending is a bit mask of the message sequence numbers of the
+ *		outstanding sideband messages.
+ * @param	Received is a pointer to a bit mask that this function will set
+ *		to the message sequence numbers whose reply was fully received.
+ * @param	SbReplies is a pointer to an array of reply structures, one
+ *		per message sequence number, that this function will fill in.
+ *
+ * @return
+ *		- XST_SUCCESS if all replies were received. Whether each one
+ *		  indicates an acknowledge is left to the caller.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, or an AUX
+ *		  request timed out.
+ *		- XST_FAILURE otherwise - if an AUX read or write transaction
+ *		  failed, or the header or body CRC did not match the
+ *		  calculated value.
+ *
+ * @note	Fragments with a sequence number which is not pending are
+ *		dropped.
+ *
+*******************************************************************************/
+static u32 XDp_TxReceiveSbMsgReplies(XDp *InstancePtr, u8 Pending,
+				u8 *Received, XDp_SidebandReply *SbReplies)
+{
+	u32 Status;
+	u8 Index;
+	XDp_SidebandMsg Msg;
+	XDp_SidebandReply *SbReply;
+
+	*Received = 0;
+
+	while ((*Received & Pending) != Pending) {
+		Status = XDp_TxReceiveSbMsgFragment(InstancePtr, &Msg);
 		if (Status != XST_SUCCESS) {
-			/* The AUX read transaction failed. */
 			return Status;
 		}
 
-		/* Convert the reply transaction into XDp_SidebandReply
-		 * format. */
-		Status = XDp_Transaction2MsgFormat(AuxData, &Msg);
-		if (Status != XST_SUCCESS) {
-			/* The CRC of the header or the body did not match the
-			 * calculated value. */
-			return XST_FAILURE;
+		if (((Pending & ~(*Received)) &
+				(1 << Msg.Header.MsgSequenceNum)) == 0) {
+			/* Not a reply to an outstanding message. */
+			continue;
 		}
+		SbReply = &SbReplies[Msg.Header.MsgSequenceNum];
 
-		/* Collect body data into an array. */
+		if (Msg.Header.StartOfMsgTransaction == 1) {
+			SbReply->Length = 0;
+		}
+
+		/* Collect body data into the reply's array. */
 		for (Index = 0; Index < Msg.Body.MsgDataLength; Index++) {
 			SbReply->Data[SbReply->Length++] =
 							Msg.Body.MsgData[Index];
 		}
 
-		/* Clear. */
-		AuxData[0] = 0x10;
-		Status = XDp_TxAuxWrite(InstancePtr,
-				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
-				1, AuxData);
+		if (Msg.Header.EndOfMsgTransaction == 1) {
+			*Received |= (1 << Msg.Header.MsgSequenceNum);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will wait for a sideband message reply fragment, read it and
+ * acknowledge it to the RX device so that the next fragment can be sent.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Msg is a pointer to the sideband message structure that this
+ *		function will fill in with the reply fragment.
+ *
+ * @return
+ *		- XST_SUCCESS if a fragment was successfully obtained.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, or an AUX
+ *		  request timed out.
+ *		- XST_FAILURE otherwise - if an AUX read or write transaction
+ *		  failed, or the header is malformed or the header or body CRC
+ *		  did not match the calculated value.
+ *
+ * @note	Only the bytes of the fragment are read from the DOWN_REP
+ *		buffer: the header, which gives the body length, is read first
+ *		and the remainder only if the fragment does not fit in that
+ *		first read.
+ *
+*******************************************************************************/
+static u32 XDp_TxReceiveSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg)
+{
+	u32 Status;
+	u8 HeaderLength;
+	u8 FragmentLength;
+	u8 AuxData[80];
+
+	XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
+
+	/* Wait for a reply. */
+	Status = XDp_TxWaitSbReply(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Receive reply. */
+	Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_DOWN_REP,
+				XDP_TX_SBMSG_REPLY_HEAD_NBYTES, AuxData);
+	if (Status != XST_SUCCESS) {
+		/* The AUX read transaction failed. */
+		return Status;
+	}
+
+	/* The header holds the relative address (2 ports per byte) between the
+	 * link count byte and the body length and sequence bytes. */
+	HeaderLength = 3 + ((AuxData[0] >> 4) / 2);
+	if (((AuxData[0] >> 4) == 0) ||
+				((AuxData[HeaderLength - 2] & 0x3F) == 0)) {
+		/* The link count total or the body length is invalid. */
+		return XST_FAILURE;
+	}
+	FragmentLength = HeaderLength + (AuxData[HeaderLength - 2] & 0x3F);
+
+	if (FragmentLength > XDP_TX_SBMSG_REPLY_HEAD_NBYTES) {
+		Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_DOWN_REP +
+				XDP_TX_SBMSG_REPLY_HEAD_NBYTES,
+				FragmentLength - XDP_TX_SBMSG_REPLY_HEAD_NBYTES,
+				&AuxData[XDP_TX_SBMSG_REPLY_HEAD_NBYTES]);
 		if (Status != XST_SUCCESS) {
-			/* The AUX write transaction failed. */
+			/* The AUX read transaction failed. */
 			return Status;
 		}
 	}
-	while (Msg.Header.EndOfMsgTransaction == 0);
 
-	/* Check if the reply indicates a NACK. */
-	if ((SbReply->Data[0] & 0x80) == 0x80) {
+	/* Convert the reply transaction into XDp_SidebandMsg format. */
+	Msg->FragmentNum = 0;
+	Status = XDp_Transaction2MsgFormat(AuxData, Msg);
+	if (Status != XST_SUCCESS) {
+		/* The CRC of the header or the body did not match the
+		 * calculated value. */
 		return XST_FAILURE;
 	}
 
-	return XST_SUCCESS;
+	/* Clear. */
+	AuxData[0] = 0x10;
+	Status = XDp_TxAuxWrite(InstancePtr,
+			XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0, 1,
+			AuxData);
+
+	return Status;
 }
 
 /******************************************************************************/
@@ -3727,26 +4135,34 @@ static u32 XDp_TxWaitSbReply(XDp *InstancePtr)
 {
 	u32 Status;
 	u8 AuxData;
-	u16 TimeoutCount = 0;
+	u32 TimeoutCount = 0;
 
-	do {
-		Status = XDp_TxAuxRead(InstancePtr,
-				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
-				1, &AuxData);
-		if (Status != XST_SUCCESS) {
-			/* The AUX read transaction failed. */
-			return Status;
-		}
+	Status = XDp_TxAuxRead(InstancePtr,
+			XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0, 1,
+			&AuxData);
+	if (Status != XST_SUCCESS) {
+		/* The AUX read transaction failed. */
+		return Status;
+	}
 
+	/* Only wait if the reply is not ready yet. */
+	while ((AuxData & 0x10) != 0x10) {
 		/* Error out if timed out. */
 		if (TimeoutCount > XDP_TX_MAX_SBMSG_REPLY_TIMEOUT_COUNT) {
 			return XST_ERROR_COUNT_MAX;
 		}
 
 		TimeoutCount++;
-		XDp_WaitUs(InstancePtr, 1000);
+		XDp_WaitUs(InstancePtr, XDP_TX_SBMSG_REPLY_POLL_US);
+
+		Status = XDp_TxAuxRead(InstancePtr,
+				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
+				1, &AuxData);
+		if (Status != XST_SUCCESS) {
+			/* The AUX read transaction failed. */
+			return Status;
+		}
 	}
-	while ((AuxData & 0x10) != 0x10);
 
 	return XST_SUCCESS;
 }
@@ -3970,14 +4386,16 @@ static u32 XDp_RxSendSbMsg(XDp *InstancePtr, XDp_SidebandMsg *Msg)
  * @return	The CRC value obtained by running the algorithm on the sideband
  *		message header.
  *
- * @note	The header is divided into 4-bit nibbles for use by the lower-
- *		level XDp_CrcCalculate function.
+ * @note	The header is divided into 4-bit nibbles which are run through
+ *		the CRC4 table one at a time.
  *
 *******************************************************************************/
 static u8 XDp_Crc4CalculateHeader(XDp_SidebandMsgHeader *Header)
 {
 	u8 Nibbles[20];
 	u8 RadOffset = 0;
+	u8 Index;
+	u8 Crc = 0;
 
 	/* Arrange header into nibbles for the CRC. */
 	Nibbles[0] = Header->LinkCountTotal;
@@ -4003,7 +4421,11 @@ static u8 XDp_Crc4CalculateHeader(XDp_SidebandMsgHeader *Header)
 	Nibbles[4 + RadOffset] = (Header->StartOfMsgTransaction << 3) |
 		(Header->EndOfMsgTransaction << 2) | Header->MsgSequenceNum;
 
-	return XDp_CrcCalculate(Nibbles, 4 * (5 + RadOffset), 4);
+	for (Index = 0; Index < (5 + RadOffset); Index++) {
+		Crc = XDp_Crc4Table[Crc ^ Nibbles[Index]];
+	}
+
+	return Crc;
 }
 
 /******************************************************************************/
@@ -4025,98 +4447,17 @@ static u8 XDp_Crc8CalculateBody(XDp_SidebandMsg *Msg)
 {
 	XDp_SidebandMsgBody *Body = &Msg->Body;
 	u8 StartIndex;
+	u8 Index;
+	u8 Crc = 0;
 
 	StartIndex = Msg->FragmentNum * (XDP_MAX_LENGTH_SBMSG -
 					Msg->Header.MsgHeaderLength - 1);
 
-	return XDp_CrcCalculate(&Body->MsgData[StartIndex],
-					8 * Body->MsgDataLength, 8);
-}
-
-/******************************************************************************/
-/**
- * This function will run a cyclic redundancy check (CRC) algorithm on some data
- * given a generator polynomial.
- *
- * @param	Data is a pointer to the data that the algorithm is to run on.
- * @param	NumberOfBits is the total number of data bits that the algorithm
- *		is to run on.
- * @param	Polynomial is the generator polynomial for the CRC algorithm and
- *		will be used as the divisor in the polynomial long division.
- *
- * @return	The CRC value obtained by running the algorithm on the data
- *		using the specified polynomial.
- *
- * @note	None.
- *
-*******************************************************************************/
-static u8 XDp_CrcCalculate(const u8 *Data, u32 NumberOfBits, u8 Polynomial)
-{
-	u8 BitMask;
-	u8 BitShift;
-	u8 ArrayIndex = 0;
-	u16 Remainder = 0;
-
-	if (Polynomial == 4) {
-		/* For CRC4, expecting nibbles (4-bits). */
-		BitMask = 0x08;
-		BitShift = 3;
-	}
-	else {
-		/* For CRC8, expecting bytes (8-bits). */
-		BitMask = 0x80;
-		BitShift = 7;
-	}
-
-	while (NumberOfBits != 0) {
-		NumberOfBits--;
-
-		Remainder <<= 1;
-		Remainder |= (Data[ArrayIndex] & BitMask) >> BitShift;
-
-		BitMask >>= 1;
-		BitShift--;
-
-		if (BitMask == 0) {
-			if (Polynomial == 4) {
-				BitMask = 0x08;
-				BitShift = 3;
-			}
-			else {
-				BitMask = 0x80;
-				BitShift = 7;
-			}
-			ArrayIndex++;
-		}
-
-		if ((Remainder & (1 << Polynomial)) != 0) {
-			if (Polynomial == 4) {
-				Remainder ^= 0x13;
-			}
-			else {
-				Remainder ^= 0xD5;
-			}
-		}
-	}
-
-	NumberOfBits = Polynomial;
-	while (NumberOfBits != 0) {
-		NumberOfBits--;
-
-		Remainder <<= 1;
-
-		if ((Remainder & (1 << Polynomial)) != 0) {
-			if (Polynomial == 4) {
-				Remainder ^= 0x13;
-				Remainder &= 0xFF;
-			}
-			else {
-				Remainder ^= 0xD5;
-			}
-		}
+	for (Index = 0; Index < Body->MsgDataLength; Index++) {
+		Crc = XDp_Crc8Table[Crc ^ Body->MsgData[StartIndex + Index]];
 	}
 
-	return Remainder & 0xFF;
+	return Crc;
 }
 
 /******************************************************************************/
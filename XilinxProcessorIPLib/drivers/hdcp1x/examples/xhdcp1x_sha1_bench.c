@@ -0,0 +1,427 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xhdcp1x_sha1_bench.c
+ *
+ * Contains a check and benchmark of the SHA-1 implementation used for the
+ * HDCP repeater V' computation. The RFC 3174 test vectors are hashed, a
+ * random message is hashed in random sized pieces at random alignments and
+ * compared against hashing it in one go, and then the time per KSV list of
+ * 127 devices (hashed in DP and HDMI KSV FIFO sized pieces, as
+ * XHdcp1x_TxValidateKsvList does) and the bulk throughput are reported.
+ *
+ * @note	The times are taken with the first counter of the AXI Timer
+ *		SHA1_BENCH_TMRCTR_DEVICE_ID, the results are printed on the
+ *		STDOUT of the processor.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 2.1   ms   10/19/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "xtmrctr.h"
+#include "sha1.h"
+
+/************************** Constant Definitions ******************************/
+
+#define SHA1_BENCH_TMRCTR_DEVICE_ID	XPAR_TMRCTR_0_DEVICE_ID
+#define SHA1_BENCH_TMRCTR_COUNTER	0	/**< Timer counter used. */
+
+#define SHA1_BENCH_KSV_DEVICES	127	/**< Largest HDCP 1.x KSV list. */
+#define SHA1_BENCH_KSV_CHUNK_DP	15	/**< DP KSV FIFO read size. */
+#define SHA1_BENCH_KSV_CHUNK_HDMI 1	/**< HDMI KSV FIFO read size. */
+#define SHA1_BENCH_KSV_LOOPS	1000	/**< KSV lists hashed per run. */
+#define SHA1_BENCH_BULK_SIZE	(16 * 1024)	/**< Bulk buffer size. */
+#define SHA1_BENCH_BULK_LOOPS	64	/**< Bulk buffers hashed per run. */
+#define SHA1_BENCH_RANDOM_SIZE	1024	/**< Largest random message. */
+#define SHA1_BENCH_RANDOM_LOOPS	200	/**< Random messages checked. */
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * RFC 3174 test vector: Text repeated Repeat times.
+ */
+typedef struct {
+	const char *Text;
+	unsigned Repeat;
+	u8 Digest[SHA1HashSize];
+} Bench_Vector;
+
+/**************************** Function Prototypes *****************************/
+
+static int Bench_Hash(const u8 *Buf, unsigned Length, unsigned Repeat,
+			unsigned Chunk, u8 Digest[SHA1HashSize]);
+static int Bench_CheckVectors(void);
+static int Bench_CheckChunking(void);
+static void Bench_PrintDigest(const u8 Digest[SHA1HashSize]);
+static u32 Bench_Elapsed(u32 Start, u32 Loops);
+static void Bench_Run(void);
+
+/*************************** Variable Definitions *****************************/
+
+/* The four tests of the RFC 3174 test driver. */
+static const Bench_Vector Bench_Vectors[] = {
+	{ "abc", 1,
+		{ 0xA9, 0x99, 0x3E, 0x36, 0x47, 0x06, 0x81, 0x6A, 0xBA, 0x3E,
+		  0x25, 0x71, 0x78, 0x50, 0xC2, 0x6C, 0x9C, 0xD0, 0xD8, 0x9D } },
+	{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+		{ 0x84, 0x98, 0x3E, 0x44, 0x1C, 0x3B, 0xD2, 0x6E, 0xBA, 0xAE,
+		  0x4A, 0xA1, 0xF9, 0x51, 0x29, 0xE5, 0xE5, 0x46, 0x70, 0xF1 } },
+	{ "a", 1000000,
+		{ 0x34, 0xAA, 0x97, 0x3C, 0xD4, 0xC4, 0xDA, 0xA4, 0xF6, 0x1E,
+		  0xEB, 0x2B, 0xDB, 0xAD, 0x27, 0x31, 0x65, 0x34, 0x01, 0x6F } },
+	{ "0123456701234567012345670123456701234567012345670123456701234567",
+		10,
+		{ 0xDE, 0xA3, 0x56, 0xA2, 0xCD, 0xDD, 0x90, 0xC7, 0xA7, 0xEC,
+		  0xED, 0xC5, 0xEB, 0xB5, 0x63, 0x93, 0x4F, 0x46, 0x04, 0x52 } },
+};
+
+/* The timer the measurements are taken with. */
+static XTmrCtr Bench_Timer;
+
+/* Keeps digests alive so the compiler does not drop the loops. */
+static volatile u8 Bench_Sink;
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function is the main entry point of the benchmark.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if all digests matched.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int main(void)
+{
+	if ((Bench_CheckVectors() != XST_SUCCESS) ||
+		(Bench_CheckChunking() != XST_SUCCESS)) {
+		xil_printf("SHA-1 check FAILED\r\n");
+		return XST_FAILURE;
+	}
+	xil_printf("SHA-1 check passed\r\n");
+
+	if (XTmrCtr_Initialize(&Bench_Timer, SHA1_BENCH_TMRCTR_DEVICE_ID) !=
+								XST_SUCCESS) {
+		xil_printf("Timer initialization failed\r\n");
+		return XST_FAILURE;
+	}
+	XTmrCtr_SetOptions(&Bench_Timer, SHA1_BENCH_TMRCTR_COUNTER,
+						XTC_AUTO_RELOAD_OPTION);
+	XTmrCtr_Start(&Bench_Timer, SHA1_BENCH_TMRCTR_COUNTER);
+
+	Bench_Run();
+
+	XTmrCtr_Stop(&Bench_Timer, SHA1_BENCH_TMRCTR_COUNTER);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function hashes a buffer repeated a number of times, handing it to
+ * SHA1Input in pieces of at most Chunk octets.
+ *
+ * @param	Buf is the buffer to hash.
+ * @param	Length is the length of Buf.
+ * @param	Repeat is the number of times Buf is hashed.
+ * @param	Chunk is the largest piece handed to SHA1Input.
+ * @param	Digest returns the digest.
+ *
+ * @return	The sha error code.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int Bench_Hash(const u8 *Buf, unsigned Length, unsigned Repeat,
+			unsigned Chunk, u8 Digest[SHA1HashSize])
+{
+	SHA1Context Context;
+	unsigned Offset;
+	unsigned Size;
+	int Status;
+
+	Status = SHA1Reset(&Context);
+
+	while (Repeat-- && (Status == shaSuccess)) {
+		for (Offset = 0; Offset < Length; Offset += Size) {
+			Size = Length - Offset;
+			if (Size > Chunk) {
+				Size = Chunk;
+			}
+			Status = SHA1Input(&Context, Buf + Offset, Size);
+			if (Status != shaSuccess) {
+				break;
+			}
+		}
+	}
+
+	if (Status == shaSuccess) {
+		Status = SHA1Result(&Context, Digest);
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * This function checks the RFC 3174 test vectors, each hashed in one piece
+ * and one octet at a time.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if all digests matched.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int Bench_CheckVectors(void)
+{
+	u32 Index;
+	u32 Pass;
+	u8 Digest[SHA1HashSize];
+	int Status = XST_SUCCESS;
+	const Bench_Vector *VecPtr;
+
+	for (Index = 0; Index < sizeof(Bench_Vectors) /
+					sizeof(Bench_Vectors[0]); Index++) {
+		VecPtr = &Bench_Vectors[Index];
+
+		for (Pass = 0; Pass < 2; Pass++) {
+			if (Bench_Hash((const u8 *)VecPtr->Text,
+					strlen(VecPtr->Text), VecPtr->Repeat,
+					Pass ? 1 : (unsigned)-1,
+					Digest) != shaSuccess) {
+				xil_printf("Test %d: hash error\r\n",
+							(int)Index + 1);
+				Status = XST_FAILURE;
+				continue;
+			}
+
+			if (memcmp(Digest, VecPtr->Digest,
+						SHA1HashSize) != 0) {
+				xil_printf("Test %d (%s): ", (int)Index + 1,
+					Pass ? "octet-wise" : "one piece");
+				Bench_PrintDigest(Digest);
+				xil_printf(", expected ");
+				Bench_PrintDigest(VecPtr->Digest);
+				xil_printf("\r\n");
+				Status = XST_FAILURE;
+			}
+		}
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * This function checks that hashing random messages in random sized pieces,
+ * starting at all four alignments, gives the same digest as hashing them in
+ * one piece.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if all digests matched.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int Bench_CheckChunking(void)
+{
+	static u8 Buf[SHA1_BENCH_RANDOM_SIZE + 3];
+	u8 Expected[SHA1HashSize];
+	u8 Digest[SHA1HashSize];
+	SHA1Context Context;
+	u32 Loop;
+	u32 Index;
+	unsigned Align;
+	unsigned Length;
+	unsigned Offset;
+	unsigned Size;
+
+	srand(1);
+
+	for (Loop = 0; Loop < SHA1_BENCH_RANDOM_LOOPS; Loop++) {
+		Align = Loop & 3;
+		Length = rand() % SHA1_BENCH_RANDOM_SIZE;
+		for (Index = 0; Index < Length; Index++) {
+			Buf[Align + Index] = (u8)rand();
+		}
+
+		Bench_Hash(&Buf[Align], Length, 1, (unsigned)-1, Expected);
+
+		SHA1Reset(&Context);
+		for (Offset = 0; Offset < Length; Offset += Size) {
+			Size = 1 + (rand() % 150);
+			if (Size > Length - Offset) {
+				Size = Length - Offset;
+			}
+			SHA1Input(&Context, &Buf[Align + Offset], Size);
+		}
+		SHA1Result(&Context, Digest);
+
+		if (memcmp(Digest, Expected, SHA1HashSize) != 0) {
+			xil_printf("Piecewise hash of %d octets differs\r\n",
+								(int)Length);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function prints a digest in hexadecimal.
+ *
+ * @param	Digest is the digest to print.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Bench_PrintDigest(const u8 Digest[SHA1HashSize])
+{
+	int Byte;
+
+	for (Byte = 0; Byte < SHA1HashSize; Byte++) {
+		xil_printf("%02X", Digest[Byte]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function returns the time per loop since a timer reading.
+ *
+ * @param	Start is the timer value at the start of the measurement.
+ * @param	Loops is the number of loops run since Start.
+ *
+ * @return	The time per loop in nanoseconds.
+ *
+ * @note	The counter counts up and wraps, a measurement must be shorter
+ *		than one wrap of the counter.
+ *
+*******************************************************************************/
+static u32 Bench_Elapsed(u32 Start, u32 Loops)
+{
+	u32 Ticks;
+
+	Ticks = XTmrCtr_GetValue(&Bench_Timer, SHA1_BENCH_TMRCTR_COUNTER) -
+									Start;
+
+	return (u32)(((u64)Ticks * 1000000000U) /
+		((u64)Bench_Timer.Config.SysClockFreqHz * Loops));
+}
+
+/******************************************************************************/
+/**
+ * This function times the V' computation over the largest KSV list, and the
+ * throughput on a larger buffer, and prints the results.
+ *
+ * @param	None.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Bench_Run(void)
+{
+	static u8 Bulk[SHA1_BENCH_BULK_SIZE];
+	static u8 KsvList[SHA1_BENCH_KSV_DEVICES * 5 + 10];
+	u8 Digest[SHA1HashSize];
+	const unsigned Chunk[2] = {
+		SHA1_BENCH_KSV_CHUNK_DP,
+		SHA1_BENCH_KSV_CHUNK_HDMI,
+	};
+	u32 Loop;
+	u32 Index;
+	u32 Port;
+	u32 Start;
+	u32 Time;
+
+	/* KSV list followed by BInfo and M0, as in the V' computation */
+	for (Index = 0; Index < sizeof(KsvList); Index++) {
+		KsvList[Index] = (u8)(Index * 37);
+	}
+
+	for (Port = 0; Port < 2; Port++) {
+		Start = XTmrCtr_GetValue(&Bench_Timer,
+					SHA1_BENCH_TMRCTR_COUNTER);
+		for (Loop = 0; Loop < SHA1_BENCH_KSV_LOOPS; Loop++) {
+			KsvList[0] = (u8)Loop;
+			Bench_Hash(KsvList, sizeof(KsvList), 1, Chunk[Port],
+								Digest);
+			Bench_Sink += Digest[0];
+		}
+		Time = Bench_Elapsed(Start, SHA1_BENCH_KSV_LOOPS);
+		xil_printf("V' over %d KSVs, %2d octet reads %8d ns\r\n",
+			SHA1_BENCH_KSV_DEVICES, (int)Chunk[Port], (int)Time);
+	}
+
+	memset(Bulk, 0x5A, sizeof(Bulk));
+
+	Start = XTmrCtr_GetValue(&Bench_Timer, SHA1_BENCH_TMRCTR_COUNTER);
+	for (Loop = 0; Loop < SHA1_BENCH_BULK_LOOPS; Loop++) {
+		Bulk[0] = (u8)Loop;
+		Bench_Hash(Bulk, sizeof(Bulk), 1, (unsigned)-1, Digest);
+		Bench_Sink += Digest[0];
+	}
+	Time = Bench_Elapsed(Start, SHA1_BENCH_BULK_LOOPS);
+	xil_printf("Bulk throughput                 %8d KB/s\r\n",
+		(int)(((u64)sizeof(Bulk) * 1000000000U) / ((u64)Time * 1024)));
+}
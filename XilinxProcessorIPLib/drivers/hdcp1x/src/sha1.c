@@ -20,6 +20,14 @@
  *      support 32 bit unsigned integers, this code is not
  *      appropriate.
  *
+ *  Performance:
+ *      Whole 64 octet blocks are hashed straight from the caller's
+ *      buffer, reading it a 32-bit word (four octets) at a time; only
+ *      a partial block at either end is copied into the context.  The
+ *      80 rounds are unrolled and the message schedule is kept in a
+ *      rolling window of 16 words instead of the 80 word array of the
+ *      publication.  The buffer may have any alignment.
+ *
  *  Caveats:
  *      SHA-1 is designed to work with messages less than 2^64 bits
  *      long.  Although SHA-1 allows a message digest to be generated
@@ -29,6 +37,7 @@
  *
  */
 
+#include <string.h>
 #include "sha1.h"
 
 /*
@@ -37,9 +46,55 @@
 #define SHA1CircularShift(bits,word) \
                 (((word) << (bits)) | ((word) >> (32-(bits))))
 
+/*
+ *  Read a big endian word from a buffer of any alignment
+ */
+#define SHA1GetWord(p) \
+                (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                 ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+
+/*
+ *  The round functions f(t;B,C,D), Ch and Maj written with one
+ *  operation less than in the publication
+ */
+#define SHA1Ch(B,C,D)       ((D) ^ ((B) & ((C) ^ (D))))
+#define SHA1Parity(B,C,D)   ((B) ^ (C) ^ (D))
+#define SHA1Maj(B,C,D)      (((B) & (C)) | ((D) & ((B) | (C))))
+
+/*
+ *  Word t of the message schedule.  W[t] for t >= 16 only depends on
+ *  the 16 words before it, so W[] is a rolling window where W[t & 15]
+ *  is overwritten in place.  t is a constant in the unrolled rounds,
+ *  so the test is resolved at compile time.
+ */
+#define SHA1Schedule(t) \
+                ((t) < 16 ? W[(t) & 15] : \
+                 (W[(t) & 15] = SHA1CircularShift(1, \
+                                W[((t) + 13) & 15] ^ W[((t) + 8) & 15] ^ \
+                                W[((t) + 2) & 15] ^ W[(t) & 15])))
+
+/*
+ *  One round.  Instead of shifting the word buffers along, the callers
+ *  rotate the arguments, so that after five rounds every buffer is back
+ *  in its own variable.
+ */
+#define SHA1Round(A,B,C,D,E,F,K,t) \
+                E += SHA1CircularShift(5,A) + F(B,C,D) + (K) + \
+                     SHA1Schedule(t); \
+                B = SHA1CircularShift(30,B)
+
+#define SHA1Round5(F,K,t) \
+                SHA1Round(A,B,C,D,E,F,K,(t)); \
+                SHA1Round(E,A,B,C,D,F,K,(t) + 1); \
+                SHA1Round(D,E,A,B,C,F,K,(t) + 2); \
+                SHA1Round(C,D,E,A,B,F,K,(t) + 3); \
+                SHA1Round(B,C,D,E,A,F,K,(t) + 4)
+
 /* Local Function Prototyptes */
 void SHA1PadMessage(SHA1Context *);
 void SHA1ProcessMessageBlock(SHA1Context *);
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block);
 
 /*
  *  SHA1Reset
@@ -116,11 +171,9 @@ int SHA1Result( SHA1Context *context,
     if (!context->Computed)
     {
         SHA1PadMessage(context);
-        for(i=0; i<64; ++i)
-        {
-            /* message may be sensitive, clear it out */
-            context->Message_Block[i] = 0;
-        }
+
+        /* message may be sensitive, clear it out */
+        memset(context->Message_Block, 0, sizeof(context->Message_Block));
         context->Length_Low = 0;    /* and clear length */
         context->Length_High = 0;
         context->Computed = 1;
@@ -160,6 +213,10 @@ int SHA1Input(    SHA1Context    *context,
                   const uint8_t  *message_array,
                   unsigned       length)
 {
+    uint32_t      bits;              /* Length of the input in bits   */
+    uint32_t      carry;             /* Carry into Length_High        */
+    unsigned      count;             /* Octets copied into the block  */
+
     if (!length)
     {
         return shaSuccess;
@@ -181,137 +238,159 @@ int SHA1Input(    SHA1Context    *context,
     {
          return context->Corrupted;
     }
-    while(length-- && !context->Corrupted)
+
+    /*
+     *  Update the 64-bit message length once for the whole input
+     */
+    bits = (uint32_t)length << 3;
+    carry = (uint32_t)length >> 29;
+    context->Length_Low += bits;
+    if (context->Length_Low < bits)
+    {
+        carry++;
+    }
+    context->Length_High += carry;
+    if (context->Length_High < carry)
     {
-    context->Message_Block[context->Message_Block_Index++] =
-                    (*message_array & 0xFF);
+        /* Message is too long */
+        context->Corrupted = 1;
 
-    context->Length_Low += 8;
-    if (context->Length_Low == 0)
+        return shaSuccess;
+    }
+
+    /*
+     *  Complete a block left partially filled by an earlier call
+     */
+    if (context->Message_Block_Index)
     {
-        context->Length_High++;
-        if (context->Length_High == 0)
+        count = 64 - context->Message_Block_Index;
+        if (count > length)
+        {
+            count = length;
+        }
+
+        length -= count;
+        while (count--)
+        {
+            context->Message_Block[context->Message_Block_Index++] =
+                            *message_array++;
+        }
+
+        if (context->Message_Block_Index == 64)
         {
-            /* Message is too long */
-            context->Corrupted = 1;
+            SHA1ProcessMessageBlock(context);
         }
     }
 
-    if (context->Message_Block_Index == 64)
+    /*
+     *  Hash whole blocks straight from the caller's buffer
+     */
+    while (length >= 64)
     {
-        SHA1ProcessMessageBlock(context);
+        SHA1ProcessBlock(context->Intermediate_Hash, message_array);
+        message_array += 64;
+        length -= 64;
     }
 
-    message_array++;
+    /*
+     *  Keep the rest for the next call or the padding
+     */
+    while (length--)
+    {
+        context->Message_Block[context->Message_Block_Index++] =
+                        *message_array++;
     }
 
     return shaSuccess;
 }
 
 /*
- *  SHA1ProcessMessageBlock
+ *  SHA1ProcessBlock
  *
  *  Description:
- *      This function will process the next 512 bits of the message
- *      stored in the Message_Block array.
+ *      This function will process 512 bits of the message.
  *
  *  Parameters:
- *      None.
+ *      Intermediate_Hash: [in/out]
+ *          The hash value to update.
+ *      block: [in]
+ *          The 64 octets to process, of any alignment.
  *
  *  Returns:
  *      Nothing.
  *
  *  Comments:
-
  *      Many of the variable names in this code, especially the
  *      single character names, were used because those were the
  *      names used in the publication.
  *
- *
  */
-void SHA1ProcessMessageBlock(SHA1Context *context)
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block)
 {
-    const uint32_t K[] =    {       /* Constants defined in SHA-1   */
-                            0x5A827999,
-                            0x6ED9EBA1,
-                            0x8F1BBCDC,
-                            0xCA62C1D6
-                            };
     int           t;                 /* Loop counter                */
-    uint32_t      temp;              /* Temporary word value        */
-    uint32_t      W[80];             /* Word sequence               */
+    uint32_t      W[16];             /* Word sequence window        */
     uint32_t      A, B, C, D, E;     /* Word buffers                */
 
     /*
-     *  Initialize the first 16 words in the array W
+     *  Initialize the first 16 words of the window
      */
     for(t = 0; t < 16; t++)
     {
-        W[t] = context->Message_Block[t * 4] << 24;
-        W[t] |= context->Message_Block[t * 4 + 1] << 16;
-        W[t] |= context->Message_Block[t * 4 + 2] << 8;
-        W[t] |= context->Message_Block[t * 4 + 3];
-    }
-
-    for(t = 16; t < 80; t++)
-    {
-       W[t] = SHA1CircularShift(1,W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
-    }
-
-    A = context->Intermediate_Hash[0];
-    B = context->Intermediate_Hash[1];
-    C = context->Intermediate_Hash[2];
-    D = context->Intermediate_Hash[3];
-    E = context->Intermediate_Hash[4];
-
-    for(t = 0; t < 20; t++)
-    {
-        temp =  SHA1CircularShift(5,A) +
-                ((B & C) | ((~B) & D)) + E + W[t] + K[0];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-
-        B = A;
-        A = temp;
-    }
-
-    for(t = 20; t < 40; t++)
-    {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[1];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for(t = 40; t < 60; t++)
-    {
-        temp = SHA1CircularShift(5,A) +
-               ((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
+        W[t] = SHA1GetWord(block);
+        block += 4;
     }
 
-    for(t = 60; t < 80; t++)
-    {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[3];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
-    }
+    A = Intermediate_Hash[0];
+    B = Intermediate_Hash[1];
+    C = Intermediate_Hash[2];
+    D = Intermediate_Hash[3];
+    E = Intermediate_Hash[4];
+
+    SHA1Round5(SHA1Ch, 0x5A827999, 0);
+    SHA1Round5(SHA1Ch, 0x5A827999, 5);
+    SHA1Round5(SHA1Ch, 0x5A827999, 10);
+    SHA1Round5(SHA1Ch, 0x5A827999, 15);
+
+    SHA1Round5(SHA1Parity, 0x6ED9EBA1, 20);
+    SHA1Round5(SHA1Parity, 0x6ED9EBA1, 25);
+    SHA1Round5(SHA1Parity, 0x6ED9EBA1, 30);
+    SHA1Round5(SHA1Parity, 0x6ED9EBA1, 35);
+
+    SHA1Round5(SHA1Maj, 0x8F1BBCDC, 40);
+    SHA1Round5(SHA1Maj, 0x8F1BBCDC, 45);
+    SHA1Round5(SHA1Maj, 0x8F1BBCDC, 50);
+    SHA1Round5(SHA1Maj, 0x8F1BBCDC, 55);
+
+    SHA1Round5(SHA1Parity, 0xCA62C1D6, 60);
+    SHA1Round5(SHA1Parity, 0xCA62C1D6, 65);
+    SHA1Round5(SHA1Parity, 0xCA62C1D6, 70);
+    SHA1Round5(SHA1Parity, 0xCA62C1D6, 75);
+
+    Intermediate_Hash[0] += A;
+    Intermediate_Hash[1] += B;
+    Intermediate_Hash[2] += C;
+    Intermediate_Hash[3] += D;
+    Intermediate_Hash[4] += E;
+}
 
-    context->Intermediate_Hash[0] += A;
-    context->Intermediate_Hash[1] += B;
-    context->Intermediate_Hash[2] += C;
-    context->Intermediate_Hash[3] += D;
-    context->Intermediate_Hash[4] += E;
+/*
+ *  SHA1ProcessMessageBlock
+ *
+ *  Description:
+ *      This function will process the next 512 bits of the message
+ *      stored in the Message_Block array.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ */
+void SHA1ProcessMessageBlock(SHA1Context *context)
+{
+    SHA1ProcessBlock(context->Intermediate_Hash, context->Message_Block);
 
     context->Message_Block_Index = 0;
 }
@@ -348,30 +427,17 @@ void SHA1PadMessage(SHA1Context *context)
      *  block, process it, and then continue padding into a second
      *  block.
      */
-    if (context->Message_Block_Index > 55)
+    context->Message_Block[context->Message_Block_Index++] = 0x80;
+    if (context->Message_Block_Index > 56)
     {
-        context->Message_Block[context->Message_Block_Index++] = 0x80;
-        while(context->Message_Block_Index < 64)
-        {
-            context->Message_Block[context->Message_Block_Index++] = 0;
-        }
+        memset(&context->Message_Block[context->Message_Block_Index], 0,
+               64 - context->Message_Block_Index);
 
         SHA1ProcessMessageBlock(context);
-
-        while(context->Message_Block_Index < 56)
-        {
-            context->Message_Block[context->Message_Block_Index++] = 0;
-        }
     }
-    else
-    {
-        context->Message_Block[context->Message_Block_Index++] = 0x80;
-        while(context->Message_Block_Index < 56)
-        {
 
-            context->Message_Block[context->Message_Block_Index++] = 0;
-        }
-    }
+    memset(&context->Message_Block[context->Message_Block_Index], 0,
+           56 - context->Message_Block_Index);
 
     /*
      *  Store the message length as the last 8 octets
@@ -48,6 +48,9 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Conversion matrices from precomputed fixed-point
+*                        tables, fixed-point picture controls, IP register
+*                        writes limited to changed coefficients
 
 * </pre>
 *
@@ -60,6 +63,11 @@
 /* Maximum precision available for csc coefficients */
 #define XV_CSC_COEFF_FRACTIONAL_BITS   (12)
 
+/* Luma weights used by the saturation matrix (0.3086, 0.6094, 0.0820) */
+#define XV_CSC_SAT_RWGT                (1264)
+#define XV_CSC_SAT_GWGT                (2496)
+#define XV_CSC_SAT_BWGT                (336)
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef enumerates the window within which the csc core will have an
@@ -71,8 +79,94 @@ typedef enum
   UPD_REG_DEMO_WIN
 }XV_CSC_REG_UPDT_WIN;
 
+/**
+ * Layer 1 register write function
+ */
+typedef void (*XV_CSC_HWREG_WR)(XV_csc *InstancePtr, u32 Data);
+
 
 /**************************** Local Global *******************************/
+/*
+ * YCbCr to RGB conversion matrices with XV_CSC_COEFF_FRACTIONAL_BITS
+ * precision, indexed by XVidC_ColorStd. Offsets are for 8 bit video
+ */
+static const s32 cscYCbCrtoRGBTbl[XVIDC_BT_NUM_SUPPORTED][3][4] =
+{
+  { //BT2020
+    { 4769,     0,  6875, -234},
+    { 4769,  -767, -2664,   89},
+    { 4769,  8772,     0, -293}
+  },
+  { //BT709
+    { 4769,     0,  7342, -248},
+    { 4769,  -873, -2182,   77},
+    { 4769,  8652,     0, -289}
+  },
+  { //BT601
+    { 4769,     0,  6515, -223},
+    { 4769, -1604, -3330,  136},
+    { 4769,  8262,     0, -277}
+  }
+};
+
+/*
+ * RGB to YCbCr conversion matrices with XV_CSC_COEFF_FRACTIONAL_BITS
+ * precision, indexed by XVidC_ColorStd. Offsets are for 8 bit video
+ */
+static const s32 cscRGBtoYCbCrTbl[XVIDC_BT_NUM_SUPPORTED][3][4] =
+{
+  { //BT2020
+    {  924,  2385,   208,   16},
+    { -502, -1296,  1798,  128},
+    { 1798, -1654,  -144,  128}
+  },
+  { //BT709
+    {  747,  2515,   253,   16},
+    { -412, -1386,  1798,  128},
+    { 1798, -1633,  -165,  128}
+  },
+  { //BT601
+    { 1051,  2064,   400,   16},
+    { -607, -1191,  1799,  128},
+    { 1799, -1506,  -292,  128}
+  }
+};
+
+/*
+ * Layer 1 write function of each coefficient register, indexed by
+ * XV_CSC_FW_REG_MMAP - CSC_FW_REG_K11
+ */
+static const XV_CSC_HWREG_WR cscHwRegWr[CSC_FW_NUM_REGS-CSC_FW_REG_K11] =
+{
+  XV_csc_Set_HwReg_K11,
+  XV_csc_Set_HwReg_K12,
+  XV_csc_Set_HwReg_K13,
+  XV_csc_Set_HwReg_K21,
+  XV_csc_Set_HwReg_K22,
+  XV_csc_Set_HwReg_K23,
+  XV_csc_Set_HwReg_K31,
+  XV_csc_Set_HwReg_K32,
+  XV_csc_Set_HwReg_K33,
+  XV_csc_Set_HwReg_ROffset_V,
+  XV_csc_Set_HwReg_GOffset_V,
+  XV_csc_Set_HwReg_BOffset_V,
+  XV_csc_Set_HwReg_ClampMin_V,
+  XV_csc_Set_HwReg_ClipMax_V,
+  XV_csc_Set_HwReg_K11_2,
+  XV_csc_Set_HwReg_K12_2,
+  XV_csc_Set_HwReg_K13_2,
+  XV_csc_Set_HwReg_K21_2,
+  XV_csc_Set_HwReg_K22_2,
+  XV_csc_Set_HwReg_K23_2,
+  XV_csc_Set_HwReg_K31_2,
+  XV_csc_Set_HwReg_K32_2,
+  XV_csc_Set_HwReg_K33_2,
+  XV_csc_Set_HwReg_ROffset_2_V,
+  XV_csc_Set_HwReg_GOffset_2_V,
+  XV_csc_Set_HwReg_BOffset_2_V,
+  XV_csc_Set_HwReg_ClampMin_2_V,
+  XV_csc_Set_HwReg_ClipMax_2_V
+};
 
 /************************** Function Prototypes ******************************/
 static void cscFwYCbCrtoRGB(s32 K[3][4],
@@ -99,6 +193,8 @@ static void cscFwSetCoefficients(XV_csc_L2Reg *pCscFwReg,
 static void cscFwGetActiveCoefficients(XV_csc_L2Reg *pCscFwReg, s32 K[3][4]);
 static void cscFwSetActiveCoefficients(XV_csc_L2Reg *pCscFwReg, s32 K[3][4]);
 static void cscFwMatrixMult(s32 K1[3][4], s32 K2[3][4], s32 Kout[3][4]);
+static void cscFwScaleRow(s32 K[3][4], u8 row, s32 num, s32 den);
+static s32 cscFwDivRound(s32 num, s32 den);
 static void cscFwComputeCoeff(XV_csc_L2Reg *pCscFwReg,
                               s32 K2[3][4]);
 static void cscUpdateIPReg(XV_csc *pCsc,
@@ -106,7 +202,8 @@ static void cscUpdateIPReg(XV_csc *pCsc,
                            XV_CSC_REG_UPDT_WIN win);
 /*****************************************************************************/
 /**
-* This function provides the write interface for FW register bank
+* This function provides the write interface for FW register bank. Registers
+* whose value changes are marked for the next IP register update
 *
 * @param  pCscFwReg is a pointer to fw register map of csc core instance
 * @param  offset is register offset
@@ -117,7 +214,11 @@ static void cscUpdateIPReg(XV_csc *pCsc,
 ******************************************************************************/
 __inline void cscFw_RegW(XV_csc_L2Reg *pCscFwReg, u32 offset, s32 val)
 {
-  pCscFwReg->regMap[offset] = val;
+  if(pCscFwReg->regMap[offset] != val)
+  {
+    pCscFwReg->regMap[offset] = val;
+    pCscFwReg->regDirty |= ((u32)1<<offset);
+  }
 }
 
 /*****************************************************************************/
@@ -263,6 +364,7 @@ void XV_CscInitPowerOnDefault(XV_csc_L2Reg *pCscFwReg)
   pCscFwReg->K_active[0][3]    = 0;
   pCscFwReg->K_active[1][3]    = 0;
   pCscFwReg->K_active[2][3]    = 0;
+  pCscFwReg->regDirty          = 0xFFFFFFFF;
 }
 
 
@@ -357,7 +459,7 @@ void XV_CscSetColorspace(XV_csc *InstancePtr,
   cscFw_RegW(pCscFwReg, CSC_FW_REG_K21,K[1][0]);
   cscFw_RegW(pCscFwReg, CSC_FW_REG_K22,K[1][1]);
   cscFw_RegW(pCscFwReg, CSC_FW_REG_K23,K[1][2]);
-  cscFw_RegW(pCscFwReg, CSC_FW_REG_K13,K[2][0]);
+  cscFw_RegW(pCscFwReg, CSC_FW_REG_K31,K[2][0]);
   cscFw_RegW(pCscFwReg, CSC_FW_REG_K32,K[2][1]);
   cscFw_RegW(pCscFwReg, CSC_FW_REG_K33,K[2][2]);
   cscFw_RegW(pCscFwReg, CSC_FW_REG_ROffset,K[0][3]);
@@ -369,7 +471,8 @@ void XV_CscSetColorspace(XV_csc *InstancePtr,
   //compute coeff for Demo window
   cscFwComputeCoeff(pCscFwReg, pCscFwReg->K_active);
 
-  //write IP Registers
+  //core may have been reset since the last update, write all IP Registers
+  pCscFwReg->regDirty = 0xFFFFFFFF;
   cscUpdateIPReg(pCsc, pCscFwReg, UPDT_REG_FULL_FRAME);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
@@ -393,70 +496,21 @@ static void cscFwYCbCrtoRGB(s32 YCC2RGB[3][4],
                             s32 *ClampMin,
                             s32 *ClipMax)
 {
-  s32 scale_factor = (1<<XV_CSC_COEFF_FRACTIONAL_BITS);
   s32 bpcScale = (1<<(pixPrec-8));
+  u8 x,y;
 
-  switch(cstdIn)
+  if(cstdIn >= XVIDC_BT_NUM_SUPPORTED)
   {
-    case XVIDC_BT_601:
-        YCC2RGB[0][0] = (s32) ( 1.1644*(float)scale_factor);  //K11
-        YCC2RGB[0][1] = (s32)  0;                             //K12
-        YCC2RGB[0][2] = (s32) ( 1.5906*(float)scale_factor);  //K13
-        YCC2RGB[1][0] = (s32) ( 1.1644*(float)scale_factor);  //K21
-        YCC2RGB[1][1] = (s32) (-0.3918*(float)scale_factor);  //K22
-        YCC2RGB[1][2] = (s32) (-0.8130*(float)scale_factor);  //K23
-        YCC2RGB[2][0] = (s32)  (1.1644*(float)scale_factor);  //K31
-        YCC2RGB[2][1] = (s32) ( 2.0172*(float)scale_factor);  //K32
-        YCC2RGB[2][2] = (s32)  0;                             //K33
-        YCC2RGB[0][3] = (s32) -223*bpcScale;                  //R Offset
-        YCC2RGB[1][3] = (s32)  136*bpcScale;                  //G Offset
-        YCC2RGB[2][3] = (s32) -277*bpcScale;                  //B Offset
-        break;
-
-    case XVIDC_BT_709:
-        YCC2RGB[0][0] = (s32) ( 1.1644*(float)scale_factor);  //K11
-        YCC2RGB[0][1] = (s32)  0;                             //K12
-        YCC2RGB[0][2] = (s32) ( 1.7927*(float)scale_factor);  //K13
-        YCC2RGB[1][0] = (s32) ( 1.1644*(float)scale_factor);  //K21
-        YCC2RGB[1][1] = (s32) (-0.2132*(float)scale_factor);  //K22
-        YCC2RGB[1][2] = (s32) (-0.5329*(float)scale_factor);  //K23
-        YCC2RGB[2][0] = (s32) ( 1.1644*(float)scale_factor);  //K31
-        YCC2RGB[2][1] = (s32) ( 2.1124*(float)scale_factor);  //K32
-        YCC2RGB[2][2] = (s32)  0;                             //K33
-        YCC2RGB[0][3] = (s32) -248*bpcScale;                  //R Offset
-        YCC2RGB[1][3] = (s32)  77*bpcScale;                   //G Offset
-        YCC2RGB[2][3] = (s32) -289*bpcScale;                  //B Offset
-        break;
-
-    case XVIDC_BT_2020:
-        YCC2RGB[0][0] = (s32) ( 1.1644*(float)scale_factor);  //K11
-        YCC2RGB[0][1] = (s32)  0;                             //K12
-        YCC2RGB[0][2] = (s32) ( 1.6787*(float)scale_factor);  //K13
-        YCC2RGB[1][0] = (s32) ( 1.1644*(float)scale_factor);  //K21
-        YCC2RGB[1][1] = (s32) (-0.1873*(float)scale_factor);  //K22
-        YCC2RGB[1][2] = (s32) (-0.6504*(float)scale_factor);  //K23
-        YCC2RGB[2][0] = (s32) ( 1.1644*(float)scale_factor);  //K31
-        YCC2RGB[2][1] = (s32) ( 2.1418*(float)scale_factor);  //K32
-        YCC2RGB[2][2] = (s32)  0;                             //K33
-        YCC2RGB[0][3] = (s32) -234*bpcScale;                  //R Offset
-        YCC2RGB[1][3] = (s32)  89*bpcScale;                   //G Offset
-        YCC2RGB[2][3] = (s32) -293*bpcScale;                  //B Offset
-        break;
+    cstdIn = XVIDC_BT_601; //use 601 numbers
+  }
 
-    default: //use 601 numbers
-        YCC2RGB[0][0] = (s32) ( 1.1644*(float)scale_factor);  //K11
-        YCC2RGB[0][1] = (s32)  0;                             //K12
-        YCC2RGB[0][2] = (s32) ( 1.5906*(float)scale_factor);  //K13
-        YCC2RGB[1][0] = (s32) ( 1.1644*(float)scale_factor);  //K21
-        YCC2RGB[1][1] = (s32) (-0.3918*(float)scale_factor);  //K22
-        YCC2RGB[1][2] = (s32) (-0.8130*(float)scale_factor);  //K23
-        YCC2RGB[2][0] = (s32)  (1.1644*(float)scale_factor);  //K31
-        YCC2RGB[2][1] = (s32) ( 2.0172*(float)scale_factor);  //K32
-        YCC2RGB[2][2] = (s32)  0;                             //K33
-        YCC2RGB[0][3] = (s32) -223*bpcScale;                  //R Offset
-        YCC2RGB[1][3] = (s32)  136*bpcScale;                  //G Offset
-        YCC2RGB[2][3] = (s32) -277*bpcScale;                  //B Offset
-        break;
+  for(x=0; x<3; ++x)
+  {
+    for(y=0; y<3; ++y)
+    {
+      YCC2RGB[x][y] = cscYCbCrtoRGBTbl[cstdIn][x][y];
+    }
+    YCC2RGB[x][3] = cscYCbCrtoRGBTbl[cstdIn][x][3]*bpcScale;
   }
 
   *ClampMin = 0;
@@ -482,70 +536,21 @@ static void cscFwRGBtoYCbCr(s32 RGB2YCC[3][4],
                             s32 *ClampMin,
                             s32 *ClipMax)
 {
-  s32 scale_factor = (1<<XV_CSC_COEFF_FRACTIONAL_BITS);
   s32 bpcScale = (1<<(pixPrec-8));
+  u8 x,y;
 
-  switch(cstdOut)
+  if(cstdOut >= XVIDC_BT_NUM_SUPPORTED)
   {
-    case XVIDC_BT_601:
-        RGB2YCC[0][0] = (s32) ( 0.2568*(float)scale_factor);  //K11
-        RGB2YCC[0][1] = (s32) ( 0.5041*(float)scale_factor);  //K12
-        RGB2YCC[0][2] = (s32) ( 0.0979*(float)scale_factor);  //K13
-        RGB2YCC[1][0] = (s32) (-0.1482*(float)scale_factor);  //K21
-        RGB2YCC[1][1] = (s32) (-0.2910*(float)scale_factor);  //K22
-        RGB2YCC[1][2] = (s32) ( 0.4393*(float)scale_factor);  //K23
-        RGB2YCC[2][0] = (s32) ( 0.4393*(float)scale_factor);  //K31
-        RGB2YCC[2][1] = (s32) (-0.3678*(float)scale_factor);  //K32
-        RGB2YCC[2][2] = (s32) (-0.0714*(float)scale_factor);  //K33
-        RGB2YCC[0][3] =  16*bpcScale;                   //R Offset
-        RGB2YCC[1][3] =  128*bpcScale;                  //G Offset
-        RGB2YCC[2][3] =  128*bpcScale;                  //B Offset
-        break;
-
-    case XVIDC_BT_709:
-        RGB2YCC[0][0] = (s32) ( 0.1826*(float)scale_factor);  //K11
-        RGB2YCC[0][1] = (s32) ( 0.6142*(float)scale_factor);  //K12
-        RGB2YCC[0][2] = (s32) ( 0.0620*(float)scale_factor);  //K13
-        RGB2YCC[1][0] = (s32) (-0.1006*(float)scale_factor);  //K21
-        RGB2YCC[1][1] = (s32) (-0.3386*(float)scale_factor);  //K22
-        RGB2YCC[1][2] = (s32) ( 0.4392*(float)scale_factor);  //K23
-        RGB2YCC[2][0] = (s32) ( 0.4392*(float)scale_factor);  //K31
-        RGB2YCC[2][1] = (s32) (-0.3989*(float)scale_factor);  //K32
-        RGB2YCC[2][2] = (s32) (-0.0403*(float)scale_factor);  //K33
-        RGB2YCC[0][3] =  16*bpcScale;                   //R Offset
-        RGB2YCC[1][3] =  128*bpcScale;                  //G Offset
-        RGB2YCC[2][3] =  128*bpcScale;                  //B Offset
-        break;
-
-    case XVIDC_BT_2020:
-        RGB2YCC[0][0] = (s32) ( 0.2256*(float)scale_factor);  //K11
-        RGB2YCC[0][1] = (s32) ( 0.5823*(float)scale_factor);  //K12
-        RGB2YCC[0][2] = (s32) ( 0.0509*(float)scale_factor);  //K13
-        RGB2YCC[1][0] = (s32) (-0.1227*(float)scale_factor);  //K21
-        RGB2YCC[1][1] = (s32) (-0.3166*(float)scale_factor);  //K22
-        RGB2YCC[1][2] = (s32) ( 0.4392*(float)scale_factor);  //K23
-        RGB2YCC[2][0] = (s32) ( 0.4392*(float)scale_factor);  //K31
-        RGB2YCC[2][1] = (s32) (-0.4039*(float)scale_factor);  //K32
-        RGB2YCC[2][2] = (s32) (-0.0353*(float)scale_factor);  //K33
-        RGB2YCC[0][3] =  16*bpcScale;                   //R Offset
-        RGB2YCC[1][3] =  128*bpcScale;                  //G Offset
-        RGB2YCC[2][3] =  128*bpcScale;                  //B Offset
-        break;
+    cstdOut = XVIDC_BT_601; //use 601 numbers
+  }
 
-    default:
-        RGB2YCC[0][0] = (s32) ( 0.2568*(float)scale_factor);  //K11
-        RGB2YCC[0][1] = (s32) ( 0.5041*(float)scale_factor);  //K12
-        RGB2YCC[0][2] = (s32) ( 0.0979*(float)scale_factor);  //K13
-        RGB2YCC[1][0] = (s32) (-0.1482*(float)scale_factor);  //K21
-        RGB2YCC[1][1] = (s32) (-0.2910*(float)scale_factor);  //K22
-        RGB2YCC[1][2] = (s32) ( 0.4393*(float)scale_factor);  //K23
-        RGB2YCC[2][0] = (s32) ( 0.4393*(float)scale_factor);  //K31
-        RGB2YCC[2][1] = (s32) (-0.3678*(float)scale_factor);  //K32
-        RGB2YCC[2][2] = (s32) (-0.0714*(float)scale_factor);  //K33
-        RGB2YCC[0][3] =  16*bpcScale;                   //R Offset
-        RGB2YCC[1][3] =  128*bpcScale;                  //G Offset
-        RGB2YCC[2][3] =  128*bpcScale;                  //B Offset
-        break;
+  for(x=0; x<3; ++x)
+  {
+    for(y=0; y<3; ++y)
+    {
+      RGB2YCC[x][y] = cscRGBtoYCbCrTbl[cstdOut][x][y];
+    }
+    RGB2YCC[x][3] = cscRGBtoYCbCrTbl[cstdOut][x][3]*bpcScale;
   }
 
   *ClampMin = 0;
@@ -681,8 +686,8 @@ static void cscFwSetActiveCoefficients(XV_csc_L2Reg *pCscFwReg, s32 K[3][4])
 void XV_CscSetBrightness(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 {
   XV_csc *pCsc = InstancePtr;
-  s32 K1[3][4], K2[3][4];
-  float brightness_f;
+  s32 K1[3][4];
+  u8 x;
 
   /*
    * Assert validates the input arguments
@@ -691,30 +696,26 @@ void XV_CscSetBrightness(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(pCscFwReg != NULL);
 
   pCscFwReg->Brightness = (val*2+20);
-  brightness_f = (float)(pCscFwReg->Brightness)/(float)(pCscFwReg->Brightness_active);
+  if(pCscFwReg->Brightness == pCscFwReg->Brightness_active)
+  {
+    return; //nothing to update
+  }
 
   //get active coefficient set in RGB
   cscFwGetActiveCoefficients(pCscFwReg, K1);
 
-  K2[0][0] = (s32) ((float) K1[0][0] * brightness_f);
-  K2[0][1] = (s32) ((float) K1[0][1] * brightness_f);
-  K2[0][2] = (s32) ((float) K1[0][2] * brightness_f);
-  K2[1][0] = (s32) ((float) K1[1][0] * brightness_f);
-  K2[1][1] = (s32) ((float) K1[1][1] * brightness_f);
-  K2[1][2] = (s32) ((float) K1[1][2] * brightness_f);
-  K2[2][0] = (s32) ((float) K1[2][0] * brightness_f);
-  K2[2][1] = (s32) ((float) K1[2][1] * brightness_f);
-  K2[2][2] = (s32) ((float) K1[2][2] * brightness_f);
-  K2[0][3] = K1[0][3];
-  K2[1][3] = K1[1][3];
-  K2[2][3] = K1[2][3];
+  for(x=0; x<3; ++x)
+  {
+    cscFwScaleRow(K1, x, pCscFwReg->Brightness,
+                  pCscFwReg->Brightness_active);
+  }
 
   //write new active coefficient set in RGB
-  cscFwSetActiveCoefficients(pCscFwReg, K2);
+  cscFwSetActiveCoefficients(pCscFwReg, K1);
   //write new active brightness value
   pCscFwReg->Brightness_active = pCscFwReg->Brightness;
 
-  cscFwComputeCoeff(pCscFwReg, K2);
+  cscFwComputeCoeff(pCscFwReg, K1);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
 
@@ -744,6 +745,10 @@ void XV_CscSetContrast(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(pCscFwReg != NULL);
 
   pCscFwReg->Contrast = val*4 - 200;
+  if(pCscFwReg->Contrast == pCscFwReg->Contrast_active)
+  {
+    return; //nothing to update
+  }
   contrast = (pCscFwReg->Contrast) - (pCscFwReg->Contrast_active);
 
   scale = (1<<(pCscFwReg->ColorDepth-8));
@@ -788,13 +793,9 @@ void XV_CscSetSaturation(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 {
   XV_csc *pCsc = InstancePtr;
   s32 x, y;
-  s32 K1[3][4], K2[3][4], K3[3][4], K4[3][4], M1[3][4], M2[3][4], Kout[3][4];
-  s32 ClampMin = 0;
-  s32 ClipMax, scale_factor;
-
-  float saturation_f;
-  float rwgt, gwgt, bwgt;
-  float a,b,c,d,e,f,g,h,i;
+  s32 K1[3][4], K2[3][4], K3[3][4];
+  s32 num, den, scale_factor;
+  const s32 wgt[3] = {XV_CSC_SAT_RWGT, XV_CSC_SAT_GWGT, XV_CSC_SAT_BWGT};
 
   /*
    * Assert validates the input arguments
@@ -802,44 +803,29 @@ void XV_CscSetSaturation(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(InstancePtr != NULL);
   Xil_AssertVoid(pCscFwReg != NULL);
 
-  ClipMax  = ((1<<pCscFwReg->ColorDepth)-1);
   scale_factor = (1<<XV_CSC_COEFF_FRACTIONAL_BITS);
 
   pCscFwReg->Saturation = ((val == 0) ? 1 : val*2);
-  saturation_f = (float)(pCscFwReg->Saturation)/(float)(pCscFwReg->Saturation_active);
+  if(pCscFwReg->Saturation == pCscFwReg->Saturation_active)
+  {
+    return; //nothing to update
+  }
+  num = pCscFwReg->Saturation;
+  den = pCscFwReg->Saturation_active;
 
   //get active coefficient set in RGB
   cscFwGetActiveCoefficients(pCscFwReg, K1);
 
-  rwgt = 0.3086f;
-  gwgt = 0.6094f;
-  bwgt = 0.0820f;
-  //rwgt = 0.299f;
-  //gwgt = 0.587f;
-  //bwgt = 0.114f;
-
-  a = ((1.0f - saturation_f) * rwgt + saturation_f);
-  b = ((1.0f - saturation_f) * rwgt);
-  c = ((1.0f - saturation_f) * rwgt);
-  d = ((1.0f - saturation_f) * gwgt);
-  e = ((1.0f - saturation_f) * gwgt + saturation_f);
-  f = ((1.0f - saturation_f) * gwgt);
-  g = ((1.0f - saturation_f) * bwgt);
-  h = ((1.0f - saturation_f) * bwgt);
-  i = ((1.0f - saturation_f) * bwgt + saturation_f);
-
-  K2[0][0]=(s32)(a*scale_factor);
-  K2[0][1]=(s32)(d*scale_factor);
-  K2[0][2]=(s32)(g*scale_factor);
-  K2[1][0]=(s32)(b*scale_factor);
-  K2[1][1]=(s32)(e*scale_factor);
-  K2[1][2]=(s32)(h*scale_factor);
-  K2[2][0]=(s32)(c*scale_factor);
-  K2[2][1]=(s32)(f*scale_factor);
-  K2[2][2]=(s32)(i*scale_factor);
-  K2[0][3] = 0;
-  K2[1][3] = 0;
-  K2[2][3] = 0;
+  //saturation matrix for s = num/den: (1-s)*weight, plus s on the diagonal
+  for(x=0; x<3; ++x)
+  {
+    for(y=0; y<3; ++y)
+    {
+      K2[x][y] = cscFwDivRound(((den-num)*wgt[y] +
+                                ((x == y) ? num*scale_factor : 0)), den);
+    }
+    K2[x][3] = 0;
+  }
 
   cscFwMatrixMult(K1, K2, K3);
 
@@ -848,37 +834,7 @@ void XV_CscSetSaturation(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   //write new active saturation value
   pCscFwReg->Saturation_active = pCscFwReg->Saturation;
 
-  if ((pCscFwReg->ColorFormatIn == XVIDC_CSF_RGB) &&
-      (pCscFwReg->ColorFormatOut == XVIDC_CSF_RGB) )
-  {
-    for (x=0; x<3; x++)  for (y=0; y<4; y++)
-      Kout[x][y] = K3[x][y];
-  }
-
-  if ((pCscFwReg->ColorFormatIn == XVIDC_CSF_RGB) &&
-      (pCscFwReg->ColorFormatOut == XVIDC_CSF_YCRCB_444) )
-  {
-    cscFwRGBtoYCbCr(M2, pCscFwReg->StandardOut, pCscFwReg->ColorDepth, &ClampMin, &ClipMax);
-    cscFwMatrixMult(K3, M2, Kout);
-  }
-
-  if ((pCscFwReg->ColorFormatIn == XVIDC_CSF_YCRCB_444) &&
-      (pCscFwReg->ColorFormatOut == XVIDC_CSF_RGB) )
-  {
-    cscFwYCbCrtoRGB(M1, pCscFwReg->StandardIn, pCscFwReg->ColorDepth, &ClampMin, &ClipMax);
-    cscFwMatrixMult(M1, K3, Kout);
-  }
-
-  if ((pCscFwReg->ColorFormatIn == XVIDC_CSF_YCRCB_444) &&
-      (pCscFwReg->ColorFormatOut == XVIDC_CSF_YCRCB_444) )
-  {
-    cscFwYCbCrtoRGB(M1, pCscFwReg->StandardIn, pCscFwReg->ColorDepth, &ClampMin, &ClipMax);
-    cscFwMatrixMult(M1, K3, K4);
-    cscFwRGBtoYCbCr(M2, pCscFwReg->StandardOut, pCscFwReg->ColorDepth, &ClampMin, &ClipMax);
-    cscFwMatrixMult(K4, M2, Kout);
-  }
-
-  cscFwSetCoefficients(pCscFwReg, Kout, ClampMin, ClipMax);
+  cscFwComputeCoeff(pCscFwReg, K3);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
 
@@ -897,8 +853,7 @@ void XV_CscSetSaturation(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 void XV_CscSetRedGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 {
   XV_csc *pCsc = InstancePtr;
-  s32 K1[3][4], K2[3][4];
-  float red_f;
+  s32 K1[3][4];
 
   /*
    * Assert validates the input arguments
@@ -907,30 +862,22 @@ void XV_CscSetRedGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(pCscFwReg != NULL);
 
   pCscFwReg->RedGain = (val*2+20);
-  red_f = (float)(pCscFwReg->RedGain)/(float)(pCscFwReg->RedGain_active);
+  if(pCscFwReg->RedGain == pCscFwReg->RedGain_active)
+  {
+    return; //nothing to update
+  }
 
   //get active coefficient set in RGB
   cscFwGetActiveCoefficients(pCscFwReg, K1);
 
-  K2[0][0] = (s32) ((float) K1[0][0] * red_f);
-  K2[0][1] = (s32) ((float) K1[0][1] * red_f);
-  K2[0][2] = (s32) ((float) K1[0][2] * red_f);
-  K2[1][0] = K1[1][0];
-  K2[1][1] = K1[1][1];
-  K2[1][2] = K1[1][2];
-  K2[2][0] = K1[2][0];
-  K2[2][1] = K1[2][1];
-  K2[2][2] = K1[2][2];
-  K2[0][3] = K1[0][3];
-  K2[1][3] = K1[1][3];
-  K2[2][3] = K1[2][3];
+  cscFwScaleRow(K1, 0, pCscFwReg->RedGain, pCscFwReg->RedGain_active);
 
   //write new active coefficient set in RGB
-  cscFwSetActiveCoefficients(pCscFwReg, K2);
+  cscFwSetActiveCoefficients(pCscFwReg, K1);
   //write new active red value
   pCscFwReg->RedGain_active = pCscFwReg->RedGain;
 
-  cscFwComputeCoeff(pCscFwReg, K2);
+  cscFwComputeCoeff(pCscFwReg, K1);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
 
@@ -949,8 +896,7 @@ void XV_CscSetRedGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 void XV_CscSetGreenGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 {
   XV_csc *pCsc = InstancePtr;
-  s32 K1[3][4], K2[3][4];
-  float green_f;
+  s32 K1[3][4];
 
   /*
    * Assert validates the input arguments
@@ -959,30 +905,22 @@ void XV_CscSetGreenGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(pCscFwReg != NULL);
 
   pCscFwReg->GreenGain = (val*2+20);
-  green_f = (float)(pCscFwReg->GreenGain)/(float)(pCscFwReg->GreenGain_active);
+  if(pCscFwReg->GreenGain == pCscFwReg->GreenGain_active)
+  {
+    return; //nothing to update
+  }
 
   //get active coefficient set in RGB
   cscFwGetActiveCoefficients(pCscFwReg, K1);
 
-  K2[0][0] = K1[0][0];
-  K2[0][1] = K1[0][1];
-  K2[0][2] = K1[0][2];
-  K2[1][0] = (s32) ((float) K1[1][0] * green_f);
-  K2[1][1] = (s32) ((float) K1[1][1] * green_f);
-  K2[1][2] = (s32) ((float) K1[1][2] * green_f);
-  K2[2][0] = K1[2][0];
-  K2[2][1] = K1[2][1];
-  K2[2][2] = K1[2][2];
-  K2[0][3] = K1[0][3];
-  K2[1][3] = K1[1][3];
-  K2[2][3] = K1[2][3];
+  cscFwScaleRow(K1, 1, pCscFwReg->GreenGain, pCscFwReg->GreenGain_active);
 
   //write new active coefficient set in RGB
-  cscFwSetActiveCoefficients(pCscFwReg, K2);
+  cscFwSetActiveCoefficients(pCscFwReg, K1);
   //write new active green value
   pCscFwReg->GreenGain_active = pCscFwReg->GreenGain;
 
-  cscFwComputeCoeff(pCscFwReg, K2);
+  cscFwComputeCoeff(pCscFwReg, K1);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
 
@@ -1001,8 +939,7 @@ void XV_CscSetGreenGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 void XV_CscSetBlueGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
 {
   XV_csc *pCsc = InstancePtr;
-  s32 K1[3][4], K2[3][4];
-  float blue_f;
+  s32 K1[3][4];
 
   /*
    * Assert validates the input arguments
@@ -1011,30 +948,22 @@ void XV_CscSetBlueGain(XV_csc *InstancePtr, XV_csc_L2Reg *pCscFwReg, s32 val)
   Xil_AssertVoid(pCscFwReg != NULL);
 
   pCscFwReg->BlueGain = (val*2+20);
-  blue_f = (float)(pCscFwReg->BlueGain)/(float)(pCscFwReg->BlueGain_active);
+  if(pCscFwReg->BlueGain == pCscFwReg->BlueGain_active)
+  {
+    return; //nothing to update
+  }
 
   //get active coefficient set in RGB
   cscFwGetActiveCoefficients(pCscFwReg, K1);
 
-  K2[0][0] = K1[0][0];
-  K2[0][1] = K1[0][1];
-  K2[0][2] = K1[0][2];
-  K2[1][0] = K1[1][0];
-  K2[1][1] = K1[1][1];
-  K2[1][2] = K1[1][2];
-  K2[2][0] = (s32) ((float) K1[2][0] * blue_f);
-  K2[2][1] = (s32) ((float) K1[2][1] * blue_f);
-  K2[2][2] = (s32) ((float) K1[2][2] * blue_f);
-  K2[0][3] = K1[0][3];
-  K2[1][3] = K1[1][3];
-  K2[2][3] = K1[2][3];
+  cscFwScaleRow(K1, 2, pCscFwReg->BlueGain, pCscFwReg->BlueGain_active);
 
   //write new active coefficient set in RGB
-  cscFwSetActiveCoefficients(pCscFwReg, K2);
+  cscFwSetActiveCoefficients(pCscFwReg, K1);
   //write new active blue value
   pCscFwReg->BlueGain_active = pCscFwReg->BlueGain;
 
-  cscFwComputeCoeff(pCscFwReg, K2);
+  cscFwComputeCoeff(pCscFwReg, K1);
   cscUpdateIPReg(pCsc, pCscFwReg, UPD_REG_DEMO_WIN);
 }
 
@@ -1133,7 +1062,47 @@ static void cscFwMatrixMult(s32 K1[3][4], s32 K2[3][4], s32 Kout[3][4])
 
 /*****************************************************************************/
 /**
-* Write computed coefficients to IP HW registers
+* This function scales the coefficients of one matrix row by num/den. The
+* offset of the row is left as-is. (Utility function)
+*
+* @param  K is the matrix to update
+* @param  row is the row to scale
+* @param  num is the numerator of the scale factor
+* @param  den is the denominator of the scale factor
+*
+* @return None
+*
+******************************************************************************/
+static void cscFwScaleRow(s32 K[3][4], u8 row, s32 num, s32 den)
+{
+  u8 y;
+
+  for(y=0; y<3; ++y)
+  {
+    K[row][y] = (K[row][y]*num)/den;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function divides num by den and rounds the result to the nearest
+* integer, halves away from zero. (Utility function)
+*
+* @param  num is the dividend
+* @param  den is the divisor, must be positive
+*
+* @return Rounded quotient
+*
+******************************************************************************/
+static s32 cscFwDivRound(s32 num, s32 den)
+{
+  return ((num < 0) ? -((-num + den/2)/den) : ((num + den/2)/den));
+}
+
+/*****************************************************************************/
+/**
+* Write computed coefficients to IP HW registers. Only the coefficients that
+* changed since they were last written are sent to the core
 *
 * @param  pCsc is pointer to csc core instance
 * @param  pCscFwReg is a pointer to layer 2 fw register bank
@@ -1146,74 +1115,32 @@ static void cscUpdateIPReg(XV_csc *pCsc,
                            XV_csc_L2Reg *pCscFwReg,
                            XV_CSC_REG_UPDT_WIN win)
 {
-  u8 x,y;
-  s32 K[3][4];
-  u32 clampMin, clipMax;
+  u32 offset, first, last;
 
   switch(win)
   {
     case UPDT_REG_FULL_FRAME:
-        for(x=0; x<3; ++x)
-        {
-          for(y=0; y<3; ++y)
-          {
-            K[x][y] = cscFw_RegR(pCscFwReg, (x*3+y)+CSC_FW_REG_K11);
-          }
-        }
-        K[0][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_ROffset);
-        K[1][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_GOffset);
-        K[2][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_BOffset);
-        clampMin = cscFw_RegR(pCscFwReg, CSC_FW_REG_ClampMin);
-        clipMax  = cscFw_RegR(pCscFwReg, CSC_FW_REG_ClipMax);
-
-        XV_csc_Set_HwReg_K11(pCsc, K[0][0]);
-        XV_csc_Set_HwReg_K12(pCsc, K[0][1]);
-        XV_csc_Set_HwReg_K13(pCsc, K[0][2]);
-        XV_csc_Set_HwReg_K21(pCsc, K[1][0]);
-        XV_csc_Set_HwReg_K22(pCsc, K[1][1]);
-        XV_csc_Set_HwReg_K23(pCsc, K[1][2]);
-        XV_csc_Set_HwReg_K31(pCsc, K[2][0]);
-        XV_csc_Set_HwReg_K32(pCsc, K[2][1]);
-        XV_csc_Set_HwReg_K33(pCsc, K[2][2]);
-        XV_csc_Set_HwReg_ROffset_V(pCsc,  K[0][3]);
-        XV_csc_Set_HwReg_GOffset_V(pCsc,  K[1][3]);
-        XV_csc_Set_HwReg_BOffset_V(pCsc,  K[2][3]);
-        XV_csc_Set_HwReg_ClampMin_V(pCsc, clampMin);
-        XV_csc_Set_HwReg_ClipMax_V(pCsc,  clipMax);
+        first = CSC_FW_REG_K11;
+        last  = CSC_FW_REG_ClipMax;
         break;
 
     case UPD_REG_DEMO_WIN:
-        for(x=0; x<3; ++x)
-        {
-          for(y=0; y<3; ++y)
-          {
-            K[x][y] = cscFw_RegR(pCscFwReg, (x*3+y)+CSC_FW_REG_K11_2);
-          }
-        }
-        K[0][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_ROffset_2);
-        K[1][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_GOffset_2);
-        K[2][3] = cscFw_RegR(pCscFwReg, CSC_FW_REG_BOffset_2);
-        clampMin = cscFw_RegR(pCscFwReg, CSC_FW_REG_ClampMin_2);
-        clipMax  = cscFw_RegR(pCscFwReg, CSC_FW_REG_ClipMax_2);
-
-        XV_csc_Set_HwReg_K11_2(pCsc, K[0][0]);
-        XV_csc_Set_HwReg_K12_2(pCsc, K[0][1]);
-        XV_csc_Set_HwReg_K13_2(pCsc, K[0][2]);
-        XV_csc_Set_HwReg_K21_2(pCsc, K[1][0]);
-        XV_csc_Set_HwReg_K22_2(pCsc, K[1][1]);
-        XV_csc_Set_HwReg_K23_2(pCsc, K[1][2]);
-        XV_csc_Set_HwReg_K31_2(pCsc, K[2][0]);
-        XV_csc_Set_HwReg_K32_2(pCsc, K[2][1]);
-        XV_csc_Set_HwReg_K33_2(pCsc, K[2][2]);
-        XV_csc_Set_HwReg_ROffset_2_V(pCsc,  K[0][3]);
-        XV_csc_Set_HwReg_GOffset_2_V(pCsc,  K[1][3]);
-        XV_csc_Set_HwReg_BOffset_2_V(pCsc,  K[2][3]);
-        XV_csc_Set_HwReg_ClampMin_2_V(pCsc, clampMin);
-        XV_csc_Set_HwReg_ClipMax_2_V(pCsc,  clipMax);
+        first = CSC_FW_REG_K11_2;
+        last  = CSC_FW_REG_ClipMax_2;
         break;
 
     default:
-        break;
+        return;
+  }
+
+  for(offset=first; offset<=last; ++offset)
+  {
+    if(pCscFwReg->regDirty & ((u32)1<<offset))
+    {
+      cscHwRegWr[offset-CSC_FW_REG_K11](pCsc,
+                                         cscFw_RegR(pCscFwReg, offset));
+      pCscFwReg->regDirty &= ~((u32)1<<offset);
+    }
   }
 }
 
@@ -99,6 +99,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Added regDirty to XV_csc_L2Reg so that only changed
+*                        coefficients are written to the core
 
 * </pre>
 *
@@ -183,6 +185,7 @@ typedef struct
   s32 K_active[3][4];
 
   s32 regMap[CSC_FW_NUM_REGS];
+  u32 regDirty; /* 1 bit per regMap entry not yet written to the core */
 }XV_csc_L2Reg;
 
 /************************** Macros Definitions *******************************/
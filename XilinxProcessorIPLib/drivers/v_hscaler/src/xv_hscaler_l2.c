@@ -48,6 +48,9 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Cache phase register images per scaling mode (2 by
+*                        default) and write only changed phase/coefficient
+*                        registers
 
 * </pre>
 *
@@ -89,8 +92,19 @@ static void CalculatePhases(XV_hscaler *pHsc,
 static void XV_HScalerSetCoeff(XV_hscaler *pHsc,
                                XV_hscaler_l2 *HscL2DataPtr);
 
+static u32 XV_HScalerGetPhases(XV_hscaler *pHsc,
+                               XV_hscaler_l2 *HscL2DataPtr,
+                               u32 WidthIn,
+                               u32 WidthOut,
+                               u32 PixelRate);
+
+static void XV_HScalerPackPhase(XV_hscaler *pHsc,
+                                XV_hscaler_l2 *HscL2DataPtr,
+                                u32 *Regs);
+
 static void XV_HScalerSetPhase(XV_hscaler *pHsc,
-                               XV_hscaler_l2 *HscL2DataPtr);
+                               XV_hscaler_l2 *HscL2DataPtr,
+                               u32 Entry);
 
 /*****************************************************************************/
 /**
@@ -238,11 +252,16 @@ static void XV_HScalerSelectCoeff(XV_hscaler *InstancePtr,
 	numTaps = XV_HSCALER_TAPS_6;
   }
 
-  XV_HScalerLoadExtCoeff(InstancePtr,
-			             HscL2DataPtr,
-		                 numPhases,
-		                 numTaps,
-		                 coeff);
+  /* Table is already in layer 2 data since the last mode switch */
+  if(coeff != HscL2DataPtr->CoeffTable)
+  {
+    XV_HScalerLoadExtCoeff(InstancePtr,
+			               HscL2DataPtr,
+		                   numPhases,
+		                   numTaps,
+		                   coeff);
+    HscL2DataPtr->CoeffTable = coeff;
+  }
 
   /* Disable use of external coefficients */
   HscL2DataPtr->UseExtCoeff = FALSE;
@@ -324,6 +343,7 @@ void XV_HScalerLoadExtCoeff(XV_hscaler *InstancePtr,
 
   /* Enable use of external coefficients */
   HscL2DataPtr->UseExtCoeff = TRUE;
+  HscL2DataPtr->CoeffTable = NULL;
 }
 
 /*****************************************************************************/
@@ -414,30 +434,86 @@ static void CalculatePhases(XV_hscaler *pHsc,
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function looks up the phase register image of a scaling mode in the
+* phase cache. On a miss the phases are computed for 1 line and packed into
+* the next entry in turn, skipping the entry held by the core so that it can
+* still be used as reference for the register writes
 *
-* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  pHsc is a pointer to the core instance to be worked on.
 * @param  HscL2DataPtr is a pointer to the core instance layer 2 data.
+* @param  WidthIn is the input frame width
+* @param  WidthOut is the scaled frame width
+* @param  PixelRate is the scaling step computed from the widths
+*
+* @return Index of the cache entry holding the image
+*
+******************************************************************************/
+static u32 XV_HScalerGetPhases(XV_hscaler *pHsc,
+                               XV_hscaler_l2 *HscL2DataPtr,
+                               u32 WidthIn,
+                               u32 WidthOut,
+                               u32 PixelRate)
+{
+  XV_hscaler_PhaseCacheEntry *EntryPtr;
+  u32 i, Victim;
+
+  for(i=0; i < XV_HSCALER_PHASE_CACHE_SIZE; i++)
+  {
+    EntryPtr = &HscL2DataPtr->PhaseCache[i];
+    if((EntryPtr->WidthIn == WidthIn) && (EntryPtr->WidthOut == WidthOut))
+    {
+      return(i);
+    }
+  }
+
+  Victim = HscL2DataPtr->PhaseNext % XV_HSCALER_PHASE_CACHE_SIZE;
+  if((XV_HSCALER_PHASE_CACHE_SIZE > 1) &&
+     HscL2DataPtr->PhaseRegsValid && (Victim == HscL2DataPtr->PhaseCurr))
+  {
+    Victim = (Victim + 1) % XV_HSCALER_PHASE_CACHE_SIZE;
+  }
+  HscL2DataPtr->PhaseNext = (u8)((Victim + 1) % XV_HSCALER_PHASE_CACHE_SIZE);
+
+  /* Image in the core can no longer be used as reference if overwritten */
+  if(Victim == HscL2DataPtr->PhaseCurr)
+  {
+    HscL2DataPtr->PhaseRegsValid = FALSE;
+  }
+
+  /* Compute Phase for 1 line */
+  CalculatePhases(pHsc, HscL2DataPtr, WidthIn, WidthOut, PixelRate);
+
+  EntryPtr = &HscL2DataPtr->PhaseCache[Victim];
+  XV_HScalerPackPhase(pHsc, HscL2DataPtr, EntryPtr->Regs);
+  EntryPtr->WidthIn  = (u16)WidthIn;
+  EntryPtr->WidthOut = (u16)WidthOut;
+
+  return(Victim);
+}
+
+/*****************************************************************************/
+/**
+* This function packs the phase data into the words written to core registers
+*
+* @param  pHsc is a pointer to the core instance to be worked on.
+* @param  HscL2DataPtr is a pointer to the core instance layer 2 data.
+* @param  Regs is the array filled with MaxWidth/2 register words
 *
 * @return None
 *
-* @Note  This version of driver does not make use of computed coefficients.
-*        User must load the coefficients, using the provided API, before
-*        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_hscaler *pHsc,
-                               XV_hscaler_l2 *HscL2DataPtr)
+static void XV_HScalerPackPhase(XV_hscaler *pHsc,
+                                XV_hscaler_l2 *HscL2DataPtr,
+                                u32 *Regs)
 {
-  u32 baseAddr, loopWidth;
+  u32 loopWidth;
 
-  //program phases
-  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(pHsc);
   loopWidth = pHsc->Config.MaxWidth/pHsc->Config.PixPerClk;
   switch(pHsc->Config.PixPerClk)
   {
     case XVIDC_PPC_1:
             {
-              u32 val, lsb, msb, index, i;
+              u32 lsb, msb, index, i;
 
               /* PhaseH is 64bits but only lower 16b of each entry is valid
                * Form 32b word with 16bit LSB from 2 consecutive entries
@@ -449,8 +525,7 @@ static void XV_HScalerSetPhase(XV_hscaler *pHsc,
               {
                 lsb = (u32)(HscL2DataPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscL2DataPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
-                val = (msb<<16 | lsb);
-                Xil_Out32(baseAddr+(index*4), val);
+                Regs[index] = (msb<<16 | lsb);
                 ++index;
               }
             }
@@ -458,39 +533,34 @@ static void XV_HScalerSetPhase(XV_hscaler *pHsc,
 
     case XVIDC_PPC_2:
             {
-              u32 val, i;
+              u32 i;
 
               /* PhaseH is 64bits but only lower 32b of each entry is valid
                * Need 1 32b write to get each entry into IP registers
                */
               for(i=0; i < loopWidth; ++i)
               {
-                val = (u32)(HscL2DataPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(i*4), val);
+                Regs[i] = (u32)(HscL2DataPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
               }
             }
             break;
 
     case XVIDC_PPC_4:
             {
-              u32 lsb, msb, index, offset, i;
-			  u64 phaseHData;
+              u32 offset, i;
+              u64 phaseHData;
 
               /* PhaseH is 64bits and each entry has valid 32b MSB & LSB
                * Need 2 32b writes to get each entry into IP registers
-               * (index is array loc and offset is address offset)
+               * (i is array loc and offset is address offset)
                */
-              index = 0;
-			  offset = 0;
+              offset = 0;
               for(i=0; i < loopWidth; ++i)
               {
-			    phaseHData = HscL2DataPtr->phasesH[index];
-                lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
-                msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(offset*4), lsb);
-                Xil_Out32(baseAddr+((offset+1)*4), msb);
-                ++index;
-				offset += 2;
+                phaseHData = HscL2DataPtr->phasesH[i];
+                Regs[offset]   = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
+                Regs[offset+1] = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
+                offset += 2;
               }
             }
             break;
@@ -500,6 +570,51 @@ static void XV_HScalerSetPhase(XV_hscaler *pHsc,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function programs the phase data of a phase cache entry into core
+* registers. If the core holds the image of another cache entry only the
+* words that differ are written
+*
+* @param  pHsc is a pointer to the core instance to be worked on.
+* @param  HscL2DataPtr is a pointer to the core instance layer 2 data.
+* @param  Entry is the index of the phase cache entry to program
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerSetPhase(XV_hscaler *pHsc,
+                               XV_hscaler_l2 *HscL2DataPtr,
+                               u32 Entry)
+{
+  const u32 *NewRegs = HscL2DataPtr->PhaseCache[Entry].Regs;
+  const u32 *OldRegs = NULL;
+  u32 baseAddr, numRegs, i;
+
+  if(HscL2DataPtr->PhaseRegsValid)
+  {
+    if(HscL2DataPtr->PhaseCurr == Entry)
+    {
+      /* Core already holds the phases of this mode */
+      return;
+    }
+    OldRegs = HscL2DataPtr->PhaseCache[HscL2DataPtr->PhaseCurr].Regs;
+  }
+
+  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(pHsc);
+  numRegs = pHsc->Config.MaxWidth/2;
+  for(i=0; i < numRegs; i++)
+  {
+    if((OldRegs == NULL) || (OldRegs[i] != NewRegs[i]))
+    {
+      Xil_Out32(baseAddr+(i*4), NewRegs[i]);
+    }
+  }
+
+  HscL2DataPtr->PhaseCurr = (u8)Entry;
+  HscL2DataPtr->PhaseRegsValid = TRUE;
+}
+
 
 /*****************************************************************************/
 /**
@@ -520,7 +635,7 @@ static void XV_HScalerSetCoeff(XV_hscaler *pHsc,
 {
   int num_phases = 1<<pHsc->Config.PhaseShift;
   int num_taps   = pHsc->Config.NumTaps/2;
-  int val,i,j,offset,rdIndx;
+  int val,i,j,offset,rdIndx,regIndx;
   u32 baseAddr;
 
   offset = (XV_HSCALER_MAX_H_TAPS - pHsc->Config.NumTaps)/2;
@@ -531,9 +646,17 @@ static void XV_HScalerSetCoeff(XV_hscaler *pHsc,
     {
        rdIndx = j*2+offset;
        val = (HscL2DataPtr->coeff[i][rdIndx+1] << 16) | (HscL2DataPtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
-       Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       regIndx = i*num_taps+j;
+       /* Write only the registers which differ from the shadow */
+       if(!HscL2DataPtr->CoeffRegsValid ||
+          (HscL2DataPtr->CoeffRegs[regIndx] != (u32)val))
+       {
+         Xil_Out32(baseAddr+(regIndx*4), val);
+         HscL2DataPtr->CoeffRegs[regIndx] = (u32)val;
+       }
     }
   }
+  HscL2DataPtr->CoeffRegsValid = TRUE;
 }
 
 /*****************************************************************************/
@@ -559,6 +682,7 @@ void XV_HScalerSetup(XV_hscaler  *InstancePtr,
                      u32 cformat)
 {
   u32 PixelRate;
+  u32 PhaseEntry;
 
   /*
    * Assert validates the input arguments
@@ -587,11 +711,15 @@ void XV_HScalerSetup(XV_hscaler  *InstancePtr,
     XV_HScalerSetCoeff(InstancePtr, HscL2DataPtr);
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, HscL2DataPtr, WidthIn, WidthOut, PixelRate);
+  /* Get Phase for 1 line, computed only if not cached for this mode */
+  PhaseEntry = XV_HScalerGetPhases(InstancePtr,
+                                   HscL2DataPtr,
+                                   WidthIn,
+                                   WidthOut,
+                                   PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr, HscL2DataPtr);
+  /* Program Phase into the IP register bank */
+  XV_HScalerSetPhase(InstancePtr, HscL2DataPtr, PhaseEntry);
 
   XV_hscaler_Set_HwReg_Height(InstancePtr,     HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(InstancePtr,    WidthIn);
@@ -601,6 +729,32 @@ void XV_HScalerSetup(XV_hscaler  *InstancePtr,
 }
 
 
+/*****************************************************************************/
+/**
+* This function empties the phase cache and forgets the register contents
+* assumed to be in the core, so the next setup programs all registers.
+* Call it if the core has been reset or reloaded
+*
+* @param  HscL2DataPtr is a pointer to the core instance layer 2 data.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerInvalidateCache(XV_hscaler_l2 *HscL2DataPtr)
+{
+  u32 i;
+
+  Xil_AssertVoid(HscL2DataPtr != NULL);
+
+  for(i=0; i < XV_HSCALER_PHASE_CACHE_SIZE; i++)
+  {
+    HscL2DataPtr->PhaseCache[i].WidthIn = 0;
+  }
+  HscL2DataPtr->PhaseNext = 0;
+  HscL2DataPtr->PhaseRegsValid = FALSE;
+  HscL2DataPtr->CoeffRegsValid = FALSE;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -100,6 +100,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Cache phase register images per scaling mode and
+*                        write only changed phase/coefficient registers
 
 * </pre>
 *
@@ -123,6 +125,21 @@ extern "C" {
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (3840)
 
+/** @name Register Cache
+ * @{
+ * Number of line phase register images kept in layer 2 data, one per
+ * (WidthIn, WidthOut) mode. Each entry takes XV_HSCALER_MAX_PHASE_REGS
+ * words. 2 entries cover switching back and forth between two modes, 1
+ * only skips reprogramming an unchanged mode
+ */
+#ifndef XV_HSCALER_PHASE_CACHE_SIZE
+#define XV_HSCALER_PHASE_CACHE_SIZE     (2)
+#endif
+#define XV_HSCALER_MAX_PHASE_REGS       (XV_HSCALER_MAX_LINE_WIDTH/2)
+#define XV_HSCALER_MAX_COEFF_REGS       (XV_HSCALER_MAX_H_PHASES * \
+                                         XV_HSCALER_MAX_H_TAPS/2)
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef enumerates the Scaler Type
@@ -145,16 +162,34 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * Phase register image computed for one scaling mode
+ */
+typedef struct
+{
+  u16 WidthIn;     /**< Key: input width, 0 if the entry is empty */
+  u16 WidthOut;    /**< Key: output width */
+  u32 Regs[XV_HSCALER_MAX_PHASE_REGS]; /**< Words to program */
+}XV_hscaler_PhaseCacheEntry;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
  * variable of this type is then passed to the driver API functions.
+ * The variable must be zero initialized before first use.
  */
 typedef struct
 {
   u8 UseExtCoeff;
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
+  const short *CoeffTable; /**< Fixed table loaded in coeff, NULL if none */
+  u8  CoeffRegsValid;      /**< CoeffRegs matches the core registers */
+  u8  PhaseRegsValid;      /**< PhaseCache[PhaseCurr] is in the core */
+  u8  PhaseCurr;           /**< Entry last programmed into the core */
+  u8  PhaseNext;           /**< Entry replaced on the next cache miss */
+  u32 CoeffRegs[XV_HSCALER_MAX_COEFF_REGS]; /**< Shadow of coeff registers */
+  XV_hscaler_PhaseCacheEntry PhaseCache[XV_HSCALER_PHASE_CACHE_SIZE];
 }XV_hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -174,6 +209,8 @@ void XV_HScalerSetup(XV_hscaler  *InstancePtr,
                      u32 WidthOut,
                      u32 cformat);
 
+void XV_HScalerInvalidateCache(XV_hscaler_l2 *HscL2DataPtr);
+
 void XV_HScalerDbgReportStatus(XV_hscaler *InstancePtr);
 
 #ifdef __cplusplus
@@ -48,6 +48,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Skip reloading an unchanged coefficient table and
+*                        write only changed coefficient registers
 
 * </pre>
 *
@@ -224,11 +226,16 @@ static void XV_VScalerSelectCoeff(XV_vscaler *InstancePtr,
     numTaps = XV_VSCALER_TAPS_6;
   }
 
-  XV_VScalerLoadExtCoeff(InstancePtr,
-		                 VscL2DataPtr,
-		                 numPhases,
-		                 numTaps,
-		                 coeff);
+  /* Table is already in layer 2 data since the last mode switch */
+  if(coeff != VscL2DataPtr->CoeffTable)
+  {
+    XV_VScalerLoadExtCoeff(InstancePtr,
+		                   VscL2DataPtr,
+		                   numPhases,
+		                   numTaps,
+		                   coeff);
+    VscL2DataPtr->CoeffTable = coeff;
+  }
 
   /* Disable use of external coefficients */
   VscL2DataPtr->UseExtCoeff = FALSE;
@@ -310,6 +317,7 @@ void XV_VScalerLoadExtCoeff(XV_vscaler *InstancePtr,
 
   /* Enable use of external coefficients */
   VscL2DataPtr->UseExtCoeff = TRUE;
+  VscL2DataPtr->CoeffTable = NULL;
 }
 
 /*****************************************************************************/
@@ -334,7 +342,7 @@ static void XV_VScalerSetCoeff(XV_vscaler *pVsc,
 {
   int num_phases = 1<<pVsc->Config.PhaseShift;
   int num_taps   = pVsc->Config.NumTaps/2;
-  int val,i,j,offset,rdIndx;
+  int val,i,j,offset,rdIndx,regIndx;
   u32 baseAddr;
 
   offset = (XV_VSCALER_MAX_V_TAPS - pVsc->Config.NumTaps)/2;
@@ -345,9 +353,17 @@ static void XV_VScalerSetCoeff(XV_vscaler *pVsc,
     {
        rdIndx = j*2+offset;
        val = (VscL2DataPtr->coeff[i][rdIndx+1] << 16) | (VscL2DataPtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
-       Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       regIndx = i*num_taps+j;
+       /* Write only the registers which differ from the shadow */
+       if(!VscL2DataPtr->CoeffRegsValid ||
+          (VscL2DataPtr->CoeffRegs[regIndx] != (u32)val))
+       {
+         Xil_Out32(baseAddr+(regIndx*4), val);
+         VscL2DataPtr->CoeffRegs[regIndx] = (u32)val;
+       }
     }
   }
+  VscL2DataPtr->CoeffRegsValid = TRUE;
 }
 
 /*****************************************************************************/
@@ -405,6 +421,24 @@ void XV_VScalerSetup(XV_vscaler  *InstancePtr,
   XV_vscaler_Set_HwReg_LineRate(InstancePtr,   LineRate);
 }
 
+/*****************************************************************************/
+/**
+* This function forgets the coefficient register contents assumed to be in
+* the core, so the next setup programs all coefficient registers.
+* Call it if the core has been reset or reloaded
+*
+* @param  VscL2DataPtr is a pointer to the core instance layer 2 data.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerInvalidateCache(XV_vscaler_l2 *VscL2DataPtr)
+{
+  Xil_AssertVoid(VscL2DataPtr != NULL);
+
+  VscL2DataPtr->CoeffRegsValid = FALSE;
+}
+
 /*****************************************************************************/
 /**
 *
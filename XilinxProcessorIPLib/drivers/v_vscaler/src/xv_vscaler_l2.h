@@ -99,6 +99,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Skip reloading an unchanged coefficient table and
+*                        write only changed coefficient registers
 
 * </pre>
 *
@@ -121,6 +123,8 @@ extern "C" {
   */
  #define XV_VSCALER_MAX_V_TAPS           (12)
  #define XV_VSCALER_MAX_V_PHASES         (64)
+ #define XV_VSCALER_MAX_COEFF_REGS       (XV_VSCALER_MAX_V_PHASES * \
+                                          XV_VSCALER_MAX_V_TAPS/2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -148,11 +152,15 @@ typedef enum
  * V Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every V Scaler device in the system. A pointer to a
  * variable of this type is then passed to the driver API functions.
+ * The variable must be zero initialized before first use.
  */
 typedef struct
 {
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffTable; /**< Fixed table loaded in coeff, NULL if none */
+  u8  CoeffRegsValid;      /**< CoeffRegs matches the core registers */
+  u32 CoeffRegs[XV_VSCALER_MAX_COEFF_REGS]; /**< Shadow of coeff registers */
 }XV_vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -171,6 +179,8 @@ void XV_VScalerSetup(XV_vscaler *InstancePtr,
                      u32 HeightIn,
                      u32 HeightOut);
 
+void XV_VScalerInvalidateCache(XV_vscaler_l2 *VscL2DataPtr);
+
 void XV_VScalerDbgReportStatus(XV_vscaler *InstancePtr);
 
 #ifdef __cplusplus
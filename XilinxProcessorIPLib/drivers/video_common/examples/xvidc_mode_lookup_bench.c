@@ -0,0 +1,366 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_mode_lookup_bench.c
+ *
+ * Contains a benchmark and consistency check of the video mode lookup
+ * functions. Every mode of the video timing table is looked up by resolution
+ * (XVidC_GetVideoModeId) and by totals and pixel clock
+ * (XVidC_GetVideoModeIdByTotals). Results are checked against a linear scan of
+ * the table and the time per lookup of both methods is reported.
+ *
+ * The example has no hardware dependency and may be built on the host:
+ *	gcc -O2 -fcommon -I../src -I<standalone bsp>/src/common
+ *		xvidc_mode_lookup_bench.c ../src/xvidc.c
+ *		../src/xvidc_timings_table.c -o xvidc_mode_lookup_bench
+ * with xil_printf mapped to printf if the bsp is not linked.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 2.1   ms   10/19/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "xstatus.h"
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_BENCH_LOOPS	20000	/**< Lookups of every mode per run. */
+
+/**************************** Function Prototypes *****************************/
+
+static XVidC_VideoMode Bench_LinearByRes(u32 Width, u32 Height, u32 FrameRate,
+					u8 IsInterlaced);
+static XVidC_VideoMode Bench_LinearByTotals(u32 HTotal, u32 VTotal,
+					u32 FrameRate, u8 IsInterlaced);
+static u32 Bench_GetVTotal(const XVidC_VideoTimingMode *VmPtr);
+static int Bench_CheckModes(void);
+static void Bench_Run(void);
+
+/*************************** Variable Definitions *****************************/
+
+/* Keeps lookup results alive so the compiler does not drop the loops. */
+static volatile u32 Bench_Sink;
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function is the main entry point of the benchmark.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if all lookups returned the expected mode.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	printf("Video mode lookup benchmark, %d modes\r\n",
+						(int)XVIDC_VM_NUM_SUPPORTED);
+
+	Status = Bench_CheckModes();
+	if (Status != XST_SUCCESS) {
+		printf("Mode lookup check FAILED\r\n");
+		return XST_FAILURE;
+	}
+	printf("Mode lookup check passed\r\n");
+
+	Bench_Run();
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the vertical total of a frame, summing both fields of
+ * interlaced modes.
+ *
+ * @param	VmPtr is a pointer to the video timing table entry.
+ *
+ * @return	Vertical total.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 Bench_GetVTotal(const XVidC_VideoTimingMode *VmPtr)
+{
+	return VmPtr->Timing.F0PVTotal + VmPtr->Timing.F1VTotal;
+}
+
+/******************************************************************************/
+/**
+ * This function is the reference lookup by resolution, scanning the whole
+ * video timing table.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is flag.
+ *
+ * @return	Id of the first matching video mode.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode Bench_LinearByRes(u32 Width, u32 Height, u32 FrameRate,
+					u8 IsInterlaced)
+{
+	u32 Index;
+	const XVidC_VideoTimingMode *VmPtr;
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VmPtr = &XVidC_VideoTimingModes[Index];
+		if ((VmPtr->Timing.HActive == Width) &&
+			(VmPtr->Timing.VActive == Height) &&
+			((u32)VmPtr->FrameRate == FrameRate) &&
+			(XVidC_IsInterlaced((XVidC_VideoMode)Index) ==
+							IsInterlaced)) {
+			return (XVidC_VideoMode)Index;
+		}
+	}
+
+	return XVIDC_VM_NOT_SUPPORTED;
+}
+
+/******************************************************************************/
+/**
+ * This function is the reference lookup by totals, scanning the whole video
+ * timing table.
+ *
+ * @param	HTotal specifies horizontal total.
+ * @param	VTotal specifies vertical total of a frame.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is flag.
+ *
+ * @return	Id of the first matching video mode.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode Bench_LinearByTotals(u32 HTotal, u32 VTotal,
+					u32 FrameRate, u8 IsInterlaced)
+{
+	u32 Index;
+	const XVidC_VideoTimingMode *VmPtr;
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VmPtr = &XVidC_VideoTimingModes[Index];
+		if ((VmPtr->Timing.HTotal == HTotal) &&
+			(Bench_GetVTotal(VmPtr) == VTotal) &&
+			((u32)VmPtr->FrameRate == FrameRate) &&
+			(XVidC_IsInterlaced((XVidC_VideoMode)Index) ==
+							IsInterlaced)) {
+			return (XVidC_VideoMode)Index;
+		}
+	}
+
+	return XVIDC_VM_NOT_SUPPORTED;
+}
+
+/******************************************************************************/
+/**
+ * This function checks that both lookups return the same mode as a linear scan
+ * for every mode of the video timing table, and that unknown timings are
+ * rejected.
+ *
+ * @param	None.
+ *
+ * @return
+ *		- XST_SUCCESS if all lookups returned the expected mode.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int Bench_CheckModes(void)
+{
+	u32 Index;
+	u8 IsIntl;
+	int Status = XST_SUCCESS;
+	const XVidC_VideoTimingMode *VmPtr;
+	XVidC_VideoMode Expected;
+	XVidC_VideoMode Found;
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VmPtr = &XVidC_VideoTimingModes[Index];
+		IsIntl = XVidC_IsInterlaced((XVidC_VideoMode)Index);
+
+		Expected = Bench_LinearByRes(VmPtr->Timing.HActive,
+				VmPtr->Timing.VActive, VmPtr->FrameRate,
+				IsIntl);
+		Found = XVidC_GetVideoModeId(VmPtr->Timing.HActive,
+				VmPtr->Timing.VActive, VmPtr->FrameRate,
+				IsIntl);
+		if (Found != Expected) {
+			printf("By resolution: %s returned %d, expected %d\r\n",
+				VmPtr->Name, (int)Found, (int)Expected);
+			Status = XST_FAILURE;
+		}
+
+		Expected = Bench_LinearByTotals(VmPtr->Timing.HTotal,
+				Bench_GetVTotal(VmPtr), VmPtr->FrameRate,
+				IsIntl);
+		Found = XVidC_GetVideoModeIdByTotals(VmPtr->Timing.HTotal,
+				Bench_GetVTotal(VmPtr),
+				XVidC_GetPixelClockHzByVmId((XVidC_VideoMode)Index),
+				IsIntl);
+		if (Found != Expected) {
+			printf("By totals: %s returned %d, expected %d\r\n",
+				VmPtr->Name, (int)Found, (int)Expected);
+			Status = XST_FAILURE;
+		}
+	}
+
+	/* Index entries must be sorted, so each mode is listed once. */
+	for (Index = 1; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		const XVidC_VideoTimingMode *PrevPtr;
+
+		PrevPtr = &XVidC_VideoTimingModes[
+				XVidC_VideoTimingModesByTotal[Index - 1]];
+		VmPtr = &XVidC_VideoTimingModes[
+				XVidC_VideoTimingModesByTotal[Index]];
+		if ((PrevPtr->Timing.HTotal > VmPtr->Timing.HTotal) ||
+			((PrevPtr->Timing.HTotal == VmPtr->Timing.HTotal) &&
+			(Bench_GetVTotal(PrevPtr) > Bench_GetVTotal(VmPtr)))) {
+			printf("Index not sorted at %s\r\n", VmPtr->Name);
+			Status = XST_FAILURE;
+		}
+	}
+
+	if ((XVidC_GetVideoModeId(1, 1, 60, 0) != XVIDC_VM_NOT_SUPPORTED) ||
+		(XVidC_GetVideoModeId(4096, 2160, 61, 0) !=
+						XVIDC_VM_NOT_SUPPORTED) ||
+		(XVidC_GetVideoModeIdByTotals(1, 1, 60, 0) !=
+						XVIDC_VM_NOT_SUPPORTED) ||
+		(XVidC_GetVideoModeIdByTotals(0, 0, 0, 0) !=
+						XVIDC_VM_NOT_SUPPORTED)) {
+		printf("Unknown timing was matched\r\n");
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * This function times all modes looked up XVIDC_BENCH_LOOPS times with the
+ * table scan and with the driver lookups, and prints the time per lookup.
+ *
+ * @param	None.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void Bench_Run(void)
+{
+	u32 Loop;
+	u32 Index;
+	u32 Lookups;
+	clock_t Start;
+	double Time[4];
+	const XVidC_VideoTimingMode *VmPtr;
+	const char *Label[4] = {
+		"Linear scan by resolution",
+		"XVidC_GetVideoModeId",
+		"Linear scan by totals",
+		"XVidC_GetVideoModeIdByTotals",
+	};
+	u32 Method;
+
+	Lookups = XVIDC_BENCH_LOOPS * XVIDC_VM_NUM_SUPPORTED;
+
+	for (Method = 0; Method < 4; Method++) {
+		Start = clock();
+		for (Loop = 0; Loop < XVIDC_BENCH_LOOPS; Loop++) {
+			for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED;
+								Index++) {
+				VmPtr = &XVidC_VideoTimingModes[Index];
+				switch (Method) {
+				case 0:
+					Bench_Sink += Bench_LinearByRes(
+						VmPtr->Timing.HActive,
+						VmPtr->Timing.VActive,
+						VmPtr->FrameRate,
+						VmPtr->Timing.F1VTotal != 0);
+					break;
+				case 1:
+					Bench_Sink += XVidC_GetVideoModeId(
+						VmPtr->Timing.HActive,
+						VmPtr->Timing.VActive,
+						VmPtr->FrameRate,
+						VmPtr->Timing.F1VTotal != 0);
+					break;
+				case 2:
+					Bench_Sink += Bench_LinearByTotals(
+						VmPtr->Timing.HTotal,
+						Bench_GetVTotal(VmPtr),
+						VmPtr->FrameRate,
+						VmPtr->Timing.F1VTotal != 0);
+					break;
+				default:
+					Bench_Sink +=
+						XVidC_GetVideoModeIdByTotals(
+						VmPtr->Timing.HTotal,
+						Bench_GetVTotal(VmPtr),
+						XVidC_GetPixelClockHzByVmId(
+						(XVidC_VideoMode)Index),
+						VmPtr->Timing.F1VTotal != 0);
+					break;
+				}
+			}
+		}
+		Time[Method] = (double)(clock() - Start) / CLOCKS_PER_SEC;
+		printf("%-30s %8.1f ns/lookup\r\n", Label[Method],
+						Time[Method] * 1e9 / Lookups);
+	}
+}
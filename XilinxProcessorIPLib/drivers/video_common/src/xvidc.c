@@ -48,6 +48,8 @@
  * ----- ---- -------- -----------------------------------------------
  * 1.0   rc,  01/10/15 Initial release.
  *       als
+ * 2.1   ms   10/19/26 Full key binary search in XVidC_GetVideoModeId().
+ *                     Added XVidC_GetVideoModeIdByTotals().
  * </pre>
  *
 *******************************************************************************/
@@ -57,6 +59,13 @@
 #include "xil_printf.h"
 #include "xvidc.h"
 
+/**************************** Function Prototypes *****************************/
+
+static int XVidC_CmpModeByRes(const XVidC_VideoTimingMode *VmPtr, u32 Width,
+					u32 Height, u32 FrameRate);
+static int XVidC_CmpModeByTotal(const XVidC_VideoTimingMode *VmPtr,
+			u32 HTotal, u32 VTotal, u32 FrameRate, u8 IsInterlaced);
+
 /*************************** Function Definitions *****************************/
 
 /******************************************************************************/
@@ -166,6 +175,40 @@ u8 XVidC_IsInterlaced(XVidC_VideoMode VmId)
 	return 0;
 }
 
+/******************************************************************************/
+/**
+ * This function compares a video timing table entry against a resolution and
+ * frame rate, in the order the table is sorted in.
+ *
+ * @param	VmPtr is a pointer to the video timing table entry.
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ *
+ * @return
+ *		- <0 if the entry sorts before the key.
+ *		- 0 if the entry matches the key.
+ *		- >0 if the entry sorts after the key.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int XVidC_CmpModeByRes(const XVidC_VideoTimingMode *VmPtr, u32 Width,
+					u32 Height, u32 FrameRate)
+{
+	if (VmPtr->Timing.HActive != Width) {
+		return (VmPtr->Timing.HActive < Width) ? -1 : 1;
+	}
+	if (VmPtr->Timing.VActive != Height) {
+		return (VmPtr->Timing.VActive < Height) ? -1 : 1;
+	}
+	if ((u32)VmPtr->FrameRate != FrameRate) {
+		return ((u32)VmPtr->FrameRate < FrameRate) ? -1 : 1;
+	}
+
+	return 0;
+}
+
 /******************************************************************************/
 /**
  * This function returns the Video Mode ID that matches the detected input
@@ -180,7 +223,10 @@ u8 XVidC_IsInterlaced(XVidC_VideoMode VmId)
  *
  * @return	Id of a supported video mode.
  *
- * @note	None.
+ * @note	Each section of the video timing table is sorted by width,
+ *		height and frame rate. The search is a binary search over the
+ *		full key returning the first matching entry, so standard
+ *		timings are preferred over reduced blanking variants.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
@@ -189,88 +235,149 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 	u32 Low;
 	u32 High;
 	u32 Mid;
-	u32 HActive;
-	u32 VActive;
-	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
+	u32 End;
 
 	if (IsInterlaced) {
 		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
+		End = (XVIDC_VM_INTL_END) + 1;
 	}
 	else {
 		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
+		End = (XVIDC_VM_PROG_END) + 1;
 	}
+	High = End;
 
-	HActive = VActive = Rate = 0;
-
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "width or HActive"
-	 */
-	while (Low <= High) {
+	/* Find the first entry not sorting before the key. */
+	while (Low < High) {
 		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Width == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Width < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
+		if (XVidC_CmpModeByRes(&XVidC_VideoTimingModes[Mid], Width,
+						Height, FrameRate) < 0) {
+			Low = Mid + 1;
 		}
 		else {
-			Low = Mid + 1;
+			High = Mid;
 		}
 	}
 
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching width */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Width)) {
-			--Mid;
-		}
+	if ((Low < End) && (XVidC_CmpModeByRes(&XVidC_VideoTimingModes[Low],
+					Width, Height, FrameRate) == 0)) {
+		return ((XVidC_VideoMode)Low);
+	}
+
+	return (XVIDC_VM_NOT_SUPPORTED);
+}
+
+/******************************************************************************/
+/**
+ * This function compares a video timing table entry against horizontal and
+ * vertical totals, frame rate and I/P flag, in the order of the
+ * XVidC_VideoTimingModesByTotal index.
+ *
+ * @param	VmPtr is a pointer to the video timing table entry.
+ * @param	HTotal specifies horizontal total.
+ * @param	VTotal specifies vertical total of a frame.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is flag.
+ *
+ * @return
+ *		- <0 if the entry sorts before the key.
+ *		- 0 if the entry matches the key.
+ *		- >0 if the entry sorts after the key.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int XVidC_CmpModeByTotal(const XVidC_VideoTimingMode *VmPtr,
+			u32 HTotal, u32 VTotal, u32 FrameRate, u8 IsInterlaced)
+{
+	u32 VmVTotal;
+	u8 VmIsInterlaced;
+
+	VmVTotal = VmPtr->Timing.F0PVTotal + VmPtr->Timing.F1VTotal;
+	VmIsInterlaced = (VmPtr->Timing.F1VTotal != 0) ? 1 : 0;
 
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Width) {
-			/* check current entry */
-			if ((VActive == Height) && (Rate == FrameRate)) {
-				ResFound = (TRUE);
-				break;
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
+	if (VmPtr->Timing.HTotal != HTotal) {
+		return (VmPtr->Timing.HTotal < HTotal) ? -1 : 1;
+	}
+	if (VmVTotal != VTotal) {
+		return (VmVTotal < VTotal) ? -1 : 1;
+	}
+	if ((u32)VmPtr->FrameRate != FrameRate) {
+		return ((u32)VmPtr->FrameRate < FrameRate) ? -1 : 1;
+	}
+	if (VmIsInterlaced != IsInterlaced) {
+		return (VmIsInterlaced < IsInterlaced) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the Video Mode ID that matches the detected
+ * horizontal and vertical totals and pixel clock of a stream. It is meant for
+ * auto-detection of streams for which only the measured timing is known.
+ *
+ * @param	HTotal specifies horizontal total.
+ * @param	VTotal specifies vertical total of a frame. For interlaced
+ *		streams this is the sum of both field totals.
+ * @param	PixelClockHz specifies the measured pixel clock in Hz.
+ * @param	IsInterlaced is flag.
+ *		- 0 = Progressive
+ *		- 1 = Interlaced.
+ *
+ * @return	Id of a supported video mode.
+ *
+ * @note	The frame rate is derived from the pixel clock and rounded to
+ *		the nearest Hz. Modes sharing totals and frame rate (e.g.
+ *		3840x2160 and 4096x2160) cannot be told apart; the lowest ID is
+ *		returned and the caller may check the active width.
+ *
+*******************************************************************************/
+XVidC_VideoMode XVidC_GetVideoModeIdByTotals(u32 HTotal, u32 VTotal,
+					u32 PixelClockHz, u8 IsInterlaced)
+{
+	u32 Low;
+	u32 High;
+	u32 Mid;
+	u32 FrameRate;
+	u64 Pixels;
+
+	Pixels = (u64)HTotal * VTotal;
+	if (Pixels == 0) {
+		return (XVIDC_VM_NOT_SUPPORTED);
+	}
+
+	/* Interlaced modes are listed with their field rate. */
+	if (IsInterlaced) {
+		IsInterlaced = 1;
+		Pixels /= 2;
+	}
+	FrameRate = (u32)(((u64)PixelClockHz + (Pixels / 2)) / Pixels);
+
+	/* Find the first index entry not sorting before the key. */
+	Low = 0;
+	High = (XVIDC_VM_NUM_SUPPORTED);
+	while (Low < High) {
+		Mid = (Low + High) / 2;
+		if (XVidC_CmpModeByTotal(&XVidC_VideoTimingModes[
+					XVidC_VideoTimingModesByTotal[Mid]],
+				HTotal, VTotal, FrameRate, IsInterlaced) < 0) {
+			Low = Mid + 1;
+		}
+		else {
+			High = Mid;
 		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
 	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
+
+	if ((Low < (XVIDC_VM_NUM_SUPPORTED)) &&
+		(XVidC_CmpModeByTotal(&XVidC_VideoTimingModes[
+					XVidC_VideoTimingModesByTotal[Low]],
+			HTotal, VTotal, FrameRate, IsInterlaced) == 0)) {
+		return ((XVidC_VideoMode)XVidC_VideoTimingModesByTotal[Low]);
 	}
 
-	return (Mode);
+	return (XVIDC_VM_NOT_SUPPORTED);
 }
 
 /******************************************************************************/
@@ -50,6 +50,7 @@
  * 1.0   rc,  01/10/15 Initial release.
  *       als
  * 2.0   als  08/14/15 Added new video timings.
+ * 2.1   ms   10/19/26 Added XVidC_GetVideoModeIdByTotals().
  * </pre>
  *
 *******************************************************************************/
@@ -405,6 +406,8 @@ XVidC_VideoFormat XVidC_GetVideoFormat(XVidC_VideoMode VmId);
 u8 XVidC_IsInterlaced(XVidC_VideoMode VmId);
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 					u8 IsInterlaced);
+XVidC_VideoMode XVidC_GetVideoModeIdByTotals(u32 HTotal, u32 VTotal,
+					u32 PixelClockHz, u8 IsInterlaced);
 const XVidC_VideoTimingMode* XVidC_GetVideoModeData(XVidC_VideoMode VmId);
 const char* XVidC_GetVideoModeStr(XVidC_VideoMode VmId);
 char* XVidC_GetFrameRateStr(XVidC_VideoMode VmId);
@@ -417,6 +420,7 @@ void XVidC_ReportTiming(XVidC_VideoTiming *Timing, u8 IsInterlaced);
 /*************************** Variable Declarations ****************************/
 
 const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
+extern const u8 XVidC_VideoTimingModesByTotal[XVIDC_VM_NUM_SUPPORTED];
 
 #endif /* XVIDC_H_ */
 /** @} */
@@ -48,14 +48,39 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  11/09/14 Initial release.
+ * 2.1   ms   10/19/26 Added XVidC_EdidParseCaps() to decode the EDID once into
+ *                     an XVidC_EdidCaps summary. Chromaticity getters use a
+ *                     single fixed scale instead of a power series. Fixed
+ *                     established timing 800x600@56Hz being checked as
+ *                     800x640.
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include <string.h>
 #include "xvidc_edid.h"
 
+/****************************** Type Definitions ******************************/
+
+/**
+ * Established timing bit and the video mode it maps to.
+ */
+typedef struct {
+	u8 Offset;
+	u8 Mask;
+	XVidC_VideoMode VmId;
+} XVidC_EdidEstTiming;
+
+/**
+ * CEA-861 video identification code and the video mode it maps to.
+ */
+typedef struct {
+	u8 Vic;
+	XVidC_VideoMode VmId;
+} XVidC_EdidCeaVic;
+
 /**************************** Function Prototypes *****************************/
 
 static u32 XVidC_EdidIsVideoTimingSupportedPreferredTiming(u8 *EdidRaw,
@@ -64,8 +89,100 @@ static u32 XVidC_EdidIsVideoTimingSupportedEstablishedTimings(u8 *EdidRaw,
 						XVidC_VideoTimingMode *VtMode);
 static u32 XVidC_EdidIsVideoTimingSupportedStandardTimings(u8 *EdidRaw,
 						XVidC_VideoTimingMode *VtMode);
-static float XVidC_CalculatePower(float Base, u8 Power);
-static float XVidC_CalculateBinaryFraction(u16 Val, u8 DecPtIndex);
+static float XVidC_CalculateCc(u16 Val);
+static u8 XVidC_EdidIsBlockValid(u8 *Block);
+static void XVidC_EdidCapsSetVm(XVidC_EdidCaps *CapsPtr, XVidC_VideoMode VmId);
+static void XVidC_EdidCapsAddRes(XVidC_EdidCaps *CapsPtr, u32 Width,
+				u32 Height, u32 FrameRate, u8 IsInterlaced);
+static XVidC_VideoMode XVidC_EdidCapsAddDtd(XVidC_EdidCaps *CapsPtr, u8 *Dtd);
+static XVidC_VideoMode XVidC_EdidCeaSvdToVm(u8 Svd);
+static void XVidC_EdidCapsParseCea(XVidC_EdidCaps *CapsPtr, u8 *Block);
+
+/*************************** Variable Definitions *****************************/
+
+/**
+ * Established timings which have a video mode in the video timing table.
+ */
+static const XVidC_EdidEstTiming XVidC_EdidEstTimings[] = {
+	{XVIDC_EDID_EST_TIMINGS_I,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_60_MASK,
+		XVIDC_VM_640x480_60_P},
+	{XVIDC_EDID_EST_TIMINGS_I,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_72_MASK,
+		XVIDC_VM_640x480_72_P},
+	{XVIDC_EDID_EST_TIMINGS_I,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_75_MASK,
+		XVIDC_VM_640x480_75_P},
+	{XVIDC_EDID_EST_TIMINGS_I,
+		XVIDC_EDID_EST_TIMINGS_I_800x600_56_MASK,
+		XVIDC_VM_800x600_56_P},
+	{XVIDC_EDID_EST_TIMINGS_I,
+		XVIDC_EDID_EST_TIMINGS_I_800x600_60_MASK,
+		XVIDC_VM_800x600_60_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_800x600_72_MASK,
+		XVIDC_VM_800x600_72_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_800x600_75_MASK,
+		XVIDC_VM_800x600_75_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_60_MASK,
+		XVIDC_VM_1024x768_60_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_70_MASK,
+		XVIDC_VM_1024x768_70_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_75_MASK,
+		XVIDC_VM_1024x768_75_P},
+	{XVIDC_EDID_EST_TIMINGS_II,
+		XVIDC_EDID_EST_TIMINGS_II_1280x1024_75_MASK,
+		XVIDC_VM_1280x1024_75_P},
+};
+
+/**
+ * CEA-861 video identification codes which have a video mode in the video
+ * timing table.
+ */
+static const XVidC_EdidCeaVic XVidC_EdidCeaVics[] = {
+	{1,	XVIDC_VM_640x480_60_P},
+	{2,	XVIDC_VM_720x480_60_P},
+	{3,	XVIDC_VM_720x480_60_P},
+	{4,	XVIDC_VM_1280x720_60_P},
+	{5,	XVIDC_VM_1920x1080_60_I},
+	{6,	XVIDC_VM_1440x480_60_I},
+	{7,	XVIDC_VM_1440x480_60_I},
+	{16,	XVIDC_VM_1920x1080_60_P},
+	{17,	XVIDC_VM_720x576_50_P},
+	{18,	XVIDC_VM_720x576_50_P},
+	{19,	XVIDC_VM_1280x720_50_P},
+	{20,	XVIDC_VM_1920x1080_50_I},
+	{21,	XVIDC_VM_1440x576_50_I},
+	{22,	XVIDC_VM_1440x576_50_I},
+	{31,	XVIDC_VM_1920x1080_50_P},
+	{32,	XVIDC_VM_1920x1080_24_P},
+	{33,	XVIDC_VM_1920x1080_25_P},
+	{34,	XVIDC_VM_1920x1080_30_P},
+	{63,	XVIDC_VM_1920x1080_120_P},
+	{64,	XVIDC_VM_1920x1080_100_P},
+	{82,	XVIDC_VM_1680x720_50_P},
+	{83,	XVIDC_VM_1680x720_60_P},
+	{84,	XVIDC_VM_1680x720_100_P},
+	{85,	XVIDC_VM_1680x720_120_P},
+	{89,	XVIDC_VM_2560x1080_50_P},
+	{90,	XVIDC_VM_2560x1080_60_P},
+	{91,	XVIDC_VM_2560x1080_100_P},
+	{92,	XVIDC_VM_2560x1080_120_P},
+	{93,	XVIDC_VM_3840x2160_24_P},
+	{94,	XVIDC_VM_3840x2160_25_P},
+	{95,	XVIDC_VM_3840x2160_30_P},
+	{96,	XVIDC_VM_3840x2160_50_P},
+	{97,	XVIDC_VM_3840x2160_60_P},
+	{98,	XVIDC_VM_4096x2160_24_P},
+	{99,	XVIDC_VM_4096x2160_25_P},
+	{100,	XVIDC_VM_4096x2160_30_P},
+	{101,	XVIDC_VM_4096x2160_50_P},
+	{102,	XVIDC_VM_4096x2160_60_P},
+};
 
 /**************************** Function Definitions ****************************/
 
@@ -169,10 +286,7 @@ XVidC_ColorDepth XVidC_EdidGetColorDepth(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcRedX(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_REDX_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | (EdidRaw[XVIDC_EDID_CC_RG_LOW] >>
-		XVIDC_EDID_CC_RBX_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcRedXRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -191,11 +305,7 @@ float XVidC_EdidGetCcRedX(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcRedY(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_REDY_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | ((EdidRaw[XVIDC_EDID_CC_RG_LOW] &
-		XVIDC_EDID_CC_RBY_LOW_MASK) >>
-		XVIDC_EDID_CC_RBY_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcRedYRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -214,11 +324,7 @@ float XVidC_EdidGetCcRedY(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcGreenX(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_GREENX_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | ((EdidRaw[XVIDC_EDID_CC_RG_LOW] &
-		XVIDC_EDID_CC_GWX_LOW_MASK) >>
-		XVIDC_EDID_CC_GWX_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcGreenXRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -237,10 +343,7 @@ float XVidC_EdidGetCcGreenX(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcGreenY(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_GREENY_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | (EdidRaw[XVIDC_EDID_CC_RG_LOW] &
-		XVIDC_EDID_CC_GWY_LOW_MASK), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcGreenYRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -259,10 +362,7 @@ float XVidC_EdidGetCcGreenY(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcBlueX(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_BLUEX_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | (EdidRaw[XVIDC_EDID_CC_BW_LOW] >>
-		XVIDC_EDID_CC_RBX_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcBlueXRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -281,10 +381,7 @@ float XVidC_EdidGetCcBlueX(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcBlueY(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_BLUEY_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | ((EdidRaw[XVIDC_EDID_CC_BW_LOW] &
-		XVIDC_EDID_CC_RBY_LOW_MASK) >> XVIDC_EDID_CC_RBY_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcBlueYRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -303,10 +400,7 @@ float XVidC_EdidGetCcBlueY(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcWhiteX(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_WHITEX_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | ((EdidRaw[XVIDC_EDID_CC_BW_LOW] &
-		XVIDC_EDID_CC_GWX_LOW_MASK) >> XVIDC_EDID_CC_GWX_LOW_SHIFT), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcWhiteXRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -325,10 +419,7 @@ float XVidC_EdidGetCcWhiteX(u8 *EdidRaw)
 *******************************************************************************/
 float XVidC_EdidGetCcWhiteY(u8 *EdidRaw)
 {
-	return XVidC_CalculateBinaryFraction(
-		(EdidRaw[XVIDC_EDID_CC_WHITEY_HIGH] <<
-		XVIDC_EDID_CC_HIGH_SHIFT) | (EdidRaw[XVIDC_EDID_CC_BW_LOW] &
-		XVIDC_EDID_CC_GWY_LOW_MASK), 9);
+	return XVidC_CalculateCc(XVidC_EdidGetCcWhiteYRaw(EdidRaw));
 }
 
 /******************************************************************************/
@@ -421,6 +512,140 @@ u32 XVidC_EdidIsVideoTimingSupported(u8 *EdidRaw, XVidC_VideoTimingMode *VtMode)
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * Decodes the supplied Extended Display Identification Data (EDID) into a
+ * capability summary in a single pass. The base EDID and all CEA-861 extension
+ * blocks are parsed. Supported video modes are recorded in a bitmap so that
+ * subsequent queries do not need to parse the EDID again.
+ *
+ * A video mode is marked as supported if it is listed by a detailed timing
+ * descriptor, an established timing, a standard timing or a short video
+ * descriptor of a CEA-861 extension block.
+ *
+ * @param	EdidRaw is the supplied EDID. The base EDID is followed by its
+ *		extension blocks.
+ * @param	NumBlocks is the number of 128 byte blocks available at EdidRaw,
+ *		base EDID included. No more than NumBlocks blocks are read,
+ *		whatever extension block count the base EDID claims. Blocks
+ *		beyond that count are ignored.
+ * @param	CapsPtr is a pointer to the capability summary to fill.
+ *
+ * @return
+ *		- XST_SUCCESS if the base EDID is valid.
+ *		- XST_FAILURE if NumBlocks is 0 or the base EDID header or
+ *		  checksum is invalid. The summary is then cleared and marked
+ *		  as not valid.
+ *
+ * @note	Extension blocks with an invalid checksum are skipped.
+ *
+*******************************************************************************/
+u32 XVidC_EdidParseCaps(u8 *EdidRaw, u8 NumBlocks, XVidC_EdidCaps *CapsPtr)
+{
+	u32 Index;
+	u8 *Block;
+
+	memset(CapsPtr, 0, sizeof(XVidC_EdidCaps));
+	CapsPtr->ColorDepth = XVIDC_BPC_UNKNOWN;
+	CapsPtr->PreferredVm = XVIDC_VM_NOT_SUPPORTED;
+	CapsPtr->HdmiMaxColorDepth = XVIDC_BPC_UNKNOWN;
+
+	if ((NumBlocks == 0) || !XVidC_EdidIsHeaderValid(EdidRaw) ||
+					!XVidC_EdidIsBlockValid(EdidRaw)) {
+		return (XST_FAILURE);
+	}
+
+	/* Basic display parameters and color characteristics. */
+	CapsPtr->IsDigital = XVidC_EdidIsDigitalSig(EdidRaw);
+	if (CapsPtr->IsDigital) {
+		CapsPtr->ColorDepth = XVidC_EdidGetColorDepth(EdidRaw);
+	}
+	CapsPtr->CcRedX = XVidC_EdidGetCcRedXRaw(EdidRaw);
+	CapsPtr->CcRedY = XVidC_EdidGetCcRedYRaw(EdidRaw);
+	CapsPtr->CcGreenX = XVidC_EdidGetCcGreenXRaw(EdidRaw);
+	CapsPtr->CcGreenY = XVidC_EdidGetCcGreenYRaw(EdidRaw);
+	CapsPtr->CcBlueX = XVidC_EdidGetCcBlueXRaw(EdidRaw);
+	CapsPtr->CcBlueY = XVidC_EdidGetCcBlueYRaw(EdidRaw);
+	CapsPtr->CcWhiteX = XVidC_EdidGetCcWhiteXRaw(EdidRaw);
+	CapsPtr->CcWhiteY = XVidC_EdidGetCcWhiteYRaw(EdidRaw);
+
+	/* Established timings I, II, and manufacturer's timings. */
+	for (Index = 0; Index < (sizeof(XVidC_EdidEstTimings) /
+				sizeof(XVidC_EdidEstTimings[0])); Index++) {
+		if (EdidRaw[XVidC_EdidEstTimings[Index].Offset] &
+					XVidC_EdidEstTimings[Index].Mask) {
+			XVidC_EdidCapsSetVm(CapsPtr,
+					XVidC_EdidEstTimings[Index].VmId);
+		}
+	}
+
+	/* Standard timings. Unused entries are coded as 0x01, 0x01. */
+	for (Index = 1; Index <= 8; Index++) {
+		if (EdidRaw[XVIDC_EDID_STD_TIMINGS_H(Index)] <= 0x01) {
+			continue;
+		}
+		XVidC_EdidCapsAddRes(CapsPtr,
+				XVidC_EdidGetStdTimingsH(EdidRaw, Index),
+				XVidC_EdidGetStdTimingsV(EdidRaw, Index),
+				XVidC_EdidGetStdTimingsFrr(EdidRaw, Index), 0);
+	}
+
+	/* 18 byte descriptors. The first one is the preferred timing. */
+	CapsPtr->PreferredVm = XVidC_EdidCapsAddDtd(CapsPtr,
+					&EdidRaw[XVIDC_EDID_PTM]);
+	for (Index = 2; Index <= 4; Index++) {
+		XVidC_EdidCapsAddDtd(CapsPtr,
+				&EdidRaw[XVIDC_EDID_18BYTE_DESCRIPTOR(Index)]);
+	}
+
+	/* Extension blocks. The extension block count of the EDID may only
+	 * lower the number of blocks supplied by the caller. */
+	if ((XVidC_EdidGetExtBlkCount(EdidRaw) + 1) < NumBlocks) {
+		NumBlocks = XVidC_EdidGetExtBlkCount(EdidRaw) + 1;
+	}
+	for (Index = 1; Index < NumBlocks; Index++) {
+		Block = &EdidRaw[Index * XVIDC_EDID_BLOCK_SIZE];
+		if ((Block[XVIDC_EDID_CEA_TAG] == XVIDC_EDID_CEA_TAG_VALUE) &&
+					XVidC_EdidIsBlockValid(Block)) {
+			XVidC_EdidCapsParseCea(CapsPtr, Block);
+		}
+	}
+
+	CapsPtr->NumBlocks = NumBlocks;
+	CapsPtr->IsValid = 1;
+
+	return (XST_SUCCESS);
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a video mode is supported according to a capability
+ * summary previously filled by XVidC_EdidParseCaps.
+ *
+ * @param	CapsPtr is a pointer to the capability summary.
+ * @param	VmId specifies the resolution id.
+ *
+ * @return
+ *		- XST_SUCCESS if the video mode is supported by the sink.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapsIsVideoModeSupported(const XVidC_EdidCaps *CapsPtr,
+						XVidC_VideoMode VmId)
+{
+	if (!CapsPtr->IsValid || (VmId >= XVIDC_VM_NUM_SUPPORTED)) {
+		return (XST_FAILURE);
+	}
+
+	if (XVidC_EdidCapsIsVmSupported(CapsPtr, VmId)) {
+		return (XST_SUCCESS);
+	}
+
+	return (XST_FAILURE);
+}
+
 /******************************************************************************/
 /**
  * Checks whether or not a specified video timing mode is the preferred timing
@@ -491,7 +716,7 @@ static u32 XVidC_EdidIsVideoTimingSupportedEstablishedTimings(u8 *EdidRaw,
 
 	/* Check established timings I, II, and III. */
 	if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 640) &&
+			(VtMode->Timing.VActive == 600) &&
 			(VtMode->FrameRate == XVIDC_FR_56HZ) &&
 			XVidC_EdidSuppEstTimings800x600_56(EdidRaw)) {
 		Status = XST_SUCCESS;
@@ -634,56 +859,320 @@ static u32 XVidC_EdidIsVideoTimingSupportedStandardTimings(u8 *EdidRaw,
 
 /******************************************************************************/
 /**
- * Perform a power operation.
+ * Convert a 10 bit chromaticity coordinate of the EDID into a decimal number.
+ * Bit 9 represents 2^-1 and bit 0 represents 2^-10.
  *
- * @param	Base is b in the power operation, b^n.
- * @param	Power is n in the power operation, b^n.
+ * @param	Val is the binary representation of the fraction.
+ *
+ * @return	The chromaticity coordinate.
+ *
+ * @note	The scale is exact in binary floating point so the result is the
+ *		same as summing the individual binary digits.
+ *
+*******************************************************************************/
+static float XVidC_CalculateCc(u16 Val)
+{
+	return (float)Val * (1.0f / (1 << XVIDC_EDID_CC_FRAC_BITS));
+}
+
+/******************************************************************************/
+/**
+ * Checks the checksum of a 128 byte EDID block.
  *
- * @return	Base^Power (Base to the power of Power).
+ * @param	Block is the EDID block to check.
+ *
+ * @return	1 if the sum of all bytes of the block is 0, 0 otherwise.
  *
  * @note	None.
  *
 *******************************************************************************/
-static float XVidC_CalculatePower(float Base, u8 Power)
+static u8 XVidC_EdidIsBlockValid(u8 *Block)
 {
 	u8 Index;
-	float Res = 1.0;
+	u8 Sum = 0;
 
-	for (Index = 0; Index < Power; Index++) {
-		Res *= Base;
+	for (Index = 0; Index < XVIDC_EDID_BLOCK_SIZE; Index++) {
+		Sum += Block[Index];
 	}
 
-	return Res;
+	return (Sum == 0);
 }
 
 /******************************************************************************/
 /**
- * Convert a fractional binary number into a decimal number. Binary digits to
- * the right of the decimal point represent 2^-1 to 2^-(DecPtIndex+1). Binary
- * digits to the left of the decimal point represent 2^0, 2^1, etc.
+ * Marks a video mode as supported in the capability summary.
  *
- * @param	Val is the binary representation of the fraction.
- * @param	DecPtIndex is the index of the decimal point in the binary
- *		number. The decimal point is between the binary digits at Val's
- *		indices (DecPtIndex) and (DecPtIndex + 1).
+ * @param	CapsPtr is a pointer to the capability summary.
+ * @param	VmId specifies the resolution id. Ids outside of the video
+ *		timing table are ignored.
  *
- * @return	Base^Power (Base to the power of Power).
+ * @return	None.
  *
  * @note	None.
  *
 *******************************************************************************/
-static float XVidC_CalculateBinaryFraction(u16 Val, u8 DecPtIndex)
+static void XVidC_EdidCapsSetVm(XVidC_EdidCaps *CapsPtr, XVidC_VideoMode VmId)
 {
-	int Index;
-	float Res;
+	if (VmId < XVIDC_VM_NUM_SUPPORTED) {
+		CapsPtr->SuppVm[VmId >> 5] |= (1U << (VmId & 0x1F));
+	}
+}
 
-	for (Index = DecPtIndex, Res = 0; Index >= 0; Index--) {
-		if (((Val >> Index) & 0x1) == 1) {
-			Res += XVidC_CalculatePower(
-						0.5, DecPtIndex - Index + 1);
+/******************************************************************************/
+/**
+ * Marks all video modes of the video timing table with the specified
+ * resolution and frame rate as supported in the capability summary. This
+ * includes reduced blanking variants of the same resolution and frame rate.
+ *
+ * @param	CapsPtr is a pointer to the capability summary.
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is flag.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapsAddRes(XVidC_EdidCaps *CapsPtr, u32 Width,
+				u32 Height, u32 FrameRate, u8 IsInterlaced)
+{
+	u32 VmId;
+	u32 End;
+	const XVidC_VideoTimingMode *VmPtr;
+
+	VmId = XVidC_GetVideoModeId(Width, Height, FrameRate, IsInterlaced);
+	End = (IsInterlaced ? (XVIDC_VM_INTL_END) : (XVIDC_VM_PROG_END)) + 1;
+
+	/* Entries with the same key are adjacent in the table. */
+	for (; VmId < End; VmId++) {
+		VmPtr = &XVidC_VideoTimingModes[VmId];
+		if ((VmPtr->Timing.HActive != Width) ||
+				(VmPtr->Timing.VActive != Height) ||
+				(VmPtr->FrameRate != FrameRate)) {
+			break;
+		}
+		XVidC_EdidCapsSetVm(CapsPtr, (XVidC_VideoMode)VmId);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Decodes a detailed timing descriptor (DTD) and marks its video mode as
+ * supported in the capability summary. The mode is looked up by its totals and
+ * pixel clock first so that reduced blanking variants are told apart. If the
+ * blanking does not match a video mode of the table, the mode is looked up by
+ * resolution and frame rate instead.
+ *
+ * @param	CapsPtr is a pointer to the capability summary.
+ * @param	Dtd is the 18 byte descriptor.
+ *
+ * @return	The id of the video mode of the descriptor, or
+ *		XVIDC_VM_NOT_SUPPORTED if the descriptor is not a timing or its
+ *		video mode is not in the video timing table.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_EdidCapsAddDtd(XVidC_EdidCaps *CapsPtr, u8 *Dtd)
+{
+	u32 PixelClockHz;
+	u32 HActive;
+	u32 VActive;
+	u32 HTotal;
+	u32 VTotal;
+	u8 IsInterlaced;
+	u64 Pixels;
+	XVidC_VideoMode VmId;
+	const XVidC_VideoTimingMode *VmPtr;
+
+	/* Descriptors with a zero pixel clock are display descriptors. */
+	PixelClockHz = ((Dtd[XVIDC_EDID_DTD_PTM_PIXEL_CLK_KHZ_MSB] << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_PIXEL_CLK_KHZ_LSB]) * 10000;
+	if (PixelClockHz == 0) {
+		return (XVIDC_VM_NOT_SUPPORTED);
+	}
+
+	HActive = (((Dtd[XVIDC_EDID_DTD_PTM_HRES_HBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_HRES_LSB];
+	HTotal = HActive + (((Dtd[XVIDC_EDID_DTD_PTM_HRES_HBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XBLANK_MASK) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_HBLANK_LSB]);
+	VActive = (((Dtd[XVIDC_EDID_DTD_PTM_VRES_VBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_VRES_LSB];
+	VTotal = VActive + (((Dtd[XVIDC_EDID_DTD_PTM_VRES_VBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XBLANK_MASK) << 8) |
+			Dtd[XVIDC_EDID_DTD_PTM_VBLANK_LSB]);
+	IsInterlaced = (Dtd[XVIDC_EDID_DTD_PTM_SIGNAL] &
+			XVIDC_EDID_DTD_PTM_SIGNAL_INTERLACED_MASK) >>
+			XVIDC_EDID_DTD_PTM_SIGNAL_INTERLACED_SHIFT;
+
+	/* Interlaced descriptors specify one field; the frame has both fields
+	 * and the extra half line of field 1. */
+	if (IsInterlaced) {
+		VTotal = (2 * VTotal) + 1;
+	}
+
+	VmId = XVidC_GetVideoModeIdByTotals(HTotal, VTotal, PixelClockHz,
+								IsInterlaced);
+	if (VmId != XVIDC_VM_NOT_SUPPORTED) {
+		VmPtr = &XVidC_VideoTimingModes[VmId];
+		if ((VmPtr->Timing.HActive != HActive) ||
+				(VmPtr->Timing.VActive != VActive)) {
+			VmId = XVIDC_VM_NOT_SUPPORTED;
 		}
 	}
 
-	return (Val >> (DecPtIndex + 1)) + Res;
+	if (VmId == XVIDC_VM_NOT_SUPPORTED) {
+		Pixels = (u64)HTotal * VTotal;
+		if (IsInterlaced) {
+			Pixels >>= 1;
+		}
+		VmId = XVidC_GetVideoModeId(HActive, VActive,
+			(u32)((PixelClockHz + (Pixels >> 1)) / Pixels),
+			IsInterlaced);
+	}
+
+	XVidC_EdidCapsSetVm(CapsPtr, VmId);
+
+	return (VmId);
+}
+
+/******************************************************************************/
+/**
+ * Maps a CEA-861 short video descriptor (SVD) to a video mode.
+ *
+ * @param	Svd is the short video descriptor.
+ *
+ * @return	The id of the video mode, or XVIDC_VM_NOT_SUPPORTED if the
+ *		video identification code has no video mode in the video timing
+ *		table.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_EdidCeaSvdToVm(u8 Svd)
+{
+	u32 Index;
+
+	/* Descriptors 129 to 192 are native codes 1 to 64. */
+	if ((Svd >= XVIDC_EDID_CEA_SVD_NATIVE_MIN) &&
+				(Svd <= XVIDC_EDID_CEA_SVD_NATIVE_MAX)) {
+		Svd &= XVIDC_EDID_CEA_SVD_VIC_MASK;
+	}
+
+	for (Index = 0; Index < (sizeof(XVidC_EdidCeaVics) /
+				sizeof(XVidC_EdidCeaVics[0])); Index++) {
+		if (XVidC_EdidCeaVics[Index].Vic == Svd) {
+			return (XVidC_EdidCeaVics[Index].VmId);
+		}
+	}
+
+	return (XVIDC_VM_NOT_SUPPORTED);
+}
+
+/******************************************************************************/
+/**
+ * Decodes a CEA-861 extension block into the capability summary. The short
+ * video descriptors, the HDMI vendor specific data block and the detailed
+ * timing descriptors of the block are parsed.
+ *
+ * @param	CapsPtr is a pointer to the capability summary.
+ * @param	Block is the 128 byte CEA-861 extension block.
+ *
+ * @return	None.
+ *
+ * @note	The feature byte is taken from the first CEA-861 extension
+ *		block only.
+ *
+*******************************************************************************/
+static void XVidC_EdidCapsParseCea(XVidC_EdidCaps *CapsPtr, u8 *Block)
+{
+	u32 Offset;
+	u32 DtdOffset;
+	u32 Len;
+	u32 Index;
+	u8 *Db;
+
+	if (CapsPtr->NumCeaBlocks == 0) {
+		CapsPtr->CeaFeature = Block[XVIDC_EDID_CEA_FEATURE];
+	}
+	CapsPtr->NumCeaBlocks++;
+
+	/* An offset of 0 indicates that there are neither data blocks nor
+	 * detailed timing descriptors. */
+	DtdOffset = Block[XVIDC_EDID_CEA_DTD_OFFSET];
+	if ((DtdOffset < XVIDC_EDID_CEA_DATA_BLOCKS) ||
+			(DtdOffset >= XVIDC_EDID_BLOCK_SIZE)) {
+		return;
+	}
+
+	/* Data block collection. */
+	for (Offset = XVIDC_EDID_CEA_DATA_BLOCKS; Offset < DtdOffset;
+							Offset += Len + 1) {
+		Db = &Block[Offset];
+		Len = Db[0] & XVIDC_EDID_CEA_DB_LEN_MASK;
+		if ((Offset + Len) >= DtdOffset) {
+			break;
+		}
+
+		switch (Db[0] >> XVIDC_EDID_CEA_DB_TAG_SHIFT) {
+			case XVIDC_EDID_CEA_DB_TAG_VIDEO:
+				for (Index = 1; Index <= Len; Index++) {
+					XVidC_EdidCapsSetVm(CapsPtr,
+						XVidC_EdidCeaSvdToVm(Db[Index]));
+				}
+				break;
+
+			case XVIDC_EDID_CEA_DB_TAG_VSDB:
+				if ((Len < 5) || (((Db[3] << 16) |
+						(Db[2] << 8) | Db[1]) !=
+						XVIDC_EDID_CEA_HDMI_OUI)) {
+					break;
+				}
+				CapsPtr->IsHdmi = 1;
+				CapsPtr->HdmiPhysAddr = (Db[4] << 8) | Db[5];
+				CapsPtr->HdmiMaxColorDepth = XVIDC_BPC_8;
+				if (Len >= 6) {
+					if (Db[6] & XVIDC_EDID_CEA_HDMI_DC_48_MASK) {
+						CapsPtr->HdmiMaxColorDepth =
+								XVIDC_BPC_16;
+					}
+					else if (Db[6] &
+						XVIDC_EDID_CEA_HDMI_DC_36_MASK) {
+						CapsPtr->HdmiMaxColorDepth =
+								XVIDC_BPC_12;
+					}
+					else if (Db[6] &
+						XVIDC_EDID_CEA_HDMI_DC_30_MASK) {
+						CapsPtr->HdmiMaxColorDepth =
+								XVIDC_BPC_10;
+					}
+				}
+				if (Len >= 7) {
+					CapsPtr->HdmiMaxTmdsClkMHz = Db[7] *
+					XVIDC_EDID_CEA_HDMI_TMDS_CLK_MHZ_UNIT;
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	/* Detailed timing descriptors, up to the checksum byte. */
+	for (Offset = DtdOffset; (Offset + XVIDC_EDID_DTD_SIZE) <
+				XVIDC_EDID_BLOCK_SIZE;
+				Offset += XVIDC_EDID_DTD_SIZE) {
+		if ((Block[Offset] | Block[Offset + 1]) == 0) {
+			break;
+		}
+		XVidC_EdidCapsAddDtd(CapsPtr, &Block[Offset]);
+	}
 }
 /** @} */
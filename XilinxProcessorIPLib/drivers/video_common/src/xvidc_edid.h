@@ -49,6 +49,8 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  11/09/14 Initial release.
+ * 2.1   ms   10/19/26 Added XVidC_EdidCaps capability summary, CEA-861
+ *                     extension definitions and raw chromaticity getters.
  * </pre>
  *
 *******************************************************************************/
@@ -135,6 +137,18 @@
 #define XVIDC_EDID_CHECKSUM				0x7F
 /* @} */
 
+/** @name Address mapping for the CEA-861 extension block.
+ * @{
+ */
+#define XVIDC_EDID_BLOCK_SIZE				128
+#define XVIDC_EDID_CEA_TAG				0x00
+#define XVIDC_EDID_CEA_REVISION				0x01
+#define XVIDC_EDID_CEA_DTD_OFFSET			0x02
+#define XVIDC_EDID_CEA_FEATURE				0x03
+#define XVIDC_EDID_CEA_DATA_BLOCKS			0x04
+#define XVIDC_EDID_DTD_SIZE				18
+/* @} */
+
 /******************************************************************************/
 
 /** @name Extended Display Identification Data: Masks, shifts, and values.
@@ -259,8 +273,71 @@
 #define XVIDC_EDID_DTD_PTM_SIGNAL_VPOLARITY_MASK		0x04
 #define XVIDC_EDID_DTD_PTM_SIGNAL_HPOLARITY_SHIFT		1
 #define XVIDC_EDID_DTD_PTM_SIGNAL_VPOLARITY_SHIFT		2
+
+/* Color characteristics are 10 bit binary fractions. */
+#define XVIDC_EDID_CC_FRAC_BITS				10
+
+/* CEA-861 extension block. */
+#define XVIDC_EDID_CEA_TAG_VALUE			0x02
+#define XVIDC_EDID_CEA_FEATURE_UNDERSCAN_MASK		(0x1 << 7)
+#define XVIDC_EDID_CEA_FEATURE_AUDIO_MASK		(0x1 << 6)
+#define XVIDC_EDID_CEA_FEATURE_YCRCB444_MASK		(0x1 << 5)
+#define XVIDC_EDID_CEA_FEATURE_YCRCB422_MASK		(0x1 << 4)
+#define XVIDC_EDID_CEA_FEATURE_NATIVE_DTD_MASK		0x0F
+#define XVIDC_EDID_CEA_DB_TAG_SHIFT			5
+#define XVIDC_EDID_CEA_DB_LEN_MASK			0x1F
+#define XVIDC_EDID_CEA_DB_TAG_VIDEO			0x2
+#define XVIDC_EDID_CEA_DB_TAG_VSDB			0x3
+#define XVIDC_EDID_CEA_SVD_NATIVE_MIN			129
+#define XVIDC_EDID_CEA_SVD_NATIVE_MAX			192
+#define XVIDC_EDID_CEA_SVD_VIC_MASK			0x7F
+#define XVIDC_EDID_CEA_HDMI_OUI				0x000C03
+#define XVIDC_EDID_CEA_HDMI_DC_48_MASK			(0x1 << 6)
+#define XVIDC_EDID_CEA_HDMI_DC_36_MASK			(0x1 << 5)
+#define XVIDC_EDID_CEA_HDMI_DC_30_MASK			(0x1 << 4)
+#define XVIDC_EDID_CEA_HDMI_TMDS_CLK_MHZ_UNIT		5
 /* @} */
 
+/****************************** Type Definitions ******************************/
+
+/** Number of words of the supported video mode bitmap. */
+#define XVIDC_EDID_CAPS_VM_WORDS	((XVIDC_VM_NUM_SUPPORTED + 31) / 32)
+
+/**
+ * Capability summary of a sink, decoded once from its EDID by
+ * XVidC_EdidParseCaps. Queries on the summary do not touch the raw EDID.
+ * Chromaticity coordinates are kept as the 10 bit binary fractions of the EDID
+ * (units of 1/1024) so that no floating point is needed.
+ */
+typedef struct {
+	u8 IsValid;		/**< Summary parsed from a valid base EDID. */
+	u8 NumBlocks;		/**< Number of blocks parsed, base included. */
+	u8 IsDigital;		/**< Digital video input. */
+	XVidC_ColorDepth ColorDepth;	/**< Bits per color of the base EDID. */
+	XVidC_VideoMode PreferredVm;	/**< Video mode of the preferred timing,
+					  *  XVIDC_VM_NOT_SUPPORTED if none. */
+	u32 SuppVm[XVIDC_EDID_CAPS_VM_WORDS];	/**< Bitmap of supported video
+						  *  modes, indexed by
+						  *  XVidC_VideoMode. */
+	u16 CcRedX;		/**< Red x chromaticity, 1/1024 units. */
+	u16 CcRedY;		/**< Red y chromaticity, 1/1024 units. */
+	u16 CcGreenX;		/**< Green x chromaticity, 1/1024 units. */
+	u16 CcGreenY;		/**< Green y chromaticity, 1/1024 units. */
+	u16 CcBlueX;		/**< Blue x chromaticity, 1/1024 units. */
+	u16 CcBlueY;		/**< Blue y chromaticity, 1/1024 units. */
+	u16 CcWhiteX;		/**< White x chromaticity, 1/1024 units. */
+	u16 CcWhiteY;		/**< White y chromaticity, 1/1024 units. */
+	u8 NumCeaBlocks;	/**< Number of CEA-861 extension blocks. */
+	u8 CeaFeature;		/**< Feature byte of the first CEA-861
+				  *  extension block. */
+	u8 IsHdmi;		/**< HDMI vendor specific data block found. */
+	u16 HdmiPhysAddr;	/**< HDMI source physical address. */
+	u16 HdmiMaxTmdsClkMHz;	/**< HDMI maximum TMDS clock, 0 if not
+				  *  specified. */
+	XVidC_ColorDepth HdmiMaxColorDepth;	/**< Highest HDMI deep color
+						  *  depth. */
+} XVidC_EdidCaps;
+
 /******************* Macros (Inline Functions) Definitions ********************/
 
 #define XVidC_EdidIsHeaderValid(E) \
@@ -371,6 +448,38 @@
 	XVIDC_EDID_BDISP_FEATURE_CONTFREQ_MASK) != 0)
 
 /* Color characterisitics (display x,y chromaticity coordinates). */
+#define XVidC_EdidGetCcRedXRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_REDX_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	(E[XVIDC_EDID_CC_RG_LOW] >> XVIDC_EDID_CC_RBX_LOW_SHIFT)))
+#define XVidC_EdidGetCcRedYRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_REDY_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	((E[XVIDC_EDID_CC_RG_LOW] & XVIDC_EDID_CC_RBY_LOW_MASK) >> \
+	XVIDC_EDID_CC_RBY_LOW_SHIFT)))
+#define XVidC_EdidGetCcGreenXRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_GREENX_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	((E[XVIDC_EDID_CC_RG_LOW] & XVIDC_EDID_CC_GWX_LOW_MASK) >> \
+	XVIDC_EDID_CC_GWX_LOW_SHIFT)))
+#define XVidC_EdidGetCcGreenYRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_GREENY_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	(E[XVIDC_EDID_CC_RG_LOW] & XVIDC_EDID_CC_GWY_LOW_MASK)))
+#define XVidC_EdidGetCcBlueXRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_BLUEX_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	(E[XVIDC_EDID_CC_BW_LOW] >> XVIDC_EDID_CC_RBX_LOW_SHIFT)))
+#define XVidC_EdidGetCcBlueYRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_BLUEY_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	((E[XVIDC_EDID_CC_BW_LOW] & XVIDC_EDID_CC_RBY_LOW_MASK) >> \
+	XVIDC_EDID_CC_RBY_LOW_SHIFT)))
+#define XVidC_EdidGetCcWhiteXRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_WHITEX_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	((E[XVIDC_EDID_CC_BW_LOW] & XVIDC_EDID_CC_GWX_LOW_MASK) >> \
+	XVIDC_EDID_CC_GWX_LOW_SHIFT)))
+#define XVidC_EdidGetCcWhiteYRaw(E) \
+	((u16)((E[XVIDC_EDID_CC_WHITEY_HIGH] << XVIDC_EDID_CC_HIGH_SHIFT) | \
+	(E[XVIDC_EDID_CC_BW_LOW] & XVIDC_EDID_CC_GWY_LOW_MASK)))
+/* Converts a raw chromaticity coordinate to thousandths, rounded. */
+#define XVidC_EdidCcToMilli(Cc) \
+	((u16)((((u32)(Cc) * 1000) + (1 << (XVIDC_EDID_CC_FRAC_BITS - 1))) >> \
+	XVIDC_EDID_CC_FRAC_BITS))
 /* float XVidC_EdidGetCcRedX(u8 *EdidRaw); */
 /* float XVidC_EdidGetCcRedY(u8 *EdidRaw); */
 /* float XVidC_EdidGetCcGreenX(u8 *EdidRaw); */
@@ -455,6 +564,17 @@
 /* Checksum. */
 #define XVidC_EdidGetChecksum(E)	(E[XVIDC_EDID_CHECKSUM])
 
+/* Capability summary. */
+#define XVidC_EdidCapsIsVmSupported(C, VmId) \
+	((((C)->SuppVm[(VmId) >> 5]) >> ((VmId) & 0x1F)) & 0x1)
+#define XVidC_EdidCapsIsHdmi(C)		((C)->IsHdmi)
+#define XVidC_EdidCapsSuppYCrCb444(C) \
+	(((C)->CeaFeature & XVIDC_EDID_CEA_FEATURE_YCRCB444_MASK) != 0)
+#define XVidC_EdidCapsSuppYCrCb422(C) \
+	(((C)->CeaFeature & XVIDC_EDID_CEA_FEATURE_YCRCB422_MASK) != 0)
+#define XVidC_EdidCapsSuppBasicAudio(C) \
+	(((C)->CeaFeature & XVIDC_EDID_CEA_FEATURE_AUDIO_MASK) != 0)
+
 /**************************** Function Prototypes *****************************/
 
 /* Vendor and product identification: ID manufacturer name. */
@@ -480,5 +600,10 @@ u16 XVidC_EdidGetStdTimingsV(u8 *EdidRaw, u8 StdTimingsNum);
 u32 XVidC_EdidIsVideoTimingSupported(u8 *EdidRaw,
 						XVidC_VideoTimingMode *VtMode);
 
+/* Capability summary. */
+u32 XVidC_EdidParseCaps(u8 *EdidRaw, u8 NumBlocks, XVidC_EdidCaps *CapsPtr);
+u32 XVidC_EdidCapsIsVideoModeSupported(const XVidC_EdidCaps *CapsPtr,
+						XVidC_VideoMode VmId);
+
 #endif /* XVIDC_EDID_H_ */
 /** @} */
@@ -49,6 +49,8 @@
  *       rc
  * 2.0   als  08/14/15 Added new video timings.
  * 2.1   als  11/04/15 Fixed video timings for some resolutions.
+ *       ms   10/19/26 Added index of video modes sorted by totals. Documented
+ *                     the sort order the mode lookup relies on.
  * </pre>
  *
 *******************************************************************************/
@@ -82,6 +84,11 @@
  *    14) Frame 1: Vertical back porch (lines)
  *    15) Frame 1: Vertical total (lines)
  *    16) Vertical sync polarity (0=negative|1=positive)
+ *
+ * Interlaced and progressive sections must each stay sorted by horizontal
+ * active, vertical active and frame rate (ascending). Entries with the same
+ * key, e.g. reduced blanking variants, follow the standard timing.
+ * XVidC_GetVideoModeId() does a binary search relying on this order.
  */
 const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED] =
 {
@@ -443,4 +450,133 @@ const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED] =
 		{4096, 8, 32, 40, 4176, 1,
 		2160, 48, 8, 6, 2222, 0, 0, 0, 0, 0} },
 };
+
+/**
+ * This table indexes the video timing table by horizontal total, vertical
+ * total (sum of both fields for interlaced modes), frame rate and interlaced
+ * flag (ascending). Modes with the same key are ordered by ID.
+ * XVidC_GetVideoModeIdByTotals() does a binary search over this index; it must
+ * be updated when modes are added to the video timing table.
+ */
+const u8 XVidC_VideoTimingModesByTotal[XVIDC_VM_NUM_SUPPORTED] =
+{
+	XVIDC_VM_640x480_60_P,       /*  800 x  525 @ 60 */
+	XVIDC_VM_640x350_85_P,       /*  832 x  445 @ 85 */
+	XVIDC_VM_640x480_85_P,       /*  832 x  509 @ 85 */
+	XVIDC_VM_640x480_72_P,       /*  832 x  520 @ 72 */
+	XVIDC_VM_640x480_75_P,       /*  840 x  500 @ 75 */
+	XVIDC_VM_720x480_60_P,       /*  858 x  525 @ 60 */
+	XVIDC_VM_720x480_60_I,       /*  858 x  525 @ 60 (I) */
+	XVIDC_VM_720x576_50_P,       /*  864 x  625 @ 50 */
+	XVIDC_VM_720x576_50_I,       /*  864 x  625 @ 50 (I) */
+	XVIDC_VM_720x400_85_P,       /*  936 x  446 @ 85 */
+	XVIDC_VM_800x600_120_P_RB,   /*  960 x  636 @120 */
+	XVIDC_VM_800x600_56_P,       /* 1024 x  625 @ 56 */
+	XVIDC_VM_800x600_72_P,       /* 1040 x  666 @ 72 */
+	XVIDC_VM_800x600_85_P,       /* 1048 x  631 @ 85 */
+	XVIDC_VM_800x600_75_P,       /* 1056 x  625 @ 75 */
+	XVIDC_VM_800x600_60_P,       /* 1056 x  628 @ 60 */
+	XVIDC_VM_848x480_60_P,       /* 1088 x  517 @ 60 */
+	XVIDC_VM_1024x768_120_P_RB,  /* 1184 x  813 @120 */
+	XVIDC_VM_1024x768_75_P,      /* 1312 x  800 @ 75 */
+	XVIDC_VM_1024x768_70_P,      /* 1328 x  806 @ 70 */
+	XVIDC_VM_1024x768_60_P,      /* 1344 x  806 @ 60 */
+	XVIDC_VM_1024x768_85_P,      /* 1376 x  808 @ 85 */
+	XVIDC_VM_1280x768_60_P_RB,   /* 1440 x  790 @ 60 */
+	XVIDC_VM_1280x768_120_P_RB,  /* 1440 x  813 @120 */
+	XVIDC_VM_1280x800_60_P_RB,   /* 1440 x  823 @ 60 */
+	XVIDC_VM_1280x800_120_P_RB,  /* 1440 x  847 @120 */
+	XVIDC_VM_1280x960_120_P_RB,  /* 1440 x 1017 @120 */
+	XVIDC_VM_1280x1024_120_P_RB, /* 1440 x 1084 @120 */
+	XVIDC_VM_1366x768_60_P,      /* 1500 x  800 @ 60 */
+	XVIDC_VM_1360x768_120_P_RB,  /* 1520 x  813 @120 */
+	XVIDC_VM_1400x1050_60_P_RB,  /* 1560 x 1080 @ 60 */
+	XVIDC_VM_1400x1050_120_P_RB, /* 1560 x 1112 @120 */
+	XVIDC_VM_1152x864_75_P,      /* 1600 x  900 @ 75 */
+	XVIDC_VM_1440x900_60_P_RB,   /* 1600 x  926 @ 60 */
+	XVIDC_VM_1440x900_120_P_RB,  /* 1600 x  953 @120 */
+	XVIDC_VM_1280x720_60_P,      /* 1650 x  750 @ 60 */
+	XVIDC_VM_1280x768_60_P,      /* 1664 x  798 @ 60 */
+	XVIDC_VM_1280x800_60_P,      /* 1680 x  831 @ 60 */
+	XVIDC_VM_1280x1024_60_P,     /* 1688 x 1066 @ 60 */
+	XVIDC_VM_1280x1024_75_P,     /* 1688 x 1066 @ 75 */
+	XVIDC_VM_1280x768_75_P,      /* 1696 x  805 @ 75 */
+	XVIDC_VM_1280x800_75_P,      /* 1696 x  838 @ 75 */
+	XVIDC_VM_1280x768_85_P,      /* 1712 x  809 @ 85 */
+	XVIDC_VM_1280x800_85_P,      /* 1712 x  843 @ 85 */
+	XVIDC_VM_1440x240_60_P,      /* 1716 x  262 @ 60 */
+	XVIDC_VM_1440x480_60_I,      /* 1716 x  525 @ 60 (I) */
+	XVIDC_VM_1440x576_50_I,      /* 1728 x  625 @ 50 (I) */
+	XVIDC_VM_1280x960_85_P,      /* 1728 x 1011 @ 85 */
+	XVIDC_VM_1280x1024_85_P,     /* 1728 x 1072 @ 85 */
+	XVIDC_VM_1600x1200_120_P_RB, /* 1760 x 1271 @120 */
+	XVIDC_VM_1360x768_60_P,      /* 1792 x  795 @ 60 */
+	XVIDC_VM_1280x960_60_P,      /* 1800 x 1000 @ 60 */
+	XVIDC_VM_1680x1050_60_P_RB,  /* 1840 x 1080 @ 60 */
+	XVIDC_VM_1680x1050_120_P_RB, /* 1840 x 1112 @120 */
+	XVIDC_VM_1400x1050_60_P,     /* 1864 x 1089 @ 60 */
+	XVIDC_VM_1400x1050_75_P,     /* 1896 x 1099 @ 75 */
+	XVIDC_VM_1440x900_60_P,      /* 1904 x  934 @ 60 */
+	XVIDC_VM_1400x1050_85_P,     /* 1912 x 1105 @ 85 */
+	XVIDC_VM_1440x900_75_P,      /* 1936 x  942 @ 75 */
+	XVIDC_VM_1440x900_85_P,      /* 1952 x  948 @ 85 */
+	XVIDC_VM_1792x1344_120_P_RB, /* 1952 x 1423 @120 */
+	XVIDC_VM_1280x720_50_P,      /* 1980 x  750 @ 50 */
+	XVIDC_VM_1680x720_100_P,     /* 2000 x  825 @100 */
+	XVIDC_VM_1680x720_120_P,     /* 2000 x  825 @120 */
+	XVIDC_VM_1856x1392_120_P_RB, /* 2016 x 1474 @120 */
+	XVIDC_VM_1920x1200_60_P_RB,  /* 2080 x 1235 @ 60 */
+	XVIDC_VM_1920x1200_120_P_RB, /* 2080 x 1271 @120 */
+	XVIDC_VM_1920x1440_120_P_RB, /* 2080 x 1525 @120 */
+	XVIDC_VM_1600x1200_60_P,     /* 2160 x 1250 @ 60 */
+	XVIDC_VM_1600x1200_65_P,     /* 2160 x 1250 @ 65 */
+	XVIDC_VM_1600x1200_70_P,     /* 2160 x 1250 @ 70 */
+	XVIDC_VM_1600x1200_75_P,     /* 2160 x 1250 @ 75 */
+	XVIDC_VM_1600x1200_85_P,     /* 2160 x 1250 @ 85 */
+	XVIDC_VM_1680x720_50_P,      /* 2200 x  750 @ 50 */
+	XVIDC_VM_1680x720_60_P,      /* 2200 x  750 @ 60 */
+	XVIDC_VM_1920x1080_30_P,     /* 2200 x 1125 @ 30 */
+	XVIDC_VM_1920x1080_60_P,     /* 2200 x 1125 @ 60 */
+	XVIDC_VM_1920x1080_60_I,     /* 2200 x 1125 @ 60 (I) */
+	XVIDC_VM_1920x1080_120_P,    /* 2200 x 1125 @120 */
+	XVIDC_VM_1920x2160_60_P,     /* 2200 x 2250 @ 60 */
+	XVIDC_VM_1680x1050_50_P,     /* 2208 x 1083 @ 50 */
+	XVIDC_VM_1680x1050_60_P,     /* 2240 x 1089 @ 60 */
+	XVIDC_VM_1680x1050_75_P,     /* 2272 x 1099 @ 75 */
+	XVIDC_VM_1680x1050_85_P,     /* 2288 x 1105 @ 85 */
+	XVIDC_VM_1792x1344_60_P,     /* 2448 x 1394 @ 60 */
+	XVIDC_VM_1792x1344_75_P,     /* 2456 x 1417 @ 75 */
+	XVIDC_VM_1856x1392_60_P,     /* 2528 x 1439 @ 60 */
+	XVIDC_VM_1856x1392_75_P,     /* 2560 x 1500 @ 75 */
+	XVIDC_VM_1920x1200_60_P,     /* 2592 x 1245 @ 60 */
+	XVIDC_VM_1920x1440_60_P,     /* 2600 x 1500 @ 60 */
+	XVIDC_VM_1920x1200_75_P,     /* 2608 x 1255 @ 75 */
+	XVIDC_VM_1920x1200_85_P,     /* 2624 x 1262 @ 85 */
+	XVIDC_VM_1920x1080_25_P,     /* 2640 x 1125 @ 25 */
+	XVIDC_VM_1920x1080_50_P,     /* 2640 x 1125 @ 50 */
+	XVIDC_VM_1920x1080_50_I,     /* 2640 x 1125 @ 50 (I) */
+	XVIDC_VM_1920x1080_100_P,    /* 2640 x 1125 @100 */
+	XVIDC_VM_1920x1440_75_P,     /* 2640 x 1500 @ 75 */
+	XVIDC_VM_2560x1600_60_P_RB,  /* 2720 x 1646 @ 60 */
+	XVIDC_VM_2560x1600_120_P_RB, /* 2720 x 1694 @120 */
+	XVIDC_VM_1920x1080_24_P,     /* 2750 x 1125 @ 24 */
+	XVIDC_VM_2560x1080_100_P,    /* 2970 x 1250 @100 */
+	XVIDC_VM_2560x1080_60_P,     /* 3000 x 1100 @ 60 */
+	XVIDC_VM_2560x1080_50_P,     /* 3300 x 1125 @ 50 */
+	XVIDC_VM_2560x1080_120_P,    /* 3300 x 1250 @120 */
+	XVIDC_VM_2560x1600_60_P,     /* 3504 x 1658 @ 60 */
+	XVIDC_VM_2560x1600_75_P,     /* 3536 x 1672 @ 75 */
+	XVIDC_VM_2560x1600_85_P,     /* 3536 x 1682 @ 85 */
+	XVIDC_VM_4096x2160_60_P_RB,  /* 4176 x 2222 @ 60 */
+	XVIDC_VM_3840x2160_30_P,     /* 4400 x 2250 @ 30 */
+	XVIDC_VM_4096x2160_30_P,     /* 4400 x 2250 @ 30 */
+	XVIDC_VM_3840x2160_60_P,     /* 4400 x 2250 @ 60 */
+	XVIDC_VM_4096x2160_60_P,     /* 4400 x 2250 @ 60 */
+	XVIDC_VM_3840x2160_25_P,     /* 5280 x 2250 @ 25 */
+	XVIDC_VM_4096x2160_25_P,     /* 5280 x 2250 @ 25 */
+	XVIDC_VM_3840x2160_50_P,     /* 5280 x 2250 @ 50 */
+	XVIDC_VM_4096x2160_50_P,     /* 5280 x 2250 @ 50 */
+	XVIDC_VM_3840x2160_24_P,     /* 5500 x 2250 @ 24 */
+	XVIDC_VM_4096x2160_24_P,     /* 5500 x 2250 @ 24 */
+};
 /** @} */
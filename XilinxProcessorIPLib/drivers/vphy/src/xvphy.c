@@ -47,6 +47,8 @@
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als, 10/19/15 Initial release.
  *       gm
+ * 1.1   ms   10/19/26 Memoized the PLL divider search in XVphy_PllCalculator.
+ *                     Added XVphy_PllCachePreload and XVphy_PllCacheReset.
  * </pre>
  *
 *******************************************************************************/
@@ -78,6 +80,8 @@ static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 static u32 XVphy_PllCalculator(XVphy *InstancePtr, u8 QuadId,
 		XVphy_ChannelId ChId, XVphy_DirectionType Dir,
 		u32 PllClkInFreqHz);
+static XVphy_PllCacheEntry *XVphy_PllSearch(XVphy *InstancePtr, u8 QuadId,
+		XVphy_ChannelId ChId, u32 PllClkInFreqHz, u64 LineRateHz);
 
 /**************************** Function Definitions ****************************/
 
@@ -1866,6 +1870,64 @@ u32 XVphy_ClkCalcParams(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function solves the PLL dividers for a reference clock and line rate
+* ahead of time so that a later XVphy_ClkCalcParams call for the same
+* combination is answered from the PLL cache.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	QuadId is the GT quad ID to operate on.
+* @param	ChId is the channel ID of the PLL, XVPHY_CHANNEL_ID_CH1 to
+*		XVPHY_CHANNEL_ID_CMN1.
+* @param	PllClkInFreqHz is the PLL reference clock frequency.
+* @param	LineRateHz is the line rate to solve for.
+*
+* @return
+*		- XST_SUCCESS if valid PLL values exist for the combination.
+*		- XST_FAILURE otherwise.
+*
+* @note		The channel's PllParams structure is not modified. The result
+*		occupies a PLL cache entry either way.
+*
+******************************************************************************/
+u32 XVphy_PllCachePreload(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
+		u32 PllClkInFreqHz, u64 LineRateHz)
+{
+	XVphy_PllCacheEntry *SolutionPtr;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((XVPHY_CHANNEL_ID_CH1 <= ChId) &&
+			(ChId <= XVPHY_CHANNEL_ID_CMN1));
+
+	SolutionPtr = XVphy_PllSearch(InstancePtr, QuadId, ChId,
+			PllClkInFreqHz, LineRateHz);
+
+	return SolutionPtr->IsFound ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* This function drops all PLL divider solutions remembered by the driver and
+* clears the solver statistics.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XVphy_PllCacheReset(XVphy *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	(void)memset((void *)&InstancePtr->PllCache, 0,
+			sizeof(XVphy_PllCache));
+}
+
 /*****************************************************************************/
 /**
 * This function will set the current output divider configuration over DRP.
@@ -2302,18 +2364,18 @@ static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 *		- XST_FAILURE otherwise.
 *
 * @note		If successful, the channel's PllParams structure will be
-*		modified with the valid PLL parameters.
+*		modified with the valid PLL parameters. Repeated requests for
+*		the same reference clock and line rate are served from the PLL
+*		cache.
 *
 ******************************************************************************/
 static u32 XVphy_PllCalculator(XVphy *InstancePtr, u8 QuadId,
 		XVphy_ChannelId ChId, XVphy_DirectionType Dir,
 		u32 PllClkInFreqHz)
 {
-	u32 Status;
-	u64 PllClkOutFreqHz;
-	u64 CalcLineRateFreqHz;
 	u8 Id, Id0, Id1;
-	u64 PllClkInFreqHzIn = PllClkInFreqHz;
+	u32 PllClkInFreqHzIn = PllClkInFreqHz;
+	XVphy_PllCacheEntry *SolutionPtr;
 	XVphy_Channel *PllPtr = &InstancePtr->Quads[QuadId].
 		Plls[XVPHY_CH2IDX(ChId)];
 
@@ -2322,6 +2384,89 @@ static u32 XVphy_PllCalculator(XVphy *InstancePtr, u8 QuadId,
 					PllPtr->PllRefClkSel);
 	}
 
+	SolutionPtr = XVphy_PllSearch(InstancePtr, QuadId, ChId,
+			PllClkInFreqHzIn, PllPtr->LineRateHz);
+	if (!SolutionPtr->IsFound) {
+		/* Calculation failed, don't change divisor settings. */
+		return XST_FAILURE;
+	}
+
+	/* Found the multiplier and divisor values for requested line rate. */
+	PllPtr->PllParams.MRefClkDiv = SolutionPtr->M;
+	PllPtr->PllParams.NFbDiv = SolutionPtr->N1;
+	PllPtr->PllParams.N2FbDiv = SolutionPtr->N2; /* Won't be used for QPLL.*/
+	PllPtr->PllParams.IsLowerBand = 1; /* Won't be used for CPLL. */
+
+	if (XVPHY_ISCMN(ChId)) {
+		/* Same divisor value for all channels if using a QPLL. */
+		ChId = XVPHY_CHANNEL_ID_CHA;
+	}
+
+	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
+	for (Id = Id0; Id <= Id1; Id++) {
+		InstancePtr->Quads[QuadId].Plls[XVPHY_CH2IDX(Id)].OutDiv[Dir] =
+			SolutionPtr->D;
+		if (Dir == XVPHY_DIR_RX) {
+			XVphy_CfgSetCdr(InstancePtr, QuadId, Id);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function looks up the PLL divider values which produce the requested
+* line rate from the given reference clock. On a miss, all combinations of the
+* GT's divider tables are tried and the outcome, including the absence of a
+* solution, is remembered in the PLL cache.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	QuadId is the GT quad ID to operate on.
+* @param	ChId is the channel ID of the PLL to solve for.
+* @param	PllClkInFreqHz is the PLL reference clock frequency.
+* @param	LineRateHz is the line rate to solve for.
+*
+* @return	A pointer to the PLL cache entry holding the result. Its
+*		IsFound member is 0 if no combination satisfies the constraints.
+*
+* @note		The CPLLs of a quad share one divider table and VCO range so
+*		they share cache entries. The entry is only valid until the
+*		next call since it may be replaced by a later miss.
+*
+******************************************************************************/
+static XVphy_PllCacheEntry *XVphy_PllSearch(XVphy *InstancePtr, u8 QuadId,
+		XVphy_ChannelId ChId, u32 PllClkInFreqHz, u64 LineRateHz)
+{
+	u32 Status;
+	u8 Index;
+	u8 PllClass;
+	u64 PllClkOutFreqHz;
+	XVphy_PllCache *CachePtr = &InstancePtr->PllCache;
+	XVphy_PllCacheEntry *EntryPtr;
+
+	PllClass = XVPHY_ISCH(ChId) ? XVPHY_CHANNEL_ID_CH1 : ChId;
+
+	for (Index = 0; Index < XVPHY_PLL_CACHE_SIZE; Index++) {
+		EntryPtr = &CachePtr->Entries[Index];
+		if ((EntryPtr->PllClass == PllClass) &&
+				(EntryPtr->RefClkHz == PllClkInFreqHz) &&
+				(EntryPtr->LineRateHz == LineRateHz)) {
+			CachePtr->Hits++;
+			return EntryPtr;
+		}
+	}
+
+	/* Replace the oldest entry. */
+	CachePtr->Misses++;
+	EntryPtr = &CachePtr->Entries[CachePtr->NextIndex];
+	CachePtr->NextIndex = (CachePtr->NextIndex + 1) % XVPHY_PLL_CACHE_SIZE;
+
+	EntryPtr->PllClass = PllClass;
+	EntryPtr->RefClkHz = PllClkInFreqHz;
+	EntryPtr->LineRateHz = LineRateHz;
+	EntryPtr->IsFound = 0;
+
 	/* Select PLL value table offsets. */
 	const XVphy_GtPllDivs *GtPllDivs;
 	if (XVPHY_ISCH(ChId)) {
@@ -2335,7 +2480,8 @@ static u32 XVphy_PllCalculator(XVphy *InstancePtr, u8 QuadId,
 	for (N2 = GtPllDivs->N2; *N2 != 0; N2++) {
 	for (N1 = GtPllDivs->N1; *N1 != 0; N1++) {
 	for (M = GtPllDivs->M;   *M != 0;  M++) {
-		PllClkOutFreqHz = (PllClkInFreqHzIn * *N1 * *N2) / *M;
+		CachePtr->SearchSteps++;
+		PllClkOutFreqHz = ((u64)PllClkInFreqHz * *N1 * *N2) / *M;
 
 		/* Test if the calculated PLL clock is in the VCO range. */
 		Status = XVphy_CheckPllOpRange(InstancePtr, QuadId, ChId,
@@ -2349,37 +2495,20 @@ static u32 XVphy_PllCalculator(XVphy *InstancePtr, u8 QuadId,
 		}
 		/* Apply TX/RX divisor. */
 		for (D = GtPllDivs->D; *D != 0; D++) {
-			CalcLineRateFreqHz = PllClkOutFreqHz / *D;
-			if (CalcLineRateFreqHz == PllPtr->LineRateHz) {
-				goto calc_done;
+			if ((PllClkOutFreqHz / *D) == LineRateHz) {
+				/* Found the multiplier and divisor values for
+				 * requested line rate. */
+				EntryPtr->M = *M;
+				EntryPtr->N1 = *N1;
+				EntryPtr->N2 = *N2;
+				EntryPtr->D = *D;
+				EntryPtr->IsFound = 1;
+				return EntryPtr;
 			}
 		}
 	}
 	}
 	}
-	/* Calculation failed, don't change divisor settings. */
-	return XST_FAILURE;
-
-calc_done:
-	/* Found the multiplier and divisor values for requested line rate. */
-	PllPtr->PllParams.MRefClkDiv = *M;
-	PllPtr->PllParams.NFbDiv = *N1;
-	PllPtr->PllParams.N2FbDiv = *N2; /* Won't be used for QPLL.*/
-	PllPtr->PllParams.IsLowerBand = 1; /* Won't be used for CPLL. */
-
-	if (XVPHY_ISCMN(ChId)) {
-		/* Same divisor value for all channels if using a QPLL. */
-		ChId = XVPHY_CHANNEL_ID_CHA;
-	}
-
-	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
-	for (Id = Id0; Id <= Id1; Id++) {
-		InstancePtr->Quads[QuadId].Plls[XVPHY_CH2IDX(Id)].OutDiv[Dir] =
-			*D;
-		if (Dir == XVPHY_DIR_RX) {
-			XVphy_CfgSetCdr(InstancePtr, QuadId, Id);
-		}
-	}
 
-	return XST_SUCCESS;
+	return EntryPtr;
 }
@@ -48,6 +48,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  10/19/15 Initial release.
+ * 1.1   ms   10/19/26 Added XVphy_PllCache to memoize PLL divider searches.
  * </pre>
  *
 *******************************************************************************/
@@ -63,6 +64,11 @@
 #include "xvidc.h"
 #include "xvphy_dp.h"
 
+/************************** Constant Definitions ******************************/
+
+/* Number of PLL divider solutions remembered per XVphy instance. */
+#define XVPHY_PLL_CACHE_SIZE	32
+
 /****************************** Type Definitions ******************************/
 
 /* This typedef enumerates the different GT types available. */
@@ -489,6 +495,39 @@ typedef struct {
 						Event/DataBuffer. */
 } XVphy_Log;
 
+/**
+ * This typedef contains one memoized result of the GT PLL divider search.
+ */
+typedef struct {
+	u64 LineRateHz;			/**< Requested line rate. */
+	u32 RefClkHz;			/**< PLL reference clock frequency. */
+	u8 PllClass;			/**< XVPHY_CHANNEL_ID_CH1 for the CPLL,
+						XVPHY_CHANNEL_ID_CMN0/1 for the
+						QPLLs, 0 if the entry is
+						unused. */
+	u8 IsFound;			/**< A divider solution exists. */
+	u8 M;				/**< Reference clock divider. */
+	u8 N1;				/**< Feedback divider N1. */
+	u8 N2;				/**< Feedback divider N2. */
+	u8 D;				/**< TX/RX output divider. */
+} XVphy_PllCacheEntry;
+
+/**
+ * This typedef contains the PLL divider solutions found so far along with the
+ * solver statistics.
+ */
+typedef struct {
+	XVphy_PllCacheEntry Entries[XVPHY_PLL_CACHE_SIZE];
+	u8 NextIndex;			/**< Entry replaced by the next
+						miss. */
+	u32 Hits;			/**< Searches answered from the
+						cache. */
+	u32 Misses;			/**< Searches which walked the divider
+						tables. */
+	u32 SearchSteps;		/**< Divider combinations evaluated
+						by the missed searches. */
+} XVphy_PllCache;
+
 /**
  * This typedef contains configuration information for the Video PHY core.
  */
@@ -534,6 +573,8 @@ typedef struct {
 	u8 HdmiRxTmdsClockRatio;		/**< HDMI TMDS clock ratio. */
 	u8 HdmiTxSampleRate;			/**< HDMI TX sample rate. */
 	u8 HdmiRxDruIsEnabled;			/**< The DRU is enabled. */
+	XVphy_PllCache PllCache;		/**< Memoized PLL divider
+							solutions. */
 	XVphy_IntrHandler IntrCpllLockHandler;	/**< Callback function for CPLL
 							lock interrupts. */
 	void *IntrCpllLockCallbackRef;		/**< A pointer to the user data
@@ -664,6 +705,9 @@ void XVphy_CfgSysClkOutSel(XVphy *InstancePtr, u8 QuadId,
 
 u32 XVphy_ClkCalcParams(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		XVphy_DirectionType Dir, u32 PllClkInFreqHz);
+u32 XVphy_PllCachePreload(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
+		u32 PllClkInFreqHz, u64 LineRateHz);
+void XVphy_PllCacheReset(XVphy *InstancePtr);
 u32 XVphy_OutDivReconfig(XVphy *InstancePtr, u8 QuadId,
 				XVphy_ChannelId ChId, XVphy_DirectionType Dir);
 u32 XVphy_DirReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
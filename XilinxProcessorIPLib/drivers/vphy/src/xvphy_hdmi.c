@@ -44,6 +44,9 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   gm   10/19/15 Initial release.
+ * 1.1   ms   10/19/26 Preload the PLL cache with the standard HDMI rates in
+ *                     XVphy_HdmiInitialize. Added XVphy_HdmiGetQpllId.
+ *                     XVphy_HdmiDebugInfo reports the PLL solver statistics.
  * </pre>
  *
 *******************************************************************************/
@@ -77,6 +80,23 @@ extern void XVphy_Ch2Ids(XVphy *InstancePtr, XVphy_ChannelId ChId,
 		u8 *Id0, u8 *Id1);
 static const XVphy_GtHdmiChars *GetGtHdmiPtr(XVphy *InstancePtr);
 static void XVphy_HdmiSetSystemClockSelection(XVphy *InstancePtr, u8 QuadId);
+static XVphy_ChannelId XVphy_HdmiGetQpllId(XVphy *InstancePtr, u32 QpllRefClk,
+		u32 *QpllClkMinPtr);
+static void XVphy_HdmiPllCachePreload(XVphy *InstancePtr, u8 QuadId);
+
+/************************** Variable Definitions *****************************/
+
+/* TMDS clocks (Hz) of the common HDMI video formats, terminated by 0. */
+static const u32 XVphy_HdmiStdTmdsClkHz[] = {
+	25200000,	/* 640x480p60. */
+	27000000,	/* 720x480p60, 720x576p50. */
+	54000000,	/* 1440x480p60, 1440x576p50. */
+	74250000,	/* 1280x720p, 1920x1080i. */
+	148500000,	/* 1920x1080p60. */
+	297000000,	/* 3840x2160p30. */
+	594000000,	/* 3840x2160p60. */
+	0
+};
 
 /**************************** Function Definitions ****************************/
 
@@ -142,6 +162,10 @@ u32 XVphy_HdmiInitialize(XVphy *InstancePtr, u8 QuadId, XVphy_Config *CfgPtr,
 
 	XVphy_HdmiSetSystemClockSelection(InstancePtr, QuadId);
 
+	/* Solve the PLL dividers of the common video formats up front so that
+	 * rate changes to these formats skip the divider search. */
+	XVphy_HdmiPllCachePreload(InstancePtr, QuadId);
+
 	if (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE3) {
 		XVphy_SetBufgGtDiv(InstancePtr, XVPHY_DIR_TX, 1);
 		XVphy_SetBufgGtDiv(InstancePtr, XVPHY_DIR_RX, 1);
@@ -1215,36 +1239,22 @@ u32 XVphy_HdmiQpllParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		QpllRefClk = InstancePtr->HdmiTxRefClkHz;
 		RefClkPtr = &InstancePtr->HdmiTxRefClkHz;
 	}
+	/* Determine which QPLL to use. */
+	ActiveCmnId = XVphy_HdmiGetQpllId(InstancePtr, QpllRefClk, &QpllClkMin);
 	if (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE3) {
-		/* Determine which QPLL to use. */
-		if (((101875000 <= QpllRefClk) && (QpllRefClk <= 122500000)) ||
-			((203750000 <= QpllRefClk) &&
-				(QpllRefClk <= 245000000)) ||
-			((407000000 <= QpllRefClk) &&
-				(QpllRefClk <= 490000000))) {
+		if (ActiveCmnId == XVPHY_CHANNEL_ID_CMN1) {
 			SysClkDataSel = XVPHY_SYSCLKSELDATA_TYPE_QPLL1_OUTCLK;
 			SysClkOutSel = XVPHY_SYSCLKSELOUT_TYPE_QPLL1_REFCLK;
-			ActiveCmnId = XVPHY_CHANNEL_ID_CMN1;
-			QpllClkMin = (u32) XVPHY_HDMI_GTHE3_QPLL1_REFCLK_MIN;
 		}
 		else {
 			SysClkDataSel = XVPHY_SYSCLKSELDATA_TYPE_QPLL0_OUTCLK;
 			SysClkOutSel = XVPHY_SYSCLKSELOUT_TYPE_QPLL0_REFCLK;
-			ActiveCmnId = XVPHY_CHANNEL_ID_CMN0;
-			QpllClkMin = (u32) XVPHY_HDMI_GTHE3_QPLL0_REFCLK_MIN;
 		}
 	}
-	else if (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE2) {
-		SysClkDataSel = XVPHY_SYSCLKSELDATA_TYPE_QPLL_OUTCLK;
-		SysClkOutSel = XVPHY_SYSCLKSELOUT_TYPE_QPLL_REFCLK;
-		ActiveCmnId = XVPHY_CHANNEL_ID_CMN;
-		QpllClkMin = (GetGtHdmiPtr(InstancePtr))->Qpll0RefClkMin;
-	}
-	else if (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTXE2) {
+	else if ((InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE2) ||
+		(InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTXE2)) {
 		SysClkDataSel = XVPHY_SYSCLKSELDATA_TYPE_QPLL_OUTCLK;
 		SysClkOutSel = XVPHY_SYSCLKSELOUT_TYPE_QPLL_REFCLK;
-		ActiveCmnId = XVPHY_CHANNEL_ID_CMN;
-		QpllClkMin = (GetGtHdmiPtr(InstancePtr))->Qpll0RefClkMin;
 	}
 
 	/* Update QPLL clock selections. */
@@ -1410,6 +1420,139 @@ u32 XVphy_HdmiQpllParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 	return (XST_FAILURE);
 }
 
+/*****************************************************************************/
+/**
+* This function determines which QPLL serves a given HDMI reference clock and
+* the minimum reference clock that QPLL accepts.
+*
+* @param	InstancePtr is a pointer to the HDMI GT core instance.
+* @param	QpllRefClk is the HDMI reference clock in Hz.
+* @param	QpllClkMinPtr will be set to the minimum QPLL reference clock
+*		in Hz.
+*
+* @return	The channel ID of the QPLL to use.
+*
+* @note		Only the GTHE3 has a second QPLL.
+*
+******************************************************************************/
+static XVphy_ChannelId XVphy_HdmiGetQpllId(XVphy *InstancePtr, u32 QpllRefClk,
+		u32 *QpllClkMinPtr)
+{
+	if (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE3) {
+		if (((101875000 <= QpllRefClk) && (QpllRefClk <= 122500000)) ||
+			((203750000 <= QpllRefClk) &&
+				(QpllRefClk <= 245000000)) ||
+			((407000000 <= QpllRefClk) &&
+				(QpllRefClk <= 490000000))) {
+			*QpllClkMinPtr = (u32) XVPHY_HDMI_GTHE3_QPLL1_REFCLK_MIN;
+			return XVPHY_CHANNEL_ID_CMN1;
+		}
+		*QpllClkMinPtr = (u32) XVPHY_HDMI_GTHE3_QPLL0_REFCLK_MIN;
+		return XVPHY_CHANNEL_ID_CMN0;
+	}
+
+	else if ((InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE2) ||
+		(InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTXE2)) {
+		*QpllClkMinPtr = (GetGtHdmiPtr(InstancePtr))->Qpll0RefClkMin;
+		return XVPHY_CHANNEL_ID_CMN;
+	}
+
+	*QpllClkMinPtr = 0;
+	return XVPHY_CHANNEL_ID_CMN0;
+}
+
+/*****************************************************************************/
+/**
+* This function solves the PLL dividers of the formats listed in
+* XVphy_HdmiStdTmdsClkHz for the PLLs currently selected for TX and RX. The
+* reference clock and line rate combinations follow the ones tried by
+* XVphy_HdmiQpllParam and XVphy_HdmiCpllParam, including the TX oversampling
+* rates.
+*
+* @param	InstancePtr is a pointer to the HDMI GT core instance.
+* @param	QuadId is the GT quad ID to operate on.
+*
+* @return	None.
+*
+* @note		Formats received through the DRU are solved on first use.
+*
+******************************************************************************/
+static void XVphy_HdmiPllCachePreload(XVphy *InstancePtr, u8 QuadId)
+{
+	u32 Status;
+	const u32 *TmdsClkPtr;
+	u32 RefClk;
+	u32 SRRefClk;
+	u64 LineRate;
+	u8 Ratio;
+	u8 SRArray[] = {1, 3, 5};
+	u8 SRIndex;
+	u32 RefClkMin;
+	XVphy_ChannelId PllId;
+
+	/* Only the GT types with HDMI support have divider tables. */
+	if (GetGtHdmiPtr(InstancePtr) == NULL) {
+		return;
+	}
+
+	for (TmdsClkPtr = XVphy_HdmiStdTmdsClkHz; *TmdsClkPtr != 0;
+							TmdsClkPtr++) {
+		/* Above 340 Mcsc the reference clock is a quarter of the TMDS
+		 * character rate. */
+		RefClk = *TmdsClkPtr;
+		Ratio = 10;
+		if ((RefClk / 100000) >= 3400) {
+			RefClk = RefClk / 4;
+			Ratio = 40;
+		}
+
+		/* TX. */
+		if (XVphy_IsTxUsingCpll(InstancePtr, QuadId,
+					XVPHY_CHANNEL_ID_CH1)) {
+			/* The CPLL always scales the reference clock with the
+			 * sample rate. */
+			PllId = XVPHY_CHANNEL_ID_CH1;
+			RefClkMin = 0xFFFFFFFF;
+		}
+		else {
+			PllId = XVphy_HdmiGetQpllId(InstancePtr, *TmdsClkPtr,
+					&RefClkMin);
+		}
+		for (SRIndex = 0; SRIndex < sizeof(SRArray); SRIndex++) {
+			if (RefClk < RefClkMin) {
+				SRRefClk = RefClk * SRArray[SRIndex];
+				LineRate = (u64)SRRefClk * Ratio;
+			}
+			else {
+				SRRefClk = RefClk;
+				LineRate = (u64)RefClk * Ratio *
+					SRArray[SRIndex];
+			}
+			Status = XVphy_PllCachePreload(InstancePtr, QuadId,
+					PllId, SRRefClk, LineRate);
+			if (Status == (XST_SUCCESS)) {
+				break;
+			}
+		}
+
+		/* RX. */
+		if (XVphy_IsRxUsingCpll(InstancePtr, QuadId,
+					XVPHY_CHANNEL_ID_CH1)) {
+			PllId = XVPHY_CHANNEL_ID_CH1;
+			RefClkMin = (GetGtHdmiPtr(InstancePtr))->
+				CpllRefClkMin;
+		}
+		else {
+			PllId = XVphy_HdmiGetQpllId(InstancePtr, RefClk,
+					&RefClkMin);
+		}
+		if (RefClk >= RefClkMin) {
+			XVphy_PllCachePreload(InstancePtr, QuadId, PllId,
+					RefClk, (u64)RefClk * Ratio);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function calculates the CPLL parameters.
@@ -1945,6 +2088,14 @@ void XVphy_HdmiDebugInfo(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId)
 
 		xil_printf(" \n\r");
 	}
+
+	xil_printf("PLL solver\n\r");
+	xil_printf("-------------\n\r");
+	xil_printf("Hits : %d - Misses : %d - Divider combinations : %d\n\r",
+			InstancePtr->PllCache.Hits,
+			InstancePtr->PllCache.Misses,
+			InstancePtr->PllCache.SearchSteps);
+	xil_printf("\n\r");
 }
 
 static const XVphy_GtHdmiChars Gthe3HdmiChars = {
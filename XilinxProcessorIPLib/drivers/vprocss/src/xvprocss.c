@@ -43,6 +43,9 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   08/28/15   Initial Release
+* 1.01  ms    10/19/26   Skip pipe reset and reprogram only changed sub-cores
+*                        when data path and input stream are unchanged.
+*                        Added reconfiguration latency statistics
 
 * </pre>
 *
@@ -133,6 +136,7 @@ static int ValidateScalerOnlyConfig(XVidC_VideoStream *pStrmIn,
                                     XVidC_VideoStream *pStrmOut);
 static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeMax(XVprocSs *XVprocSsPtr);
+static int IsActiveInputStream(XVprocSs *XVprocSsPtr);
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /*****************************************************************************/
@@ -346,6 +350,33 @@ void XVprocSs_SetUserTimerHandler(XVprocSs *InstancePtr,
   InstancePtr->UsrTmrPtr  = CallbackRef;
 }
 
+/*****************************************************************************/
+/**
+* This function registers the user defined time stamp function with subsystem.
+* It is used to measure the time spent reconfiguring the processing pipe
+*
+* @param  InstancePtr is a pointer to the Subsystem instance
+* @param  CallbackFunc is the function pointer to the user defined time stamp
+*         function. It must return a free running counter value
+* @param  CallbackRef is the pointer passed to the time stamp function
+*
+* @return None
+*
+* @note   Reported times are in units of the registered counter
+*
+******************************************************************************/
+void XVprocSs_SetUserTimeStampHandler(XVprocSs *InstancePtr,
+                                      XVprocSs_TimeStampHandler CallbackFunc,
+                                      void *CallbackRef)
+{
+  /* Verify arguments */
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(CallbackFunc != NULL);
+
+  InstancePtr->UsrTimeStamp    = CallbackFunc;
+  InstancePtr->UsrTimeStampRef = CallbackRef;
+}
+
 /*****************************************************************************/
 /**
 * This function queries the subsystem instance configuration to determine
@@ -604,6 +635,9 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr, XVprocSs_Config *CfgPtr,
     }
   }
 
+  /* Clear reconfiguration statistics */
+  memset(&XVprocSsPtr->ReconfigStats, 0, sizeof(XVprocSs_ReconfigStats));
+
   /* Set subsystem to power on default state */
   SetPowerOnDefaultState(InstancePtr);
 
@@ -872,6 +906,18 @@ void XVprocSs_Reset(XVprocSs *InstancePtr)
 
   /* Reset start core flags */
   memset(InstancePtr->CtxtData.StartCore, 0, sizeof(InstancePtr->CtxtData.StartCore));
+
+  /* Sub-cores need to be programmed again after reset */
+  memset(InstancePtr->CtxtData.CoreParam, 0, sizeof(InstancePtr->CtxtData.CoreParam));
+  if(InstancePtr->HscalerPtr)
+  {
+    XV_HScalerInvalidateCache(&InstancePtr->HscL2Reg);
+  }
+  if(InstancePtr->VscalerPtr)
+  {
+    XV_VScalerInvalidateCache(&InstancePtr->VscL2Reg);
+  }
+  InstancePtr->CtxtData.PipeValid = FALSE;
 }
 
 /*****************************************************************************/
@@ -1020,6 +1066,10 @@ void XVprocSs_UpdateZoomPipWindow(XVprocSs *InstancePtr)
                           InstancePtr->VidOut.Timing.HActive,
                           InstancePtr->VidOut.Timing.VActive);
     }
+
+    /* Sub-cores no longer hold the parameters stored at last configuration */
+    InstancePtr->CtxtData.CoreParam[XVPROCSS_SUBCORE_VDMA].Valid = FALSE;
+    InstancePtr->CtxtData.CoreParam[XVPROCSS_SUBCORE_LBOX].Valid = FALSE;
   }
   else //Scaler Only Config
   {
@@ -1283,6 +1333,8 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 {
   u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
   u32 hsc_HeightIn, hsc_WidthIn, hsc_WidthOut;
+  u32 Param[XVPROCSS_CORE_PARAM_MAX];
+  u32 StartTime;
   int status = XST_SUCCESS;
 
   vsc_WidthIn = vsc_HeightIn = vsc_HeightOut = 0;
@@ -1300,8 +1352,21 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 
   if(status ==  XST_SUCCESS)
   {
-    /* Reset All IP Blocks */
-    XVprocSs_Reset(XVprocSsPtr);
+    if(IsActiveInputStream(XVprocSsPtr))
+    {
+      /* Scalers keep running - update changed scaler in place */
+      XVprocSsPtr->ReconfigStats.NumFastPath++;
+    }
+    else
+    {
+      StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+
+      /* Reset All IP Blocks */
+      XVprocSs_Reset(XVprocSsPtr);
+
+      XVprocSsPtr->ReconfigStats.ResetTime =
+                              XVprocSs_GetTimeStamp(XVprocSsPtr) - StartTime;
+    }
 
     /* UpScale mode V Scaler is before H Scaler */
     vsc_WidthIn   = XVprocSsPtr->VidIn.Timing.HActive;
@@ -1313,24 +1378,41 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
     hsc_WidthOut = XVprocSsPtr->VidOut.Timing.HActive;
 
     /* Configure scaler to scale input to output resolution */
-    xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure VScaler for %dx%d to %dx%d\r\n", \
-            (int)vsc_WidthIn, (int)vsc_HeightIn, (int)vsc_WidthIn, (int)vsc_HeightOut);
-
-    XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
-		            &XVprocSsPtr->VscL2Reg,
-                    vsc_WidthIn,
-                    vsc_HeightIn,
-                    vsc_HeightOut);
-
-    xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure HScaler for %dx%d to %dx%d\r\n", \
-                       (int)hsc_WidthIn, (int)hsc_HeightIn, (int)hsc_WidthOut, (int)hsc_HeightIn);
+    Param[0] = vsc_WidthIn;
+    Param[1] = vsc_HeightIn;
+    Param[2] = vsc_HeightOut;
+    if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_V, Param, 3))
+    {
+      xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure VScaler for %dx%d to %dx%d\r\n", \
+              (int)vsc_WidthIn, (int)vsc_HeightIn, (int)vsc_WidthIn, (int)vsc_HeightOut);
+
+      StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+      XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
+		              &XVprocSsPtr->VscL2Reg,
+                      vsc_WidthIn,
+                      vsc_HeightIn,
+                      vsc_HeightOut);
+      XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_V, StartTime);
+    }
 
-    XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
-		            &XVprocSsPtr->HscL2Reg,
-                    hsc_HeightIn,
-                    hsc_WidthIn,
-                    hsc_WidthOut,
-                    XVprocSsPtr->VidIn.ColorFormatId);
+    Param[0] = hsc_HeightIn;
+    Param[1] = hsc_WidthIn;
+    Param[2] = hsc_WidthOut;
+    Param[3] = XVprocSsPtr->VidIn.ColorFormatId;
+    if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_H, Param, 4))
+    {
+      xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure HScaler for %dx%d to %dx%d\r\n", \
+                         (int)hsc_WidthIn, (int)hsc_HeightIn, (int)hsc_WidthOut, (int)hsc_HeightIn);
+
+      StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+      XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
+		              &XVprocSsPtr->HscL2Reg,
+                      hsc_HeightIn,
+                      hsc_WidthIn,
+                      hsc_WidthOut,
+                      XVprocSsPtr->VidIn.ColorFormatId);
+      XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_H, StartTime);
+    }
 
     /* Start Scaler sub-cores */
     XV_HScalerStart(XVprocSsPtr->HscalerPtr);
@@ -1338,6 +1420,10 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 
     /* Subsystem Ready to accept input stream - Enable Video Input */
     XVprocSs_EnableBlock(XVprocSsPtr->RstAxisPtr,  GPIO_CH_RESET_SEL, RESET_MASK_VIDEO_IN);
+
+    /* Save the input stream the pipe is running with */
+    XVprocSsPtr->CtxtData.ActiveVidIn = XVprocSsPtr->VidIn;
+    XVprocSsPtr->CtxtData.PipeValid = TRUE;
   }
   else
   {
@@ -1355,33 +1441,99 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
+* @note   If the new routing map and input stream match the running pipe,
+*         the pipe is not reset and only sub-cores with changed parameters
+*         are programmed. This covers Zoom/Pip window updates, frame rate
+*         and output side changes. The subsystem has a single reset line for
+*         all video IP blocks, so any other change resets the whole pipe
+*
 ******************************************************************************/
 static int SetupModeMax(XVprocSs *XVprocSsPtr)
 {
+  u8 PrevTable[XVPROCSS_SUBCORE_MAX];
+  u8 PrevNumCores;
+  u32 StartTime;
   int status;
 
+  /* Save routing map of the running pipe */
+  memcpy(PrevTable, XVprocSsPtr->CtxtData.RtngTable, sizeof(PrevTable));
+  PrevNumCores = XVprocSsPtr->CtxtData.RtrNumCores;
+
   /* Build Routing table */
   status = XVprocSs_BuildRoutingTable(XVprocSsPtr);
 
   if(status == XST_SUCCESS)
   {
-    /* Reset All IP Blocks */
-    XVprocSs_Reset(XVprocSsPtr);
+    if((IsActiveInputStream(XVprocSsPtr)) &&
+       (PrevNumCores == XVprocSsPtr->CtxtData.RtrNumCores) &&
+       (memcmp(PrevTable, XVprocSsPtr->CtxtData.RtngTable, PrevNumCores) == 0))
+    {
+      /* Data path unchanged - update changed sub-cores in place */
+      xdbg_printf(XDBG_DEBUG_GENERAL,"  ->Routing Map unchanged. Pipe reset skipped\r\n");
+      XVprocSsPtr->ReconfigStats.NumFastPath++;
+    }
+    else
+    {
+      StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
 
-    /* Set AXI Switch registers */
-    XVprocSs_ProgRouterMux(XVprocSsPtr);
+      /* Reset All IP Blocks */
+      XVprocSs_Reset(XVprocSsPtr);
+
+      /* Set AXI Switch registers */
+      XVprocSs_ProgRouterMux(XVprocSsPtr);
+
+      XVprocSsPtr->ReconfigStats.ResetTime =
+                              XVprocSs_GetTimeStamp(XVprocSsPtr) - StartTime;
+    }
 
     /* program use case */
     XVprocSs_SetupRouterDataFlow(XVprocSsPtr);
+
+    /* Save the input stream the pipe is running with */
+    XVprocSsPtr->CtxtData.ActiveVidIn = XVprocSsPtr->VidIn;
+    XVprocSsPtr->CtxtData.PipeValid = TRUE;
   }
   else
   {
+    /* Routing map of the running pipe has been overwritten */
+    XVprocSsPtr->CtxtData.PipeValid = FALSE;
+
 	xdbg_printf(XDBG_DEBUG_GENERAL,"VPROCSS ERR: Subsystem Routing Table Invalid");
 	xdbg_printf(XDBG_DEBUG_GENERAL,"- Ignoring Configuration Request\r\n");
   }
   return(status);
 }
 
+/*****************************************************************************/
+/**
+* This function checks if the subsystem pipe is running and configured for
+* the current input stream. Only fields that change the sub-core programming
+* are compared; custom modes share one VmId, so the active size is compared
+* as well. A frame rate change alone keeps the pipe running.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return TRUE if input stream is unchanged else FALSE
+*
+******************************************************************************/
+static int IsActiveInputStream(XVprocSs *XVprocSsPtr)
+{
+  XVidC_VideoStream *ActiveInPtr = &XVprocSsPtr->CtxtData.ActiveVidIn;
+  XVidC_VideoStream *StrmInPtr   = &XVprocSsPtr->VidIn;
+
+  if(!XVprocSsPtr->CtxtData.PipeValid)
+  {
+    return(FALSE);
+  }
+
+  return((ActiveInPtr->VmId          == StrmInPtr->VmId)          &&
+         (ActiveInPtr->ColorFormatId == StrmInPtr->ColorFormatId) &&
+         (ActiveInPtr->ColorDepth    == StrmInPtr->ColorDepth)    &&
+         (ActiveInPtr->IsInterlaced  == StrmInPtr->IsInterlaced)  &&
+         (ActiveInPtr->Timing.HActive == StrmInPtr->Timing.HActive) &&
+         (ActiveInPtr->Timing.VActive == StrmInPtr->Timing.VActive));
+}
+
 
 /*****************************************************************************/
 /**
@@ -1503,11 +1655,18 @@ static int ValidateSubsystemConfig(XVprocSs *InstancePtr)
 ******************************************************************************/
 int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
 {
+  XVprocSs_ReconfigStats *StatsPtr;
+  u32 StartTime;
   int status = XST_SUCCESS;
 
   /* Verify arguments */
   Xil_AssertNonvoid(InstancePtr != NULL);
 
+  StatsPtr  = &InstancePtr->ReconfigStats;
+  StartTime = XVprocSs_GetTimeStamp(InstancePtr);
+  StatsPtr->ResetTime = 0;
+  memset(StatsPtr->CoreTime, 0, sizeof(StatsPtr->CoreTime));
+
 #ifdef DEBUG
   xil_printf("\r\n****** VPROC SUBSYSTEM INPUT/OUTPUT CONFIG ******\r\n");
   xil_printf("->INPUT\r\n");
@@ -1539,6 +1698,16 @@ int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
         status = XST_FAILURE;
         break;
   }
+
+  if(status == XST_SUCCESS)
+  {
+    StatsPtr->NumReconfig++;
+    StatsPtr->TotalTime = XVprocSs_GetTimeStamp(InstancePtr) - StartTime;
+    if(StatsPtr->TotalTime > StatsPtr->MaxTotalTime)
+    {
+      StatsPtr->MaxTotalTime = StatsPtr->TotalTime;
+    }
+  }
   return(status);
 }
 
@@ -1619,6 +1788,66 @@ void XVprocSs_ReportSubsystemConfig(XVprocSs *InstancePtr)
   xil_printf("**************************************************\r\n\r\n");
 }
 
+/*****************************************************************************/
+/**
+* This function reports the time spent reconfiguring the processing pipe.
+* Time per sub-core is for the last configuration request. Sub-cores skipped
+* as unchanged report 0
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return None
+*
+* @note   Times are in units of the time stamp handler registered using
+*         XVprocSs_SetUserTimeStampHandler()
+*
+******************************************************************************/
+void XVprocSs_ReportReconfigStats(XVprocSs *InstancePtr)
+{
+  const char *ipStr[XVPROCSS_SUBCORE_MAX] =
+  {
+    "",
+    "SCALER-V",
+    "SCALER-H",
+    "VDMA",
+    "LBOX",
+    "CR-H",
+    "CR-VIn",
+    "CR-VOut",
+    "CSC",
+    "DEINT",
+  };
+  XVprocSs_ReconfigStats *StatsPtr;
+  u32 index;
+
+  /* Verify arguments */
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  StatsPtr = &InstancePtr->ReconfigStats;
+
+  xil_printf("\r\n****** Video Processing Subsystem Reconfiguration ******\r\n");
+  if(!InstancePtr->UsrTimeStamp)
+  {
+    xil_printf("No time stamp handler registered\r\n");
+  }
+  xil_printf("Requests Applied     = %d\r\n", StatsPtr->NumReconfig);
+  xil_printf("Applied w/o Reset    = %d\r\n", StatsPtr->NumFastPath);
+  xil_printf("Last Request Time    = %d\r\n", StatsPtr->TotalTime);
+  xil_printf("Max Request Time     = %d\r\n", StatsPtr->MaxTotalTime);
+  xil_printf("Reset + Router Time  = %d\r\n", StatsPtr->ResetTime);
+
+  xil_printf("\r\n%-10s %10s %10s %10s\r\n", "Sub-core", "Time", "Programmed", "Skipped");
+  for(index=XVPROCSS_SUBCORE_SCALER_V; index<XVPROCSS_SUBCORE_MAX; ++index)
+  {
+    xil_printf("%-10s %10d %10d %10d\r\n",
+               ipStr[index],
+               StatsPtr->CoreTime[index],
+               StatsPtr->CoreProgCnt[index],
+               StatsPtr->CoreSkipCnt[index]);
+  }
+  xil_printf("**************************************************\r\n\r\n");
+}
+
 
 /*****************************************************************************/
 /**
@@ -2209,6 +2438,8 @@ void XVprocSs_LoadScalerCoeff(XVprocSs *InstancePtr,
 		                     num_phases,
 		                     num_taps,
 		                     Coeff);
+	  /* New coefficients are programmed at next configuration */
+	  InstancePtr->CtxtData.CoreParam[CoreId].Valid = FALSE;
         }
         else
         {
@@ -2225,6 +2456,8 @@ void XVprocSs_LoadScalerCoeff(XVprocSs *InstancePtr,
 		                     num_phases,
 		                     num_taps,
 		                     Coeff);
+	  /* New coefficients are programmed at next configuration */
+	  InstancePtr->CtxtData.CoreParam[CoreId].Valid = FALSE;
         }
 	else
 	{
@@ -2314,6 +2547,9 @@ void XVprocSs_LoadChromaResamplerCoeff(XVprocSs *InstancePtr,
 	default:
 	    break;
   }
+
+  /* New coefficients are programmed at next configuration */
+  InstancePtr->CtxtData.CoreParam[CoreId].Valid = FALSE;
 }
 
 /*****************************************************************************/
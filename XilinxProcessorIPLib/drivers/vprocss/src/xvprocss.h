@@ -176,6 +176,9 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   08/28/15  Initial Release
+* 1.01  ms    10/19/26  Reconfigure only the sub-cores whose parameters changed
+*                       and keep the pipe running if data path and input stream
+*                       are unchanged. Added reconfiguration latency statistics
 
 * </pre>
 *
@@ -207,6 +210,13 @@ extern "C" {
 #include "xv_vscaler_l2.h"
 #include "xv_letterbox_l2.h"
 
+/************************** Constant Definitions *****************************/
+/**
+ * Maximum number of parameters stored per sub-core to detect configuration
+ * changes
+ */
+#define XVPROCSS_CORE_PARAM_MAX        (12)
+
 /****************************** Type Definitions ******************************/
 /**
  *  This typedef enumerates the AXIS Switch Port for Sub-Core connection
@@ -269,6 +279,40 @@ typedef enum
   XVPROCSS_COLOR_CH_NUM_SUPPORTED
 }XVprocSs_ColorChannel;
 
+/**
+ * Parameters last programmed into a sub-core. Used to skip sub-cores whose
+ * configuration is unchanged when the processing pipe is updated
+ */
+typedef struct
+{
+  u8 Valid;                             /**< Param holds programmed values */
+  u32 Param[XVPROCSS_CORE_PARAM_MAX];   /**< Sub-core specific parameters */
+}XVprocSs_CoreParam;
+
+/**
+ * Reconfiguration latency statistics. Times are in units of the user
+ * registered time stamp handler and read 0 if no handler is registered
+ */
+typedef struct
+{
+  u32 NumReconfig;   /**< Configuration requests applied */
+  u32 NumFastPath;   /**< Requests applied without resetting the pipe */
+  u32 TotalTime;     /**< Duration of the last request */
+  u32 MaxTotalTime;  /**< Longest request applied */
+  u32 ResetTime;     /**< Pipe reset and router setup time of last request */
+  u32 CoreTime[XVPROCSS_SUBCORE_MAX];    /**< Time spent per sub-core in the
+                                              last request */
+  u32 CoreProgCnt[XVPROCSS_SUBCORE_MAX]; /**< Times sub-core was programmed */
+  u32 CoreSkipCnt[XVPROCSS_SUBCORE_MAX]; /**< Times sub-core was skipped as
+                                              unchanged */
+}XVprocSs_ReconfigStats;
+
+/**
+ * Callback type returning a free running time stamp, used to measure the
+ * reconfiguration latency
+ */
+typedef u32 (*XVprocSs_TimeStampHandler)(void *CallbackRef);
+
 /**
  * Video Processing Subsystem context scratch pad memory.
  * This contains internal flags, state variables, routing table
@@ -298,6 +342,10 @@ typedef struct
   XVidC_ColorFormat CscOut; /**< CSC core output color format */
   XVidC_ColorFormat HcrIn;  /**< horiz. cresmplr core input color format */
   XVidC_ColorFormat HcrOut; /**< horiz. cresmplr core output color format */
+  u8 PipeValid;        /**< Flag to indicate pipe is configured and running */
+  XVidC_VideoStream ActiveVidIn; /**< Input stream the pipe is configured for */
+  XVprocSs_CoreParam CoreParam[XVPROCSS_SUBCORE_MAX]; /**< Parameters last
+                                                           programmed */
 }XVprocSs_ContextData;
 
 /**
@@ -389,6 +437,11 @@ typedef struct
   XVidC_DelayHandler UsrDelayUs; /**< custom user function for delay/sleep */
   void *UsrTmrPtr;                /**< handle to timer instance used by user
                                      delay function */
+  XVprocSs_TimeStampHandler UsrTimeStamp; /**< custom user function to read
+                                              time stamp */
+  void *UsrTimeStampRef;          /**< callback reference of user time stamp
+                                     function */
+  XVprocSs_ReconfigStats ReconfigStats; /**< Reconfiguration statistics */
 } XVprocSs;
 
 /************************** Macros Definitions *******************************/
@@ -594,10 +647,14 @@ void XVprocSs_ReportSubsystemConfig(XVprocSs *InstancePtr);
 void XVprocSs_ReportSubsystemCoreInfo(XVprocSs *InstancePtr);
 void XVprocSs_ReportSubcoreStatus(XVprocSs *InstancePtr,
 		                          u32 SubcoreId);
+void XVprocSs_ReportReconfigStats(XVprocSs *InstancePtr);
 
 void XVprocSs_SetUserTimerHandler(XVprocSs *InstancePtr,
                                   XVidC_DelayHandler CallbackFunc,
                                   void *CallbackRef);
+void XVprocSs_SetUserTimeStampHandler(XVprocSs *InstancePtr,
+                                      XVprocSs_TimeStampHandler CallbackFunc,
+                                      void *CallbackRef);
 
 #ifdef __cplusplus
 }
@@ -370,6 +370,9 @@ int XVprocSs_SubcoreInitHScaler(XVprocSs *XVprocSsPtr)
       xil_printf("VPROCSS ERR:: Horiz. Scaler Initialization failed\r\n");
       return(XST_FAILURE);
     }
+
+    /* Nothing cached in layer 2 data describes the core yet */
+    XV_HScalerInvalidateCache(&XVprocSsPtr->HscL2Reg);
   }
   return(XST_SUCCESS);
 }
@@ -423,6 +426,9 @@ int XVprocSs_SubcoreInitVScaler(XVprocSs *XVprocSsPtr)
       xil_printf("VPROCSS ERR:: Vert. Scaler Initialization failed\r\n");
       return(XST_FAILURE);
     }
+
+    /* Nothing cached in layer 2 data describes the core yet */
+    XV_VScalerInvalidateCache(&XVprocSsPtr->VscL2Reg);
   }
   return(XST_SUCCESS);
 }
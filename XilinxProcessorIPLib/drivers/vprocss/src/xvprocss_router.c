@@ -47,6 +47,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco  07/21/15   Initial Release
+* 1.01  ms   10/19/26   Program only the sub-cores whose parameters changed
+*                       and log time spent per sub-core
 
 * </pre>
 *
@@ -490,6 +492,63 @@ void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr)
   XAxisScr_RegUpdateEnable(XVprocSsPtr->RouterPtr);
 }
 
+/*****************************************************************************/
+/**
+* This function compares the parameters computed for a sub-core against the
+* ones last programmed into it. If they differ the new set is stored as the
+* programmed one
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  CoreId is the sub-core the parameters belong to
+* @param  Param is the array of computed parameters
+* @param  NumParam is the number of entries in Param
+*
+* @return TRUE if sub-core needs to be programmed else FALSE
+*
+******************************************************************************/
+int XVprocSs_CoreParamUpdate(XVprocSs *XVprocSsPtr,
+                             u32 CoreId,
+                             const u32 *Param,
+                             u32 NumParam)
+{
+  XVprocSs_CoreParam *CoreParamPtr;
+
+  Xil_AssertNonvoid(CoreId < XVPROCSS_SUBCORE_MAX);
+  Xil_AssertNonvoid(NumParam <= XVPROCSS_CORE_PARAM_MAX);
+
+  CoreParamPtr = &XVprocSsPtr->CtxtData.CoreParam[CoreId];
+  if((CoreParamPtr->Valid) &&
+     (memcmp(CoreParamPtr->Param, Param, NumParam*sizeof(u32)) == 0))
+  {
+    XVprocSsPtr->ReconfigStats.CoreSkipCnt[CoreId]++;
+    return(FALSE);
+  }
+
+  memcpy(CoreParamPtr->Param, Param, NumParam*sizeof(u32));
+  CoreParamPtr->Valid = TRUE;
+  return(TRUE);
+}
+
+/*****************************************************************************/
+/**
+* This function records the time spent programming a sub-core
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  CoreId is the sub-core that was programmed
+* @param  StartTime is the time stamp taken before programming the sub-core
+*
+* @return None
+*
+******************************************************************************/
+void XVprocSs_LogCoreTime(XVprocSs *XVprocSsPtr,
+                          u32 CoreId,
+                          u32 StartTime)
+{
+  XVprocSsPtr->ReconfigStats.CoreTime[CoreId] =
+                              XVprocSs_GetTimeStamp(XVprocSsPtr) - StartTime;
+  XVprocSsPtr->ReconfigStats.CoreProgCnt[CoreId]++;
+}
+
 /*****************************************************************************/
 /**
 * This function traverses the routing map built earlier and configures each
@@ -501,13 +560,19 @@ void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr)
 *
 * @return None
 *
+* @note   Parameters of each sub-core are compared with the ones last
+*         programmed and sub-cores with unchanged configuration are not
+*         touched. Sub-core parameters are invalidated on subsystem reset
+*
 ******************************************************************************/
 void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
 {
   XVidC_VideoWindow lboxWin;
+  const XVidC_VideoWindow *vdmaWin;
   u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
   u32 hsc_HeightIn, hsc_WidthIn, hsc_WidthOut;
-  u32 count;
+  u32 Param[XVPROCSS_CORE_PARAM_MAX];
+  u32 count, StartTime;
   XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
   u8 *pTable = &XVprocSsPtr->CtxtData.RtngTable[0];
   u8 *StartCorePtr = &XVprocSsPtr->CtxtData.StartCore[0];
@@ -529,19 +594,39 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
   /* If Vdma is enabled, RD/WR Client needs to be programmed before Scaler */
   if((XVprocSsPtr->VdmaPtr) && (CtxtPtr->MemEn))
   {
-    switch(CtxtPtr->ScaleMode)
+    /* Only the window of the enabled feature is used by VDMA */
+    vdmaWin = ((XVprocSs_IsPipModeOn(XVprocSsPtr)) ? &CtxtPtr->WrWindow
+                                                   : &CtxtPtr->RdWindow);
+    Param[0]  = CtxtPtr->ScaleMode;
+    Param[1]  = CtxtPtr->VidInWidth;
+    Param[2]  = CtxtPtr->VidInHeight;
+    Param[3]  = XVprocSsPtr->VidOut.Timing.HActive;
+    Param[4]  = XVprocSsPtr->VidOut.Timing.VActive;
+    Param[5]  = CtxtPtr->ZoomEn;
+    Param[6]  = CtxtPtr->PipEn;
+    Param[7]  = ((CtxtPtr->ZoomEn || CtxtPtr->PipEn) ? vdmaWin->StartX : 0);
+    Param[8]  = ((CtxtPtr->ZoomEn || CtxtPtr->PipEn) ? vdmaWin->StartY : 0);
+    Param[9]  = ((CtxtPtr->ZoomEn || CtxtPtr->PipEn) ? vdmaWin->Width  : 0);
+    Param[10] = ((CtxtPtr->ZoomEn || CtxtPtr->PipEn) ? vdmaWin->Height : 0);
+
+    if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_VDMA, Param, 11))
     {
-      case XVPROCSS_SCALE_1_1:
-      case XVPROCSS_SCALE_UP:
-          XVprocSs_VdmaSetWinToUpScaleMode(XVprocSsPtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
-          break;
-
-      case XVPROCSS_SCALE_DN:
-	      XVprocSs_VdmaSetWinToDnScaleMode(XVprocSsPtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
-          break;
-
-      default:
-          break;
+      StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+      switch(CtxtPtr->ScaleMode)
+      {
+        case XVPROCSS_SCALE_1_1:
+        case XVPROCSS_SCALE_UP:
+            XVprocSs_VdmaSetWinToUpScaleMode(XVprocSsPtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
+            break;
+
+        case XVPROCSS_SCALE_DN:
+	        XVprocSs_VdmaSetWinToDnScaleMode(XVprocSsPtr, XVPROCSS_VDMA_UPDATE_ALL_CH);
+            break;
+
+        default:
+            break;
+      }
+      XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_VDMA, StartTime);
     }
     StartCorePtr[XVPROCSS_SUBCORE_VDMA] = TRUE;
   }
@@ -571,14 +656,22 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
               vsc_HeightOut = XVprocSsPtr->VidOut.Timing.VActive;
             }
 
-            xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure VScaler for %dx%d to %dx%d\r\n", \
-                           (int)vsc_WidthIn, (int)vsc_HeightIn, (int)vsc_WidthIn, (int)vsc_HeightOut);
-
-            XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
-			                &XVprocSsPtr->VscL2Reg,
-                            vsc_WidthIn,
-                            vsc_HeightIn,
-                            vsc_HeightOut);
+            Param[0] = vsc_WidthIn;
+            Param[1] = vsc_HeightIn;
+            Param[2] = vsc_HeightOut;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_V, Param, 3))
+            {
+              xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure VScaler for %dx%d to %dx%d\r\n", \
+                             (int)vsc_WidthIn, (int)vsc_HeightIn, (int)vsc_WidthIn, (int)vsc_HeightOut);
+
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
+			                  &XVprocSsPtr->VscL2Reg,
+                              vsc_WidthIn,
+                              vsc_HeightIn,
+                              vsc_HeightOut);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_V, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_SCALER_V] = TRUE;
           }
           break;
@@ -602,15 +695,24 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
               hsc_WidthOut = XVprocSsPtr->VidOut.Timing.HActive;
             }
 
-            xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure HScaler for %dx%d to %dx%d\r\n", \
-                               (int)hsc_WidthIn, (int)hsc_HeightIn, (int)hsc_WidthOut, (int)hsc_HeightIn);
-
-            XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
-			                &XVprocSsPtr->HscL2Reg,
-                            hsc_HeightIn,
-                            hsc_WidthIn,
-                            hsc_WidthOut,
-                            XVprocSsPtr->CtxtData.StrmCformat);
+            Param[0] = hsc_HeightIn;
+            Param[1] = hsc_WidthIn;
+            Param[2] = hsc_WidthOut;
+            Param[3] = CtxtPtr->StrmCformat;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_H, Param, 4))
+            {
+              xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure HScaler for %dx%d to %dx%d\r\n", \
+                                 (int)hsc_WidthIn, (int)hsc_HeightIn, (int)hsc_WidthOut, (int)hsc_HeightIn);
+
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
+			                  &XVprocSsPtr->HscL2Reg,
+                              hsc_HeightIn,
+                              hsc_WidthIn,
+                              hsc_WidthOut,
+                              CtxtPtr->StrmCformat);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_SCALER_H, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_SCALER_H] = TRUE;
           }
           break;
@@ -635,17 +737,30 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
               lboxWin.Width  = XVprocSsPtr->VidOut.Timing.HActive;
               lboxWin.Height = XVprocSsPtr->VidOut.Timing.VActive;
             }
-            XV_LBoxSetActiveWin(XVprocSsPtr->LboxPtr,
-                                &lboxWin,
-                                XVprocSsPtr->VidOut.Timing.HActive,
-                                XVprocSsPtr->VidOut.Timing.VActive);
-
-            /* set background to default color on pipe reset */
-            XV_LboxSetBackgroundColor(XVprocSsPtr->LboxPtr,
-                                      XLBOX_BKGND_BLACK,
-                                      XVprocSsPtr->CtxtData.StrmCformat,
-                                      XVprocSsPtr->VidOut.ColorDepth);
 
+            Param[0] = lboxWin.StartX;
+            Param[1] = lboxWin.StartY;
+            Param[2] = lboxWin.Width;
+            Param[3] = lboxWin.Height;
+            Param[4] = XVprocSsPtr->VidOut.Timing.HActive;
+            Param[5] = XVprocSsPtr->VidOut.Timing.VActive;
+            Param[6] = CtxtPtr->StrmCformat;
+            Param[7] = XVprocSsPtr->VidOut.ColorDepth;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_LBOX, Param, 8))
+            {
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_LBoxSetActiveWin(XVprocSsPtr->LboxPtr,
+                                  &lboxWin,
+                                  XVprocSsPtr->VidOut.Timing.HActive,
+                                  XVprocSsPtr->VidOut.Timing.VActive);
+
+              /* set background to default color on pipe reset */
+              XV_LboxSetBackgroundColor(XVprocSsPtr->LboxPtr,
+                                        XLBOX_BKGND_BLACK,
+                                        XVprocSsPtr->CtxtData.StrmCformat,
+                                        XVprocSsPtr->VidOut.ColorDepth);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_LBOX, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_LBOX] = TRUE;
           }
           break;
@@ -653,14 +768,23 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
       case XVPROCSS_SUBCORE_CR_H:
           if(XVprocSsPtr->HcrsmplrPtr)
           {
-            XV_HCrsmplSetActiveSize(XVprocSsPtr->HcrsmplrPtr,
-                                    XVprocSsPtr->VidOut.Timing.HActive,
-                                    XVprocSsPtr->VidOut.Timing.VActive);
-
-            XV_HCrsmplSetFormat(XVprocSsPtr->HcrsmplrPtr,
-			                    &XVprocSsPtr->HcrL2Reg,
-                                CtxtPtr->HcrIn,
-                                CtxtPtr->HcrOut);
+            Param[0] = XVprocSsPtr->VidOut.Timing.HActive;
+            Param[1] = XVprocSsPtr->VidOut.Timing.VActive;
+            Param[2] = CtxtPtr->HcrIn;
+            Param[3] = CtxtPtr->HcrOut;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_CR_H, Param, 4))
+            {
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_HCrsmplSetActiveSize(XVprocSsPtr->HcrsmplrPtr,
+                                      XVprocSsPtr->VidOut.Timing.HActive,
+                                      XVprocSsPtr->VidOut.Timing.VActive);
+
+              XV_HCrsmplSetFormat(XVprocSsPtr->HcrsmplrPtr,
+			                      &XVprocSsPtr->HcrL2Reg,
+                                  CtxtPtr->HcrIn,
+                                  CtxtPtr->HcrOut);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_CR_H, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_CR_H] = TRUE;
           }
           break;
@@ -668,14 +792,21 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
       case XVPROCSS_SUBCORE_CR_V_IN:
           if(XVprocSsPtr->VcrsmplrInPtr)
           {
-            XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrInPtr,
-			                        CtxtPtr->VidInWidth,
-			                        CtxtPtr->VidInHeight);
-
-            XV_VCrsmplSetFormat(XVprocSsPtr->VcrsmplrInPtr,
-			                    &XVprocSsPtr->VcrInL2Reg,
-                                XVIDC_CSF_YCRCB_420,
-                                XVIDC_CSF_YCRCB_422);
+            Param[0] = CtxtPtr->VidInWidth;
+            Param[1] = CtxtPtr->VidInHeight;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_CR_V_IN, Param, 2))
+            {
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrInPtr,
+			                          CtxtPtr->VidInWidth,
+			                          CtxtPtr->VidInHeight);
+
+              XV_VCrsmplSetFormat(XVprocSsPtr->VcrsmplrInPtr,
+			                      &XVprocSsPtr->VcrInL2Reg,
+                                  XVIDC_CSF_YCRCB_420,
+                                  XVIDC_CSF_YCRCB_422);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_CR_V_IN, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_CR_V_IN] = TRUE;
           }
           break;
@@ -683,14 +814,21 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
       case XVPROCSS_SUBCORE_CR_V_OUT:
           if(XVprocSsPtr->VcrsmplrOutPtr)
           {
-            XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrOutPtr,
-                                    XVprocSsPtr->VidOut.Timing.HActive,
-                                    XVprocSsPtr->VidOut.Timing.VActive);
-
-            XV_VCrsmplSetFormat(XVprocSsPtr->VcrsmplrOutPtr,
-			                    &XVprocSsPtr->VcrOutL2Reg,
-                                XVIDC_CSF_YCRCB_422,
-                                XVIDC_CSF_YCRCB_420);
+            Param[0] = XVprocSsPtr->VidOut.Timing.HActive;
+            Param[1] = XVprocSsPtr->VidOut.Timing.VActive;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_CR_V_OUT, Param, 2))
+            {
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrOutPtr,
+                                      XVprocSsPtr->VidOut.Timing.HActive,
+                                      XVprocSsPtr->VidOut.Timing.VActive);
+
+              XV_VCrsmplSetFormat(XVprocSsPtr->VcrsmplrOutPtr,
+			                      &XVprocSsPtr->VcrOutL2Reg,
+                                  XVIDC_CSF_YCRCB_422,
+                                  XVIDC_CSF_YCRCB_420);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_CR_V_OUT, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_CR_V_OUT] = TRUE;
           }
           break;
@@ -698,18 +836,29 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
       case XVPROCSS_SUBCORE_CSC:
           if(XVprocSsPtr->CscPtr)
           {
-            XV_CscSetColorspace(XVprocSsPtr->CscPtr,
-                                &XVprocSsPtr->CscL2Reg,
-                                CtxtPtr->CscIn,
-                                CtxtPtr->CscOut,
-                                XVprocSsPtr->CscL2Reg.StandardIn,
-                                XVprocSsPtr->CscL2Reg.StandardOut,
-                                XVprocSsPtr->CscL2Reg.OutputRange);
-
-            XV_CscSetActiveSize(XVprocSsPtr->CscPtr,
-                                XVprocSsPtr->VidOut.Timing.HActive,
-                                XVprocSsPtr->VidOut.Timing.VActive);
-
+            Param[0] = CtxtPtr->CscIn;
+            Param[1] = CtxtPtr->CscOut;
+            Param[2] = XVprocSsPtr->CscL2Reg.StandardIn;
+            Param[3] = XVprocSsPtr->CscL2Reg.StandardOut;
+            Param[4] = XVprocSsPtr->CscL2Reg.OutputRange;
+            Param[5] = XVprocSsPtr->VidOut.Timing.HActive;
+            Param[6] = XVprocSsPtr->VidOut.Timing.VActive;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_CSC, Param, 7))
+            {
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_CscSetColorspace(XVprocSsPtr->CscPtr,
+                                  &XVprocSsPtr->CscL2Reg,
+                                  CtxtPtr->CscIn,
+                                  CtxtPtr->CscOut,
+                                  XVprocSsPtr->CscL2Reg.StandardIn,
+                                  XVprocSsPtr->CscL2Reg.StandardOut,
+                                  XVprocSsPtr->CscL2Reg.OutputRange);
+
+              XV_CscSetActiveSize(XVprocSsPtr->CscPtr,
+                                  XVprocSsPtr->VidOut.Timing.HActive,
+                                  XVprocSsPtr->VidOut.Timing.VActive);
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_CSC, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_CSC] = TRUE;
           }
           break;
@@ -717,23 +866,32 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
       case XVPROCSS_SUBCORE_DEINT:
           if(XVprocSsPtr->DeintPtr)
           {
-	        xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure Deinterlacer for %dx%d to %dx%d\r\n", \
-		              (int)XVprocSsPtr->VidIn.Timing.HActive,
-		              (int)XVprocSsPtr->VidIn.Timing.VActive,
-		              (int)CtxtPtr->VidInWidth,
-		              (int)CtxtPtr->VidInHeight);
+            Param[0] = CtxtPtr->DeintBufAddr;
+            Param[1] = XVprocSsPtr->VidIn.ColorFormatId;
+            Param[2] = CtxtPtr->VidInWidth;
+            Param[3] = XVprocSsPtr->VidIn.Timing.VActive;
+            if(XVprocSs_CoreParamUpdate(XVprocSsPtr, XVPROCSS_SUBCORE_DEINT, Param, 4))
+            {
+	          xdbg_printf(XDBG_DEBUG_GENERAL,"  -> Configure Deinterlacer for %dx%d to %dx%d\r\n", \
+		                (int)XVprocSsPtr->VidIn.Timing.HActive,
+		                (int)XVprocSsPtr->VidIn.Timing.VActive,
+		                (int)CtxtPtr->VidInWidth,
+		                (int)CtxtPtr->VidInHeight);
 
-            XV_DeintSetFieldBuffers(XVprocSsPtr->DeintPtr,
-			                        CtxtPtr->DeintBufAddr,
-			                        XVprocSsPtr->VidIn.ColorFormatId);
+              StartTime = XVprocSs_GetTimeStamp(XVprocSsPtr);
+              XV_DeintSetFieldBuffers(XVprocSsPtr->DeintPtr,
+			                          CtxtPtr->DeintBufAddr,
+			                          XVprocSsPtr->VidIn.ColorFormatId);
 
-            XV_deinterlacer_Set_width(XVprocSsPtr->DeintPtr,
-			                          CtxtPtr->VidInWidth);
+              XV_deinterlacer_Set_width(XVprocSsPtr->DeintPtr,
+			                            CtxtPtr->VidInWidth);
 
-            XV_deinterlacer_Set_height(XVprocSsPtr->DeintPtr,
-			                           XVprocSsPtr->VidIn.Timing.VActive); //field height
+              XV_deinterlacer_Set_height(XVprocSsPtr->DeintPtr,
+			                             XVprocSsPtr->VidIn.Timing.VActive); //field height
 
-            XV_deinterlacer_Set_invert_field_id(XVprocSsPtr->DeintPtr, 0); //TBD
+              XV_deinterlacer_Set_invert_field_id(XVprocSsPtr->DeintPtr, 0); //TBD
+              XVprocSs_LogCoreTime(XVprocSsPtr, XVPROCSS_SUBCORE_DEINT, StartTime);
+            }
             StartCorePtr[XVPROCSS_SUBCORE_DEINT] = TRUE;
           }
           break;
@@ -46,6 +46,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+* 1.01  ms    10/19/26   Added sub-core parameter tracking and time stamp
+*                        helpers for incremental reconfiguration
 
 * </pre>
 *
@@ -60,10 +62,33 @@ extern "C" {
 #include "xvprocss.h"
 /************************** Constant Definitions *****************************/
 
+/***************** Macros (Inline Functions) Definitions *********************/
+/*****************************************************************************/
+/**
+* This function reads the time stamp from the user registered handler
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance
+*
+* @return Time stamp or 0 if no handler is registered
+*
+******************************************************************************/
+static __inline u32 XVprocSs_GetTimeStamp(XVprocSs *XVprocSsPtr)
+{
+  return((XVprocSsPtr->UsrTimeStamp) ?
+          XVprocSsPtr->UsrTimeStamp(XVprocSsPtr->UsrTimeStampRef) : 0);
+}
+
 /************************** Function Prototypes ******************************/
 int XVprocSs_BuildRoutingTable(XVprocSs *XVprocSsPtr);
 void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr);
 void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr);
+int XVprocSs_CoreParamUpdate(XVprocSs *XVprocSsPtr,
+                             u32 CoreId,
+                             const u32 *Param,
+                             u32 NumParam);
+void XVprocSs_LogCoreTime(XVprocSs *XVprocSsPtr,
+                          u32 CoreId,
+                          u32 StartTime);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,214 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_stagetrace.c
+*
+* Contains the timed stage trace functions. See xil_stagetrace.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver    Who    Date    Changes
+* ----- ---- -------- -----------------------------------------------
+* 5.4   ms   10/19/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_stagetrace.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ****************************/
+
+#define COUNTS_TO_US(Trace, Counts)	((u32)(((u64)(Counts) * 1000000U) / \
+					(Trace)->CountsPerSecond))
+
+/*****************************************************************************/
+/**
+*
+* Initialize the trace header and discard the entries of an earlier run.
+*
+* @param    Trace is the memory holding the trace.
+* @param    Size is the size of that memory in bytes.
+* @param    CountsPerSecond is the rate of the timer the stages are timed
+*           with.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_StageTraceInit(XilStageTrace *Trace, u32 Size, u32 CountsPerSecond)
+{
+	Trace->Magic = XIL_STAGETRACE_MAGIC;
+	Trace->Version = XIL_STAGETRACE_VERSION;
+	Trace->CountsPerSecond = CountsPerSecond;
+	Trace->EntrySize = sizeof(XilStageTraceEntry);
+	Trace->MaxEntries = XIL_STAGETRACE_MAX_ENTRIES(Size);
+	Trace->Head = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write the entry of a completed stage. The oldest entry is overwritten when
+* the ring is full.
+*
+* @param    Trace is the trace set up with Xil_StageTraceInit.
+* @param    Stage is the stage number.
+* @param    Id is the partition number or XIL_STAGETRACE_NO_ID.
+* @param    Start is the counter value at the start of the stage.
+* @param    End is the counter value at the end of the stage.
+* @param    Bytes is the number of bytes processed in the stage.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_StageTraceAdd(XilStageTrace *Trace, u32 Stage, u32 Id, u64 Start,
+		       u64 End, u32 Bytes)
+{
+	XilStageTraceEntry *Entry;
+
+	Entry = &Trace->Entry[Trace->Head % Trace->MaxEntries];
+	Entry->Timestamp = Start;
+	Entry->Duration = (u32)(End - Start);
+	Entry->Bytes = Bytes;
+	Entry->Stage = (u16)Stage;
+	Entry->Id = (u16)Id;
+	Entry->Reserved = 0U;
+	Trace->Head++;
+}
+
+/*****************************************************************************/
+/**
+*
+* Print the traced stages, the time spent per stage type against the total
+* time and the budget, if one is given. The trace is flushed from the data
+* cache so that the next application finds it in memory.
+*
+* @param    Trace is the trace set up with Xil_StageTraceInit.
+* @param    StageName gives the name of each stage number.
+* @param    StageCnt is the number of names, at most
+*           XIL_STAGETRACE_MAX_STAGES.
+* @param    BudgetUs is the time budget in microseconds, 0 if none.
+*
+* @return   None.
+*
+* @note     Stages of the same type are summed. Their share is of the time
+*           from the start of the first to the end of the last traced stage.
+*
+*****************************************************************************/
+void Xil_StageTraceReport(XilStageTrace *Trace, const char * const *StageName,
+			  u32 StageCnt, u32 BudgetUs)
+{
+#ifdef STDOUT_BASEADDRESS
+	XilStageTraceEntry *Entry;
+	u64 StageTime[XIL_STAGETRACE_MAX_STAGES] = {0U};
+	u64 FirstTime;
+	u64 LastTime = 0U;
+	u32 TotalUs;
+	u32 First = 0U;
+	u32 Index;
+	u32 Rate;
+
+	if (StageCnt > XIL_STAGETRACE_MAX_STAGES) {
+		StageCnt = XIL_STAGETRACE_MAX_STAGES;
+	}
+
+	if (Trace->Head == 0U) {
+		goto END;
+	}
+
+	if (Trace->Head > Trace->MaxEntries) {
+		First = Trace->Head - Trace->MaxEntries;
+		xil_printf("Boot trace: %d oldest entries overwritten\r\n", First);
+	}
+	FirstTime = Trace->Entry[First % Trace->MaxEntries].Timestamp;
+
+	xil_printf("Boot trace: stage, partition, us, bytes, KB/s\r\n");
+	for (Index = First; Index < Trace->Head; Index++) {
+		Entry = &Trace->Entry[Index % Trace->MaxEntries];
+		if (Entry->Stage >= StageCnt) {
+			continue;
+		}
+
+		Rate = 0U;
+		if ((Entry->Bytes != 0U) && (Entry->Duration != 0U)) {
+			Rate = (u32)(((u64)Entry->Bytes * Trace->CountsPerSecond) /
+					((u64)Entry->Duration * 1024U));
+		}
+
+		if (Entry->Id == XIL_STAGETRACE_NO_ID) {
+			xil_printf("  %s, -, %d, %d, %d\r\n",
+				StageName[Entry->Stage],
+				COUNTS_TO_US(Trace, Entry->Duration),
+				Entry->Bytes, Rate);
+		} else {
+			xil_printf("  %s, %d, %d, %d, %d\r\n",
+				StageName[Entry->Stage], Entry->Id,
+				COUNTS_TO_US(Trace, Entry->Duration),
+				Entry->Bytes, Rate);
+		}
+
+		StageTime[Entry->Stage] += Entry->Duration;
+		if ((Entry->Timestamp + Entry->Duration) > LastTime) {
+			LastTime = Entry->Timestamp + Entry->Duration;
+		}
+	}
+
+	TotalUs = COUNTS_TO_US(Trace, LastTime - FirstTime);
+	xil_printf("Boot time budget: total %d us\r\n", TotalUs);
+	for (Index = 0U; Index < StageCnt; Index++) {
+		if (StageTime[Index] != 0U) {
+			xil_printf("  %s: %d us (%d%%)\r\n", StageName[Index],
+				COUNTS_TO_US(Trace, StageTime[Index]),
+				(TotalUs == 0U) ? 0U :
+				(u32)(((u64)COUNTS_TO_US(Trace, StageTime[Index]) *
+					100U) / TotalUs));
+		}
+	}
+
+	if (BudgetUs != 0U) {
+		xil_printf("  Budget %d us, %s by %d us\r\n", BudgetUs,
+			(TotalUs > BudgetUs) ? "over" : "under",
+			(TotalUs > BudgetUs) ? (TotalUs - BudgetUs) :
+				(BudgetUs - TotalUs));
+	}
+
+END:
+#endif
+	Xil_DCacheFlushRange((INTPTR)Trace, XIL_STAGETRACE_HDR_SIZE +
+			     (Trace->MaxEntries * sizeof(XilStageTraceEntry)));
+}
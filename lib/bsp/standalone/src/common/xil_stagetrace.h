@@ -0,0 +1,126 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_stagetrace.h
+*
+* Timed stage trace, used by the boot loaders to record how long each boot
+* stage takes. The trace is a header followed by a ring of entries, kept in
+* memory provided by the caller so that it can be left for the next
+* application to read. The caller reads the time stamps from its own timer
+* and gives the timer rate to Xil_StageTraceInit.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver    Who    Date    Changes
+* ----- ---- -------- -----------------------------------------------
+* 5.4   ms   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_STAGETRACE_H	/* prevent circular inclusions */
+#define XIL_STAGETRACE_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Trace identification, "FBTR" */
+#define XIL_STAGETRACE_MAGIC		0x46425452U
+#define XIL_STAGETRACE_VERSION		1U
+
+/* Size of the trace header in bytes */
+#define XIL_STAGETRACE_HDR_SIZE		32U
+
+/* Largest stage number + 1 accepted by Xil_StageTraceReport */
+#define XIL_STAGETRACE_MAX_STAGES	16U
+
+/* Id of the stages which are not partition specific */
+#define XIL_STAGETRACE_NO_ID		0xFFFFU
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * One trace entry. Timestamp and Duration are in counts of the caller's
+ * timer, the rate is given by CountsPerSecond of the header.
+ */
+typedef struct {
+	u64 Timestamp;		/* Counter value at the start of the stage */
+	u32 Duration;		/* Length of the stage in counts */
+	u32 Bytes;		/* Bytes processed in the stage, 0 if none */
+	u16 Stage;		/* Stage number, defined by the caller */
+	u16 Id;			/* Partition number or XIL_STAGETRACE_NO_ID */
+	u32 Reserved;
+} XilStageTraceEntry;
+
+/*
+ * Trace header followed by the entry ring. Head counts all the entries
+ * written, entry (Head - 1) % MaxEntries is the latest one.
+ */
+typedef struct {
+	u32 Magic;		/* XIL_STAGETRACE_MAGIC */
+	u32 Version;		/* XIL_STAGETRACE_VERSION */
+	u32 CountsPerSecond;	/* Rate of the time stamp counter */
+	u32 EntrySize;		/* sizeof(XilStageTraceEntry) */
+	u32 MaxEntries;		/* Number of entries in the ring */
+	u32 Head;		/* Total number of entries written */
+	u32 Reserved[2];
+	XilStageTraceEntry Entry[];
+} XilStageTrace;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Number of entries held by a trace of Size bytes */
+#define XIL_STAGETRACE_MAX_ENTRIES(Size)	(((Size) - XIL_STAGETRACE_HDR_SIZE) / \
+						sizeof(XilStageTraceEntry))
+
+/************************** Function Prototypes ******************************/
+
+void Xil_StageTraceInit(XilStageTrace *Trace, u32 Size, u32 CountsPerSecond);
+void Xil_StageTraceAdd(XilStageTrace *Trace, u32 Stage, u32 Id, u64 Start,
+		       u64 End, u32 Bytes);
+void Xil_StageTraceReport(XilStageTrace *Trace, const char * const *StageName,
+			  u32 StageCnt, u32 BudgetUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
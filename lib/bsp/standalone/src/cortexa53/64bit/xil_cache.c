@@ -43,6 +43,11 @@
 * Ver    Who Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 5.4	ms   10/19/26 Xil_DCacheFlushRange and Xil_DCacheInvalidateRange issue
+*		      one operation per line to the point of coherency with a
+*		      single barrier. Xil_DCacheFlushRange switches to whole
+*		      cache maintenance at XIL_DCACHE_RANGE_THRESHOLD. Added
+*		      Xil_DCacheFlushRangeList.
 *
 * </pre>
 *
@@ -267,43 +272,49 @@ void Xil_DCacheInvalidateLine(INTPTR adr)
 ****************************************************************************/
 void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 {
-	const u32 cacheline = 64U;
+	const INTPTR cacheline = 64;
 	INTPTR end;
 	INTPTR tempadr = adr;
 	INTPTR tempend;
 	u32 currmask;
+
+	if (len == 0) {
+		return;
+	}
+
+	/*
+	 * Always walk the range by VA: a whole cache set/way operation would
+	 * clean stale dirty lines over data a device has just written, and is
+	 * not broadcast to the other cores.
+	 */
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0U) {
-		end = tempadr + len;
-		tempend = end;
 
-		if ((tempadr & (cacheline-1U)) != 0U) {
-			tempadr &= (~(cacheline - 1U));
-			Xil_DCacheFlushLine(tempadr);
-			tempadr += cacheline;
-		}
-		if ((tempend & (cacheline-1U)) != 0U) {
-			tempend &= (~(cacheline - 1U));
-			Xil_DCacheFlushLine(tempend);
-		}
+	end = tempadr + len;
+	tempend = end;
 
-		while (tempadr < tempend) {
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x0);
-			/* Invalidate Data cache line */
-			mtcpdc(IVAC,(tempadr & (~0x3F)));
-			/* Wait for invalidate to complete */
-			dsb();
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x2);
-			/* Invalidate Data cache line */
-			mtcpdc(IVAC,(tempadr & (~0x3F)));
-			/* Wait for invalidate to complete */
-			dsb();
-			tempadr += cacheline;
-		}
+	/* Partial lines at either end are cleaned so neighbours are not lost */
+	if ((tempadr & (cacheline-1)) != 0) {
+		tempadr &= (~(cacheline - 1));
+		mtcpdc(CIVAC,tempadr);
+		tempadr += cacheline;
+	}
+	if (((tempend & (cacheline-1)) != 0) && (tempend > tempadr)) {
+		tempend &= (~(cacheline - 1));
+		mtcpdc(CIVAC,tempend);
 	}
+
+	/*
+	 * Operations by VA to the point of coherency apply to every cache
+	 * level, so one operation per line and a single barrier are enough.
+	 */
+	while (tempadr < tempend) {
+		mtcpdc(IVAC,tempadr);
+		tempadr += cacheline;
+	}
+
+	/* Wait for invalidate to complete */
+	dsb();
 	mtcpsr(currmask);
 }
 
@@ -458,47 +469,92 @@ void Xil_DCacheFlushLine(INTPTR  adr)
 
 void Xil_DCacheFlushRange(INTPTR  adr, INTPTR len)
 {
-	const u32 cacheline = 64U;
+	const INTPTR cacheline = 64;
 	INTPTR end;
-	INTPTR tempadr = adr;
-	INTPTR tempend;
+	INTPTR tempadr;
 	u32 currmask;
+
+	if (len == 0) {
+		return;
+	}
+
+	if ((UINTPTR)len >= XIL_DCACHE_RANGE_THRESHOLD) {
+		Xil_DCacheFlush();
+		return;
+	}
+
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0x00000000U) {
-		end = tempadr + len;
-		tempend = end;
-		if ((tempadr & (0x3F)) != 0) {
-			tempadr &= ~(0x3F);
-			Xil_DCacheFlushLine(tempadr);
-			tempadr += cacheline;
-		}
-		if ((tempend & (0x3F)) != 0) {
-			tempend &= ~(0x3F);
-			Xil_DCacheFlushLine(tempend);
-		}
 
-		while (tempadr < tempend) {
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x0);
-			/* Flush Data cache line */
-			mtcpdc(CIVAC,(tempadr & (~0x3F)));
-			/* Wait for flush to complete */
-			dsb();
-			/* Select cache level 1 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x2);
-			/* Flush Data cache line */
-			mtcpdc(CIVAC,(tempadr & (~0x3F)));
-			/* Wait for flush to complete */
-			dsb();
+	end = adr + len;
+	tempadr = adr & (~(cacheline - 1));
+
+	while (tempadr < end) {
+		/* Flush Data cache line to the point of coherency */
+		mtcpdc(CIVAC,tempadr);
+		tempadr += cacheline;
+	}
+
+	/* Wait for flush to complete */
+	dsb();
+	mtcpsr(currmask);
+}
+
+/****************************************************************************
+* Flush the Data cache for a list of address ranges.
+* Every cacheline touched by one of the ranges is written to system memory
+* if it is dirty and then invalidated, as for Xil_DCacheFlushRange. The
+* whole list completes with a single barrier.
+*
+* @param	Ranges is the array of ranges to be flushed.
+* @param	Count is the number of entries in Ranges.
+*
+* @return	None.
+*
+* @note		If the ranges add up to XIL_DCACHE_RANGE_THRESHOLD bytes or
+*		more, the whole Data cache is flushed instead.
+*
+****************************************************************************/
+void Xil_DCacheFlushRangeList(const Xil_CacheRange *Ranges, u32 Count)
+{
+	const INTPTR cacheline = 64;
+	INTPTR end;
+	INTPTR tempadr;
+	UINTPTR total = 0U;
+	u32 currmask;
+	u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		total += (UINTPTR)Ranges[Index].Len;
+	}
+
+	if (total == 0U) {
+		return;
+	}
+
+	if (total >= XIL_DCACHE_RANGE_THRESHOLD) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	for (Index = 0U; Index < Count; Index++) {
+		end = Ranges[Index].Addr + Ranges[Index].Len;
+		tempadr = Ranges[Index].Addr & (~(cacheline - 1));
+
+		while (tempadr < end) {
+			mtcpdc(CIVAC,tempadr);
 			tempadr += cacheline;
 		}
 	}
 
+	/* Wait for flush to complete */
+	dsb();
 	mtcpsr(currmask);
 }
 
-
 /****************************************************************************
 *
 * Enable the instruction cache.
@@ -42,6 +42,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 5.4	ms   10/19/26 Added XIL_DCACHE_RANGE_THRESHOLD and
+*		      Xil_DCacheFlushRangeList
 * </pre>
 *
 ******************************************************************************/
@@ -54,6 +56,21 @@
 extern "C" {
 #endif
 
+/*
+ * Flush range operations at or above this many bytes are done as a clean
+ * and invalidate of the whole Data cache by set/way. Invalidate ranges are
+ * always maintained by address. Defaults to the size of the L2 cache;
+ * define it in the BSP compiler flags to tune it.
+ */
+#ifndef XIL_DCACHE_RANGE_THRESHOLD
+#define XIL_DCACHE_RANGE_THRESHOLD	0x100000U
+#endif
+
+typedef struct {
+	INTPTR Addr;
+	INTPTR Len;
+} Xil_CacheRange;
+
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
@@ -62,6 +79,7 @@ void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushRange(INTPTR adr, INTPTR len);
 void Xil_DCacheFlushLine(INTPTR adr);
+void Xil_DCacheFlushRangeList(const Xil_CacheRange *Ranges, u32 Count);
 
 void Xil_ICacheEnable(void);
 void Xil_ICacheDisable(void);
@@ -92,6 +92,12 @@
 * 5.03	 pkp 10/07/15 L2 Cache functionalities are avoided for the OpenAMP slave
 *					  application(when USE_AMP flag is defined for BSP) as master CPU
 *					  would be utilizing L2 cache for its operation
+* 5.04	 ms  10/19/26 Xil_DCacheFlushRange and Xil_DCacheInvalidateRange maintain
+*					  L1 for the whole range first and then issue the PL310 line
+*					  operations as one batch with a single L2 cache sync. Flush
+*					  ranges of XIL_DCACHE_RANGE_THRESHOLD bytes or more use L1
+*					  set/way and PL310 way operations. Added
+*					  Xil_DCacheFlushRangeList.
 *
 * </pre>
 *
@@ -168,6 +174,96 @@ static void Xil_L2CacheSync(void)
 	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_SYNC_OFFSET, 0x0U);
 #endif
 }
+
+/****************************************************************************
+*
+* Issue the PL310 clean and invalidate line operations for an address range,
+* without a cache sync.
+*
+* @param	adr is the start address of the range.
+* @param	end is the address just past the range.
+*
+* @return	None.
+*
+* @note		Write-back and line fills must be disabled by the caller.
+*
+****************************************************************************/
+static void Xil_L2CacheFlushLineOps(u32 adr, u32 end)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr = adr & ~(cacheline - 1U);
+#ifndef CONFIG_PL310_ERRATA_588369
+	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
+				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+#endif
+
+	while (LocalAddr < end) {
+#ifdef CONFIG_PL310_ERRATA_588369
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_CLEAN_PA_OFFSET,
+			  LocalAddr);
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_INVLD_PA_OFFSET,
+			  LocalAddr);
+#else
+		*L2CCOffset = LocalAddr;
+#endif
+		LocalAddr += cacheline;
+	}
+}
+
+/****************************************************************************
+*
+* Flush the L2 cache lines of an address range as one batch. The PL310 line
+* operations are written back to back and completed with a single cache
+* sync, instead of a sync per line.
+*
+* @param	adr is the start address of the range.
+* @param	end is the address just past the range.
+*
+* @return	None.
+*
+* @note		Called with interrupts disabled, after the range has been
+*		flushed out of L1.
+*
+****************************************************************************/
+static void Xil_L2CacheFlushLines(u32 adr, u32 end)
+{
+	/* Disable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x3U);
+
+	Xil_L2CacheFlushLineOps(adr, end);
+
+	Xil_L2CacheSync();
+	/* Enable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x0U);
+}
+
+/****************************************************************************
+*
+* Invalidate the L2 cache lines of an address range as one batch, with a
+* single cache sync at the end.
+*
+* @param	adr is the start address of the range. Must be line aligned.
+* @param	end is the address just past the range. Must be line aligned.
+*
+* @return	None.
+*
+* @note		Called with interrupts disabled.
+*
+****************************************************************************/
+static void Xil_L2CacheInvalidateLines(u32 adr, u32 end)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr = adr;
+	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
+				    XPS_L2CC_CACHE_INVLD_PA_OFFSET);
+
+	while (LocalAddr < end) {
+		*L2CCOffset = LocalAddr;
+		LocalAddr += cacheline;
+	}
+
+	Xil_L2CacheSync();
+}
 #endif
 /****************************************************************************
 *
@@ -329,52 +425,48 @@ void Xil_DCacheInvalidateRange(INTPTR adr, u32 len)
 	u32 tempadr = adr;
 	u32 tempend;
 	u32 currmask;
-	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
-				    XPS_L2CC_CACHE_INVLD_PA_OFFSET);
 
+	if (len == 0U) {
+		return;
+	}
+
+	/*
+	 * Always walk the range by address: a whole cache flush would clean
+	 * stale dirty lines over data a device has just written, and set/way
+	 * operations do not reach the other core's L1.
+	 */
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 
-	if (len != 0U) {
-		end = tempadr + len;
-		tempend = end;
-		/* Select L1 Data cache in CSSR */
-		mtcp(XREG_CP15_CACHE_SIZE_SEL, 0U);
+	end = tempadr + len;
+	tempend = end;
+	/* Select L1 Data cache in CSSR */
+	mtcp(XREG_CP15_CACHE_SIZE_SEL, 0U);
 
-		if ((tempadr & (cacheline-1U)) != 0U) {
-			tempadr &= (~(cacheline - 1U));
+	if ((tempadr & (cacheline-1U)) != 0U) {
+		tempadr &= (~(cacheline - 1U));
 
-			Xil_L1DCacheFlushLine(tempadr);
+		Xil_L1DCacheFlushLine(tempadr);
 #ifndef USE_AMP
-			/* Disable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x3U);
-			Xil_L2CacheFlushLine(tempadr);
-			/* Enable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x0U);
-			Xil_L2CacheSync();
+		Xil_L2CacheFlushLines(tempadr, tempadr + cacheline);
 #endif
-			tempadr += cacheline;
-		}
-		if ((tempend & (cacheline-1U)) != 0U) {
-			tempend &= (~(cacheline - 1U));
+		tempadr += cacheline;
+	}
+	if (((tempend & (cacheline-1U)) != 0U) && (tempend > tempadr)) {
+		tempend &= (~(cacheline - 1U));
 
-			Xil_L1DCacheFlushLine(tempend);
+		Xil_L1DCacheFlushLine(tempend);
 #ifndef USE_AMP
-			/* Disable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x3U);
-			Xil_L2CacheFlushLine(tempend);
-			/* Enable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x0U);
-			Xil_L2CacheSync();
+		Xil_L2CacheFlushLines(tempend, tempend + cacheline);
 #endif
-		}
+	}
 
-		while (tempadr < tempend) {
+	if (tempadr < tempend) {
 #ifndef USE_AMP
-			/* Invalidate L2 cache line */
-			*L2CCOffset = tempadr;
-			Xil_L2CacheSync();
+		/* Invalidate L2 first so that L1 cannot refill from stale lines */
+		Xil_L2CacheInvalidateLines(tempadr, tempend);
 #endif
+		while (tempadr < tempend) {
 #ifdef __GNUC__
 			/* Invalidate L1 Data cache line */
 			__asm__ __volatile__("mcr " \
@@ -475,22 +567,99 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 	const u32 cacheline = 32U;
 	u32 end;
 	u32 currmask;
-	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
-				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+
+	if (len == 0U) {
+		return;
+	}
+
+	/* Large ranges use L1 set/way and PL310 way maintenance */
+	if (len >= XIL_DCACHE_RANGE_THRESHOLD) {
+		Xil_DCacheFlush();
+		return;
+	}
 
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 
-	if (len != 0U) {
-		/* Back the starting address up to the start of a cache line
-		 * perform cache operations until adr+len
-		 */
-		end = LocalAddr + len;
-		LocalAddr &= ~(cacheline - 1U);
+	/* Back the starting address up to the start of a cache line
+	 * perform cache operations until adr+len
+	 */
+	end = LocalAddr + len;
+	LocalAddr &= ~(cacheline - 1U);
+
+	/* Flush the whole range out of L1 first */
+	while (LocalAddr < end) {
+#ifdef __GNUC__
+		/* Flush L1 Data cache line */
+		__asm__ __volatile__("mcr " \
+		XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC :: "r" (LocalAddr));
+#elif defined (__ICCARM__)
+		__asm volatile ("mcr " \
+		XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC :: "r" (LocalAddr));
+#else
+		{ volatile register u32 Reg
+			__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
+		  Reg = LocalAddr; }
+#endif
+		LocalAddr += cacheline;
+	}
+
+#ifndef USE_AMP
+	/* L1 write-backs must reach L2 before L2 is flushed */
+	dsb();
+	Xil_L2CacheFlushLines(adr, end);
+#endif
+	dsb();
+	mtcpsr(currmask);
+}
+
+/****************************************************************************
+* Flush the Data cache for a list of address ranges.
+* Every cacheline touched by one of the ranges is written to system memory
+* if it is dirty and then invalidated, as for Xil_DCacheFlushRange. L1 is
+* flushed for all the ranges first, then L2 for all the ranges with a single
+* L2 cache sync.
+*
+* @param	Ranges is the array of ranges to be flushed.
+* @param	Count is the number of entries in Ranges.
+*
+* @return	None.
+*
+* @note		If the ranges add up to XIL_DCACHE_RANGE_THRESHOLD bytes or
+*		more, the whole Data cache is flushed instead.
+*
+****************************************************************************/
+void Xil_DCacheFlushRangeList(const Xil_CacheRange *Ranges, u32 Count)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr;
+	u32 end;
+	u32 total = 0U;
+	u32 currmask;
+	u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		total += (u32)Ranges[Index].Len;
+	}
+
+	if (total == 0U) {
+		return;
+	}
+
+	if (total >= XIL_DCACHE_RANGE_THRESHOLD) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	for (Index = 0U; Index < Count; Index++) {
+		end = (u32)Ranges[Index].Addr + (u32)Ranges[Index].Len;
+		LocalAddr = (u32)Ranges[Index].Addr & ~(cacheline - 1U);
 
 		while (LocalAddr < end) {
 #ifdef __GNUC__
-			/* Flush L1 Data cache line */
 			__asm__ __volatile__("mcr " \
 			XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC :: "r" (LocalAddr));
 #elif defined (__ICCARM__)
@@ -500,18 +669,30 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 			{ volatile register u32 Reg
 				__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
 			  Reg = LocalAddr; }
-#endif
-#ifndef USE_AMP
-			/* Flush L2 cache line */
-			*L2CCOffset = LocalAddr;
-			Xil_L2CacheSync();
 #endif
 			LocalAddr += cacheline;
 		}
 	}
+
+#ifndef USE_AMP
+	dsb();
+
+	/* Disable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x3U);
+
+	for (Index = 0U; Index < Count; Index++) {
+		Xil_L2CacheFlushLineOps((u32)Ranges[Index].Addr,
+			(u32)Ranges[Index].Addr + (u32)Ranges[Index].Len);
+	}
+
+	Xil_L2CacheSync();
+	/* Enable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x0U);
+#endif
 	dsb();
 	mtcpsr(currmask);
 }
+
 /****************************************************************************
 *
 * Store a Data cache line. If the byte specified by the address (adr)
@@ -44,6 +44,8 @@
 * 1.00a ecm  01/29/10 First release
 * 3.04a sdm  01/02/12 Remove redundant dsb/dmb instructions in cache maintenance
 *		      APIs.
+* 5.04  ms   10/19/26 Added XIL_DCACHE_RANGE_THRESHOLD and
+*		      Xil_DCacheFlushRangeList
 * </pre>
 *
 ******************************************************************************/
@@ -56,12 +58,28 @@
 extern "C" {
 #endif
 
+/*
+ * Flush range operations at or above this many bytes are done on the whole
+ * Data cache (L1 by set/way, PL310 by way). Invalidate ranges are always
+ * maintained by address. Defaults to the size of the L2 cache; define it
+ * in the BSP compiler flags to tune it.
+ */
+#ifndef XIL_DCACHE_RANGE_THRESHOLD
+#define XIL_DCACHE_RANGE_THRESHOLD	0x80000U
+#endif
+
+typedef struct {
+	INTPTR Addr;
+	INTPTR Len;
+} Xil_CacheRange;
+
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, u32 len);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushRange(INTPTR adr, u32 len);
+void Xil_DCacheFlushRangeList(const Xil_CacheRange *Ranges, u32 Count);
 
 void Xil_ICacheEnable(void);
 void Xil_ICacheDisable(void);
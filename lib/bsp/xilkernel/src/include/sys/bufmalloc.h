@@ -47,15 +47,30 @@ extern "C" {
 
 typedef int membuf_t;
 
+//! Memory buffer pool statistics returned by bufstats
+typedef struct membuf_stats_s {
+    size_t       blksiz;        //! Block size of the pool
+    int          nblks;         //! Total number of blocks
+    int          nfree;         //! Blocks currently free
+    int          hwm;           //! High water mark of blocks in use
+    unsigned int nalloc;        //! Successful allocations
+    unsigned int nfail;         //! Allocations that found the pool empty
+    unsigned int probes;        //! Total pools examined by allocations served here
+    unsigned int maxprobes;     //! Worst case pools examined for one allocation
+} membuf_stats_t;
+
 int     sys_bufcreate  (membuf_t *mbuf, void *memptr, int nblks, size_t blksiz);
 int     sys_bufdestroy (membuf_t mbuf);
 void*   sys_bufmalloc  (membuf_t mbuf, size_t siz);
 void    sys_buffree    (membuf_t mbuf, void *mem);
+int     sys_bufstats   (membuf_t mbuf, membuf_stats_t *stats);
+size_t  sys_bufblksiz  (void *mem);
 
 int     bufcreate  (membuf_t *mbuf, void *memptr, int nblks, size_t blksiz);
 int     bufdestroy (membuf_t mbuf);
 void*   bufmalloc  (membuf_t mbuf, size_t siz);
 void    buffree    (membuf_t mbuf, void *mem);
+int     bufstats   (membuf_t mbuf, membuf_stats_t *stats);
 
 #ifdef __cplusplus
 }
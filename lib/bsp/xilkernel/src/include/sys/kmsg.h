@@ -54,6 +54,10 @@ int sys_msgctl(int msqid, int cmd, struct msqid_ds *buf);
 int sys_msgget(key_t key, int msgflg);
 ssize_t sys_msgrcv(int msqid, void *msgp, size_t msgsz, long msgtyp, int msgflg);
 int sys_msgsnd(int msqid, const void *msgp, size_t msgsz, int msgflg);
+void* sys_msgbuf_alloc(size_t msgsz);
+int sys_msgbuf_free(void *msgbuf);
+int sys_msgsnd_zc(int msqid, void *msgbuf, size_t msgsz, int msgflg);
+int sys_msgrcv_batch(int msqid, struct msgbuf_desc *msgv, int nmsgs, int msgflg);
 
 #ifdef __cplusplus
 }
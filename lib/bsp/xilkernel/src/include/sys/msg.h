@@ -58,11 +58,25 @@ struct msqid_ds {
     pid_t     msg_lrpid;  // Process ID of last msgrcv ().
 };
 
+//! Message descriptor filled in by the zero-copy receive calls
+struct msgbuf_desc {
+    void      *msg_buf;   // Message buffer. Owned by the receiver
+    size_t    msg_len;    // Length of the message in bytes
+};
+
 int     msgctl (int msgid, int cmd, struct msqid_ds *buf);
 int     msgget (key_t key, int msgflg);
 ssize_t msgrcv (int msgid, void *msgp, size_t msgsz, long msgtyp, int msgflg);
 int     msgsnd (int msgid, const void *msgp, size_t msgsz, int msgflg);
 
+// Zero-copy message passing. Buffers move between processes instead of being
+// copied in and out of the kernel.
+void*   msgbuf_alloc (size_t msgsz);
+int     msgbuf_free (void *msgbuf);
+int     msgsnd_zc (int msgid, void *msgbuf, size_t msgsz, int msgflg);
+ssize_t msgrcv_zc (int msgid, void **msgbuf, int msgflg);
+int     msgrcv_batch (int msgid, struct msgbuf_desc *msgv, int nmsgs, int msgflg);
+
 #ifdef __cplusplus
 }
 #endif
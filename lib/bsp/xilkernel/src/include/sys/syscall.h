@@ -99,7 +99,7 @@ extern "C" {
 #define SC_MSGCTL			42
 #define SC_MSGSND			43
 #define SC_MSGRCV			44
-#define SC_MSG_RESERVED_0               45
+#define SC_MSGSND_ZC                    45
 
 #define SC_SHMGET			46	// Shared Memory
 #define SC_SHMCTL			47
@@ -111,7 +111,7 @@ extern "C" {
 #define SC_BUFDESTROY    		51
 #define SC_BUFMALLOC                    52
 #define SC_BUFFREE			53
-#define SC_MALLOC_RESERVED_2            54
+#define SC_BUFSTATS                     54
 
 #define SC_TMR_GETCLOCKTICKS		55
 #define SC_TMR_SLEEP			56      // Software timers
@@ -125,9 +125,9 @@ extern "C" {
 
 //#define SC_RESERVED_0                 63
 #define SC_GET_KERNEL_STATS             63
-#define SC_RESERVED_1                   64
-#define SC_RESERVED_2                   65
-#define SC_RESERVED_3                   66
+#define SC_MSGRCV_BATCH                 64      // Zero-copy message queue
+#define SC_MSGBUF_ALLOC                 65
+#define SC_MSGBUF_FREE                  66
 #define SC_RESERVED_4                   67
 #define SC_RESERVED_5                   68
 #define SC_RESERVED_6                   69
@@ -46,9 +46,27 @@
 extern "C" {
 #endif
 
+//! Soft timer wheel geometry. Each level has (1 << TMR_WHEEL_BITS) slots;
+//! timers further away than the wheel range are parked in the last level
+//! and re-hashed when it wraps.
+#ifndef TMR_WHEEL_BITS
+#define TMR_WHEEL_BITS          6
+#endif
+#ifndef TMR_WHEEL_LEVELS
+#define TMR_WHEEL_LEVELS        5
+#endif
+#if (TMR_WHEEL_BITS * TMR_WHEEL_LEVELS) > 31
+#error "Soft timer wheel cannot span more than 31 bits of ticks"
+#endif
+#define TMR_WHEEL_SIZE          (1U << TMR_WHEEL_BITS)
+#define TMR_WHEEL_RANGE         (1U << (TMR_WHEEL_BITS * TMR_WHEEL_LEVELS))
+
 typedef struct soft_tmr_s {
-    unsigned int timeout;
-    pid_t pid;
+    unsigned int expires;       //! Wheel clock value at which the timer fires
+    pid_t pid;                  //! Process waiting on the timer. -1 if free
+    short slot;                 //! Wheel slot holding the timer
+    short prev;                 //! Previous timer in the slot
+    short next;                 //! Next timer in the slot (or in the free list)
 } soft_tmr_t;
 
 void     soft_tmr_init(void) ;
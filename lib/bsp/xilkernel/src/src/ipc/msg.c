@@ -55,16 +55,33 @@ msgid_ds msgq_heap[NUM_MSGQS] ;
 // Declarations
 //----------------------------------------------------------------------------------------------------//
 msgid_ds* get_msgid_by_key( key_t key);
+static int msgq_put (int msgid, msg_t *k_msg, int msgflg);
+static size_t msgq_bufsiz (void *msgbuf);
 extern void  sys_buffree   (membuf_t, void* mem);
 extern void* sys_bufmalloc (membuf_t, size_t size);
 extern void  sys_buffree   (membuf_t, void* mem);
+extern size_t sys_bufblksiz (void* mem);
 
 #ifdef CONFIG_ENHANCED_MSGQ
-#define MSGQ_MALLOC(siz)        malloc(siz)
-#define MSGQ_FREE(ptr)          free(ptr)
+//! malloc'd message buffers carry a header so that buffers handed back to msgsnd_zc
+//! can be recognised and their usable size checked, as bufblksiz does for the pools
+#define MSGQ_HDR_MAGIC          0x4D534751
+typedef struct msgq_hdr_s {
+    size_t       siz;
+    unsigned int magic;
+} msgq_hdr_t;
+
+static void* msgq_malloc (size_t siz);
+static void  msgq_free (void *ptr);
+static size_t msgq_blksiz (void *ptr);
+
+#define MSGQ_MALLOC(siz)        msgq_malloc(siz)
+#define MSGQ_FREE(ptr)          msgq_free(ptr)
+#define MSGQ_BLKSIZ(ptr)        msgq_blksiz(ptr)
 #else
 #define MSGQ_MALLOC(siz)        sys_bufmalloc(MEMBUF_ANY, siz)
 #define MSGQ_FREE(ptr)          sys_buffree(MEMBUF_ANY, ptr)
+#define MSGQ_BLKSIZ(ptr)        sys_bufblksiz(ptr)
 #endif
 
 //----------------------------------------------------------------------------------------------------//
@@ -253,7 +270,6 @@ int sys_msgctl (int msgid, int cmd, struct msqid_ds *buf)
 //----------------------------------------------------------------------------------------------------//
 int sys_msgsnd (int msgid, const void *msgp, size_t msgsz, int msgflg)
 {
-    msgid_ds *msgds ;
     msg_t k_msg;
 
     if ((msgid < 0) || (msgid >= NUM_MSGQS) || (msgq_heap[msgid].msgid == -1)) {
@@ -268,35 +284,58 @@ int sys_msgsnd (int msgid, const void *msgp, size_t msgsz, int msgflg)
 	return -1;
     }
 
-    msgds = &msgq_heap[msgid];
+    memcpy (k_msg.msg_buf, msgp, msgsz);                                // Save the message
+    if (msgq_put (msgid, &k_msg, msgflg) < 0) {
+        MSGQ_FREE (k_msg.msg_buf);
+        return -1;
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - msgq_put
+//! @desc
+//!   Wait for room in a message queue and enqueue a message that is already in kernel owned memory
+//!   Wake up any process that is blocked on a msgrcv.
+//! @param
+//!   - msgid -> msg ID of the message queue. Must be valid.
+//!   - k_msg -> message descriptor to enqueue
+//!   - msgflg -> msgsnd control flags
+//! @return
+//!   - Return 0 on success, -1 on failure. The caller still owns k_msg->msg_buf on failure.
+//!     errno set to,
+//!     EAGAIN - IPC_NOWAIT was specified and the queue is full
+//!     EIDRM  - The message queue was removed from the system during the send operation
+//! @note
+//!   - None
+//----------------------------------------------------------------------------------------------------//
+static int msgq_put (int msgid, msg_t *k_msg, int msgflg)
+{
+    msgid_ds *msgds = &msgq_heap[msgid];
+
     if ((msgflg & IPC_NOWAIT)) {
 	if (sys_sem_trywait (&msgds->full) < 0) {
-	    MSGQ_FREE (k_msg.msg_buf);
             kerrno = EAGAIN;
 	    return -1;                                                  // Can't wait. Return and indicate unable to wait
 	}
     } else {
-	if (sys_sem_wait_x (&msgds->full) < 0) {
-	    MSGQ_FREE (k_msg.msg_buf);
+	if (sys_sem_wait_x (&msgds->full) < 0)
 	    return -1;                                                  // sem_wait error
-	}
 
         if (msgq_heap[msgid].msgid == -1) {                             // The message queue was removed from the system during the send operation
-	    MSGQ_FREE (k_msg.msg_buf);
             kerrno = EIDRM;
 	    return -1;
 	}
     }
 
-    memcpy (k_msg.msg_buf, msgp, msgsz);                                // Save the message
-    enq (&msgds->msg_q, &k_msg, 0);                                     // Enqueue the msg_t structure in the queue
+    enq (&msgds->msg_q, k_msg, 0);                                      // Enqueue the msg_t structure in the queue
     msgds->stats.msg_lspid = sys_get_currentPID ();
     msgds->stats.msg_qnum++;
     sys_sem_post (&msgds->empty);                                       // Signal the consumer of mesg in Q
     return 0;
 }
 
-
 //----------------------------------------------------------------------------------------------------//
 //  @func - sys_msgrcv
 //! @desc
@@ -371,4 +410,228 @@ ssize_t sys_msgrcv (int msgid, void *msgp, size_t msgsz, long msgtyp, int msgflg
     sys_sem_post (&msgds->full);                                        // Decrement the message count
     return (ssize_t)nbytes;                                             // Return number of bytes saved
 }
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - msgq_bufsiz
+//! @desc
+//!   Validate a message buffer that a process hands back to the kernel
+//! @param
+//!   - msgbuf is the buffer to validate
+//! @return
+//!   - Usable size of the buffer. 0 if it was not handed out by the message allocator, has been
+//!     released already or is still sitting in a message queue.
+//! @note
+//!   - The queue scan is bounded by the number of queued messages across all queues
+//----------------------------------------------------------------------------------------------------//
+static size_t msgq_bufsiz (void *msgbuf)
+{
+    msgid_ds *msgds;
+    msg_t *k_msg;
+    size_t blksiz;
+    int i, j;
+
+    blksiz = MSGQ_BLKSIZ (msgbuf);
+    if (blksiz == 0)
+        return 0;
+
+    for (i = 0; i < NUM_MSGQS; i++) {                                   // A buffer sent twice would be released twice
+        msgds = &msgq_heap[i];
+        if (msgds->msgid == -1)
+            continue;
+        for (j = 0; j < msgds->msg_q.item_count; j++) {
+            k_msg = (msg_t*)msgds->msg_q.items + ((msgds->msg_q.qfront + j) % msgds->msg_q.max_items);
+            if (k_msg->msg_buf == msgbuf)
+                return 0;
+        }
+    }
+
+    return blksiz;
+}
+
+#ifdef CONFIG_ENHANCED_MSGQ
+static void* msgq_malloc (size_t siz)
+{
+    msgq_hdr_t *hdr = (msgq_hdr_t*)malloc (sizeof (msgq_hdr_t) + siz);
+
+    if (hdr == NULL)
+        return NULL;
+    hdr->siz   = siz;
+    hdr->magic = MSGQ_HDR_MAGIC;
+    return (void*)(hdr + 1);
+}
+
+static void msgq_free (void *ptr)
+{
+    msgq_hdr_t *hdr = (msgq_hdr_t*)ptr - 1;
+
+    hdr->magic = 0;                                                     // A stale pointer must not pass msgq_blksiz
+    free (hdr);
+}
+
+static size_t msgq_blksiz (void *ptr)
+{
+    msgq_hdr_t *hdr = (msgq_hdr_t*)ptr - 1;
+
+    if (((unsigned int)ptr % sizeof (void*)) != 0 || hdr->magic != MSGQ_HDR_MAGIC)
+        return 0;
+    return hdr->siz;
+}
+#endif /* CONFIG_ENHANCED_MSGQ */
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_msgbuf_alloc
+//! @desc
+//!   Allocate a message buffer for use with msgsnd_zc
+//! @param
+//!   - msgsz is the size of the message buffer in bytes
+//! @return
+//!   - Pointer to the buffer. NULL on failure.
+//!     errno set to,
+//!     ENOSPC - The system could not allocate space for the message
+//! @note
+//!   - The buffer comes from the same allocator the queues use internally (bufmalloc or malloc)
+//----------------------------------------------------------------------------------------------------//
+void* sys_msgbuf_alloc (size_t msgsz)
+{
+    void *msgbuf = MSGQ_MALLOC (msgsz);
+
+    if (msgbuf == NULL)
+        kerrno = ENOSPC;
+    return msgbuf;
+}
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_msgbuf_free
+//! @desc
+//!   Release a message buffer obtained from msgbuf_alloc or received through msgrcv_zc/msgrcv_batch
+//! @param
+//!   - msgbuf is the buffer to release
+//! @return
+//!   - Return 0 on success, -1 on failure.
+//!     errno set to,
+//!     EINVAL - msgbuf did not come from msgbuf_alloc, was already released or is still queued
+//! @note
+//!   - A NULL msgbuf is ignored
+//----------------------------------------------------------------------------------------------------//
+int sys_msgbuf_free (void *msgbuf)
+{
+    if (msgbuf == NULL)
+        return 0;
+
+    if (msgq_bufsiz (msgbuf) == 0) {
+        kerrno = EINVAL;
+	return -1;
+    }
+
+    MSGQ_FREE (msgbuf);
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_msgsnd_zc
+//! @desc
+//!   Send a message through a message queue without copying it
+//!   - Ownership of msgbuf passes to the message queue and then to the receiving process.
+//!   - If IPC_NOWAIT is specified and the queue is currently full then return -1.
+//! @param
+//!   - msgid -> msg ID of the message queue
+//!   - msgbuf -> message buffer obtained from msgbuf_alloc (or received from a message queue)
+//!   - msgsz -> size of the message
+//!   - msgflg -> msgsnd control flags
+//! @return
+//!   - Return 0 on success, -1 on failure. The sender still owns msgbuf on failure.
+//!     errno set to,
+//!     EINVAL - The value of msgid is not a valid message queue identifier, msgbuf did not come
+//!              from msgbuf_alloc, is already queued or msgsz is larger than the buffer
+//!     EAGAIN - IPC_NOWAIT was specified and the queue is full
+//!     EIDRM  - The message queue was removed from the system during the send operation
+//! @note
+//!   - The sender must not touch msgbuf after a successful send
+//----------------------------------------------------------------------------------------------------//
+int sys_msgsnd_zc (int msgid, void *msgbuf, size_t msgsz, int msgflg)
+{
+    msg_t k_msg;
+    size_t blksiz;
+
+    if ((msgid < 0) || (msgid >= NUM_MSGQS) || (msgq_heap[msgid].msgid == -1) || (msgbuf == NULL)) {
+        kerrno = EINVAL;
+	return -1;
+    }
+
+    blksiz = msgq_bufsiz (msgbuf);                                      // The receiver reads msgsz bytes from the buffer
+    if ((blksiz == 0) || (msgsz > blksiz)) {                            // and later releases it to the message allocator
+        kerrno = EINVAL;
+	return -1;
+    }
+
+    k_msg.msg_buf = msgbuf;
+    k_msg.msg_len = msgsz;
+    return msgq_put (msgid, &k_msg, msgflg);
+}
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_msgrcv_batch
+//! @desc
+//!   Receive up to nmsgs messages from a message queue without copying them
+//!   - Blocks until at least one message is present, unless IPC_NOWAIT is specified.
+//!   - Then dequeues whatever else is already present, up to nmsgs messages in total.
+//!   - Ownership of each returned buffer passes to the caller, who releases it with msgbuf_free
+//!     or forwards it with msgsnd_zc.
+//!   - Wakeup any process blocked on a full message queue
+//! @param
+//!   - msgid is the msg ID of the message queue
+//!   - msgv is the array of message descriptors to fill in
+//!   - nmsgs is the number of entries in msgv
+//!   - msgflg is the flag controlling msgrcv
+//! @return
+//!   - Return number of messages received. Return -1 on error
+//!     errno set to,
+//!     EINVAL - If msgid is not a valid message queue identifier or msgv/nmsgs is invalid
+//!     EAGAIN - IPC_NOWAIT was specified and the queue is empty
+//!     EIDRM  - If the message queue was removed from the system
+//! @note
+//!   - None
+//----------------------------------------------------------------------------------------------------//
+int sys_msgrcv_batch (int msgid, struct msgbuf_desc *msgv, int nmsgs, int msgflg)
+{
+    msgid_ds *msgds;
+    msg_t k_msg;
+    int n;
+
+    if ((msgid < 0) || (msgid >= NUM_MSGQS) || (msgq_heap[msgid].msgid == -1) ||
+        (msgv == NULL) || (nmsgs <= 0)) {
+        kerrno = EINVAL;
+	return -1;
+    }
+
+    msgds = &msgq_heap[msgid] ;
+    if ((msgflg & IPC_NOWAIT)) {
+	if (sys_sem_trywait (&msgds->empty) < 0) {
+            kerrno = EAGAIN;
+	    return -1;
+        }
+    } else {
+	if (sys_sem_wait_x (&msgds->empty) < 0)
+	    return -1;
+
+	// Return here on unblock
+	if (msgq_heap[msgid].msgid == -1) {                             // The message queue was removed from the system during the recv operation
+            kerrno = EIDRM;
+	    return -1;
+        }
+    }
+
+    n = 0;
+    do {
+        deq (&msgds->msg_q, &k_msg, 0);                                 // Hand the kernel buffer over as it is
+        msgv[n].msg_buf = k_msg.msg_buf;
+        msgv[n].msg_len = k_msg.msg_len;
+        msgds->stats.msg_qnum--;
+        n++;
+        sys_sem_post (&msgds->full);                                    // Room for one more message
+    } while ((n < nmsgs) && (sys_sem_trywait (&msgds->empty) == 0));
+
+    msgds->stats.msg_lrpid = sys_get_currentPID ();
+    return n;
+}
 #endif /* CONFIG_MSGQ */
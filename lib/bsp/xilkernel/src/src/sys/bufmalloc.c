@@ -53,6 +53,10 @@
 #define    MEM_TO_BLK(membufp, mem)             (((unsigned int)mem - (unsigned int)membufp->memptr)/(membufp->blksiz))
 #define    MEM_WITHIN_BUF(membufp, mem)         (((mem >= membufp->memptr) && (mem < membufp->limit))?1:0)
 
+//! Size classes are powers of two. Class 'c' covers block sizes in [2^c, 2^(c+1))
+#define    MBUF_NCLASSES                        ((int)(sizeof (unsigned int) * 8))
+#define    MBUF_SIZE_CLASS(siz)                 ((MBUF_NCLASSES - 1) - __builtin_clz (siz))
+
 typedef struct membuf_info_s {
     char        active;
     void        *memptr;
@@ -61,14 +65,23 @@ typedef struct membuf_info_s {
     int         nblks;
     int         nfree;
     size_t      blksiz;
+    int         hwm;                    //! Maximum number of blocks ever in use
+    unsigned int nalloc;                //! Successful allocations
+    unsigned int nfail;                 //! Allocations that found the pool empty
+    unsigned int probes;                //! Pools examined to satisfy requests for this pool
+    unsigned int maxprobes;             //! Worst case pools examined for one request
 } membuf_info_t;
 
 void*   get_mbufblk    (membuf_info_t *mbufptr);
+static void mbuf_index_update (void);
 extern  void bufmalloc_mem_init (void);
 //----------------------------------------------------------------------------------------------------//
 // Data
 //----------------------------------------------------------------------------------------------------//
 membuf_info_t   mbufheap[N_MBUFS];
+static int mbuf_sorted[N_MBUFS];                                                        // Active pools in increasing block size order
+static int mbuf_nsorted;
+static int mbuf_class[MBUF_NCLASSES];                                                   // First entry of mbuf_sorted in each size class and above
 
 //----------------------------------------------------------------------------------------------------//
 // Definitions
@@ -79,23 +92,63 @@ void bufmalloc_init (void)
     for (i = 0; i < N_MBUFS; i++)
         mbufheap[i].active = 0;
 
+    mbuf_index_update ();
     bufmalloc_mem_init ();
 }
 
 void* get_mbufblk (membuf_info_t *mbufptr)
 {
     void *ret;
+    int inuse;
 
-    if (!mbufptr->nfree)
+    if (!mbufptr->nfree) {
+        mbufptr->nfail++;
         return NULL;
+    }
 
     ret = mbufptr->freep;
     mbufptr->freep = (*(void**)ret);
     mbufptr->nfree--;
 
+    mbufptr->nalloc++;
+    inuse = mbufptr->nblks - mbufptr->nfree;
+    if (inuse > mbufptr->hwm)
+        mbufptr->hwm = inuse;
+
     return ret;
 }
 
+// Rebuild the size class index over the active pools. Only done when pools
+// are created or destroyed, so that MEMBUF_ANY requests go straight to the
+// smallest pool that fits instead of searching the whole descriptor table.
+static void mbuf_index_update (void)
+{
+    int i, j, c;
+    int id;
+
+    mbuf_nsorted = 0;
+    for (i = 0; i < N_MBUFS; i++) {
+        if (!mbufheap[i].active)
+            continue;
+
+        for (j = mbuf_nsorted; j > 0; j--) {                                            // Insertion sort on block size. Keeps pool
+            id = mbuf_sorted[j - 1];                                                    // creation order between equal block sizes
+            if (mbufheap[id].blksiz <= mbufheap[i].blksiz)
+                break;
+            mbuf_sorted[j] = id;
+        }
+        mbuf_sorted[j] = i;
+        mbuf_nsorted++;
+    }
+
+    j = 0;
+    for (c = 0; c < MBUF_NCLASSES; c++) {
+        while ((j < mbuf_nsorted) && (MBUF_SIZE_CLASS (mbufheap[mbuf_sorted[j]].blksiz) < c))
+            j++;
+        mbuf_class[c] = j;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------//
 //  @func - sys_bufcreate
 //! @desc
@@ -137,6 +190,11 @@ int sys_bufcreate (membuf_t *mbuf, void *memptr, int nblks, size_t blksiz)
     mbufptr->nfree   = nblks;
     mbufptr->freep   = memptr;
     mbufptr->limit   = (void*)((unsigned int)memptr + (nblks * blksiz));
+    mbufptr->hwm     = 0;
+    mbufptr->nalloc  = 0;
+    mbufptr->nfail   = 0;
+    mbufptr->probes  = 0;
+    mbufptr->maxprobes = 0;
     *mbuf = (membuf_t)i;                                                                // Return membuf identifier
 
     cur  = (void**)memptr;
@@ -147,14 +205,17 @@ int sys_bufcreate (membuf_t *mbuf, void *memptr, int nblks, size_t blksiz)
         next = (void**)((unsigned int)next + blksiz);
     }
     *cur = (void*) NULL;
+
+    mbuf_index_update ();
     return 0;
 }
 
 int sys_bufdestroy (membuf_t mbuf)
 {
-    if (mbuf >= 0 && mbuf < N_MBUFS)
+    if (mbuf >= 0 && mbuf < N_MBUFS) {
         mbufheap[mbuf].active = 0;
-    else {
+        mbuf_index_update ();
+    } else {
         kerrno = EINVAL;
         return -1;
     }
@@ -166,20 +227,28 @@ void* sys_bufmalloc (membuf_t mbuf, size_t siz)
 {
     membuf_info_t   *mbufptr;
     void* ret = NULL;
+    unsigned int nprobes = 0;
     int i;
 
-    if ((mbuf != MEMBUF_ANY) && ((mbuf < 0 || mbuf > N_MBUFS)))
+    if ((mbuf != MEMBUF_ANY) && ((mbuf < 0 || mbuf >= N_MBUFS)))
         return NULL;
 
     if (mbuf == MEMBUF_ANY) {
-        mbufptr = &mbufheap[0];
-        for (i = 0; i < N_MBUFS; i++) {
-            if (mbufptr->active && mbufptr->blksiz >= siz) {                            // Get first pool that can fit the request
+        if (siz == 0)
+            siz = 1;
+        mbufptr = NULL;
+        for (i = mbuf_class[MBUF_SIZE_CLASS (siz)]; i < mbuf_nsorted; i++) {          // Start at the size class of the request. Pools
+            mbufptr = &mbufheap[mbuf_sorted[i]];                                        // below it can never fit
+            nprobes++;
+            if (mbufptr->blksiz >= siz) {                                               // Get smallest pool that can fit the request
                 ret = get_mbufblk (mbufptr);
                 if (ret)
                     break;
             }
-            mbufptr++;
+        }
+        if (mbufptr == NULL) {
+            kerrno = EAGAIN;
+            return NULL;
         }
     } else {
         mbufptr = &mbufheap[mbuf];
@@ -188,9 +257,14 @@ void* sys_bufmalloc (membuf_t mbuf, size_t siz)
             kerrno = EINVAL;
             return NULL;
         }
+        nprobes = 1;
         ret = get_mbufblk (mbufptr);
     }
 
+    mbufptr->probes += nprobes;
+    if (nprobes > mbufptr->maxprobes)
+        mbufptr->maxprobes = nprobes;
+
     if (ret == NULL)
         kerrno = EAGAIN;
     return ret;
@@ -202,7 +276,7 @@ void sys_buffree (membuf_t mbuf, void *mem)
     void** newblk;
     int blk, i;
 
-    if ((mbuf != MEMBUF_ANY) && ((mbuf < 0 || mbuf > N_MBUFS)))
+    if ((mbuf != MEMBUF_ANY) && ((mbuf < 0 || mbuf >= N_MBUFS)))
         return;
 
     if (mbuf == MEMBUF_ANY) {
@@ -228,4 +302,74 @@ void sys_buffree (membuf_t mbuf, void *mem)
     mbufptr->freep = (void*)newblk;
     mbufptr->nfree++;
 }
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_bufblksiz
+//! @desc
+//!   Look up the pool that a block handed out by bufmalloc belongs to
+//! @param
+//!   - mem is the address to look up
+//! @return
+//!   - Block size of the owning pool. 0 if mem is not the start of an allocated block in an
+//!     active pool.
+//! @note
+//!   - Kernel internal. Used to validate buffers that callers pass back to the kernel.
+//!   - Walks the free list of the owning pool to reject blocks that were already released.
+//----------------------------------------------------------------------------------------------------//
+size_t sys_bufblksiz (void *mem)
+{
+    membuf_info_t *mbufptr;
+    void *blk;
+    int i;
+
+    mbufptr = &mbufheap[0];
+    for (i = 0; i < N_MBUFS; i++) {
+        if (mbufptr->active && MEM_WITHIN_BUF (mbufptr, mem)) {
+            if ((((unsigned int)mem - (unsigned int)mbufptr->memptr) % mbufptr->blksiz) != 0)
+                return 0;
+            for (blk = mbufptr->freep; blk != NULL; blk = *(void**)blk)
+                if (blk == mem)
+                    return 0;
+            return mbufptr->blksiz;
+        }
+        mbufptr++;
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------//
+//  @func - sys_bufstats
+//! @desc
+//!   Report the usage statistics of a memory buffer pool
+//! @param
+//!   - mbuf is the identifier of the pool
+//!   - stats is the structure to return the statistics in
+//! @return
+//!   - 0 on success, -1 on failure and kerrno is set to EINVAL
+//! @note
+//!   - probes/maxprobes count the pools examined by sys_bufmalloc and are the
+//!     allocation latency measure. A pool addressed directly costs one probe.
+//----------------------------------------------------------------------------------------------------//
+int sys_bufstats (membuf_t mbuf, membuf_stats_t *stats)
+{
+    membuf_info_t *mbufptr;
+
+    if ((mbuf < 0) || (mbuf >= N_MBUFS) || (stats == NULL) || !mbufheap[mbuf].active) {
+        kerrno = EINVAL;
+        return -1;
+    }
+
+    mbufptr = &mbufheap[mbuf];
+    stats->blksiz    = mbufptr->blksiz;
+    stats->nblks     = mbufptr->nblks;
+    stats->nfree     = mbufptr->nfree;
+    stats->hwm       = mbufptr->hwm;
+    stats->nalloc    = mbufptr->nalloc;
+    stats->nfail     = mbufptr->nfail;
+    stats->probes    = mbufptr->probes;
+    stats->maxprobes = mbufptr->maxprobes;
+
+    return 0;
+}
 #endif /* CONFIG_BUFMALLOC */
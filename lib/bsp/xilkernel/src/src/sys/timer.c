@@ -42,12 +42,23 @@
 #include <stdio.h>
 
 #ifdef CONFIG_TIME
-#define get_tmr_list_shadow(tmrlist) ((tmrlist == active_tmrs_a)?(active_tmrs_b):(active_tmrs_a))
+
+// Soft timers are kept on a hierarchical timing wheel. Level 0 has one slot
+// per tick for the next TMR_WHEEL_SIZE ticks, and every higher level has
+// slots that are TMR_WHEEL_SIZE times coarser than the level below it. A
+// timer is hashed into the level that covers its distance from the wheel
+// clock, and is cascaded one level down whenever the lower level wraps.
+// Insert and cancel are O(1) and a tick only touches the timers that expire
+// on it (plus an occasional cascade of a single slot).
+#define TMR_WHEEL_MASK          (TMR_WHEEL_SIZE - 1)
+#define TMR_WHEEL_SLOT(lvl, i)  (((lvl) * TMR_WHEEL_SIZE) + (i))
+#define TMR_WHEEL_INDEX(t, lvl) (((t) >> ((lvl) * TMR_WHEEL_BITS)) & TMR_WHEEL_MASK)
 
 static soft_tmr_t soft_tmrs[MAX_TMRS] ;
-static int* active_tmrs;                   // Pointer to the list of timer IDs that are currently active
-static int  active_tmrs_a[MAX_TMRS];       // Actual timer ID lists A & B. (One is the shadow of the other)
-static int  active_tmrs_b[MAX_TMRS];
+static short tmr_wheel[TMR_WHEEL_LEVELS * TMR_WHEEL_SIZE];              // Head timer ID of each wheel slot. -1 if empty
+static short tmr_freelist;                                              // Head of the list of unused timer IDs
+static short pid_tmr[MAX_PROCESS_CONTEXTS];                             // Timer ID currently armed by each process. -1 if none
+static unsigned int tmr_clock;                                          // Number of ticks processed by the wheel
 static int nactive;
 extern unsigned int kernel_ticks;
 extern struct _queue ready_q[];
@@ -61,20 +72,30 @@ static unsigned int
                 ms_to_ticks (unsigned int ms);
 static unsigned int
                 ticks_to_ms (unsigned int ticks);
-static void     update_active_tmrs_list (pid_t pid);
+static void     tmr_link (short tmr);
+static void     tmr_unlink (short tmr);
+static int      tmr_cascade (int level);
 
 void soft_tmr_init (void)
 {
     int i;
 
     for (i=0; i < MAX_TMRS; i++) {
-	soft_tmrs[i].timeout = 0;
+	soft_tmrs[i].expires = 0;
 	soft_tmrs[i].pid = -1;
-	active_tmrs_a[i] = -1;
-	active_tmrs_b[i] = -1;
+	soft_tmrs[i].slot = -1;
+	soft_tmrs[i].prev = -1;
+	soft_tmrs[i].next = (i == (MAX_TMRS - 1)) ? -1 : (i + 1);
     }
 
-    active_tmrs = active_tmrs_a;                                        // Set the current active timer list to "list A"
+    for (i=0; i < (TMR_WHEEL_LEVELS * TMR_WHEEL_SIZE); i++)
+	tmr_wheel[i] = -1;
+
+    for (i=0; i < MAX_PROCESS_CONTEXTS; i++)
+	pid_tmr[i] = -1;
+
+    tmr_freelist = 0;
+    tmr_clock = 0;
     nactive = 0;
     kernel_ticks = 0;
 }
@@ -112,41 +133,84 @@ static void handle_timeout (signed char pid)
     resched = 1;
 }
 
+// Hash a timer into the wheel slot that covers its expiry time
+static void tmr_link (short tmr)
+{
+    unsigned int delta;
+    unsigned int expires;
+    int level;
+    short slot;
+
+    expires = soft_tmrs[tmr].expires;
+    delta = expires - tmr_clock;
+
+    for (level = 0; level < (TMR_WHEEL_LEVELS - 1); level++) {
+        if (delta < (1U << ((level + 1) * TMR_WHEEL_BITS)))
+            break;
+    }
+
+    if ((level == (TMR_WHEEL_LEVELS - 1)) &&
+        (delta > (TMR_WHEEL_RANGE - 1)))                                 // Beyond the reach of the wheel. Park the timer in the
+        expires = tmr_clock + (TMR_WHEEL_RANGE - 1);                    // farthest slot; it is re-hashed when that slot cascades
+
+    slot = TMR_WHEEL_SLOT(level, TMR_WHEEL_INDEX(expires, level));
+
+    soft_tmrs[tmr].slot = slot;
+    soft_tmrs[tmr].prev = -1;
+    soft_tmrs[tmr].next = tmr_wheel[slot];
+    if (tmr_wheel[slot] != -1)
+        soft_tmrs[tmr_wheel[slot]].prev = tmr;
+    tmr_wheel[slot] = tmr;
+}
+
+static void tmr_unlink (short tmr)
+{
+    short prev = soft_tmrs[tmr].prev;
+    short next = soft_tmrs[tmr].next;
+
+    if (prev == -1)
+        tmr_wheel[soft_tmrs[tmr].slot] = next;
+    else
+        soft_tmrs[prev].next = next;
 
-static void update_active_tmrs_list (pid_t pid)
+    if (next != -1)
+        soft_tmrs[next].prev = prev;
+
+    soft_tmrs[tmr].slot = -1;
+    soft_tmrs[tmr].prev = -1;
+    soft_tmrs[tmr].next = -1;
+}
+
+// Move every timer in the current slot of 'level' one or more levels down.
+// Returns the slot index so that the caller knows whether the next level
+// has to be cascaded as well (index 0 means this level has just wrapped).
+static int tmr_cascade (int level)
 {
-    int i;
-    int* tmrshadow;
-    int curactive = 0;
-
-    tmrshadow = get_tmr_list_shadow(active_tmrs);                       // Get the list that can act as a shadow to the current list
-    for (i=0; i < nactive; i++) {
-        if (soft_tmrs[active_tmrs[i]].pid == pid) {                      // This timer has been removed and is no longer active. Drop it
-            soft_tmrs[active_tmrs[i]].pid = -1;                         // and also make it available for future allocations
-            continue;
-        }
-
-        tmrshadow[curactive] = active_tmrs[i];                      // Append timer id to newly formed list
-        curactive++;
+    int index = TMR_WHEEL_INDEX(tmr_clock, level);
+    short slot = TMR_WHEEL_SLOT(level, index);
+    short tmr, next;
+
+    tmr = tmr_wheel[slot];
+    tmr_wheel[slot] = -1;
+
+    while (tmr != -1) {
+        next = soft_tmrs[tmr].next;
+        tmr_link (tmr);
+        tmr = next;
     }
 
-    active_tmrs = tmrshadow;
-    nactive = curactive;
+    return index;
 }
 
 static int get_free_tmr (void)
 {
-    int i;
+    short tmr = tmr_freelist;
 
-    if (nactive == MAX_TMRS)                                            // Break early if no timers left
+    if (tmr == -1)                                                      // Break early if no timers left
 	return -1;
 
-    for (i = 0; i < MAX_TMRS; i++) {
-	if (soft_tmrs[i].pid == -1)
-	    break;
-    }
-
-    return i;
+    tmr_freelist = soft_tmrs[tmr].next;
+    return tmr;
 }
 
 int add_tmr (pid_t pid, unsigned int ms)
@@ -154,6 +218,9 @@ int add_tmr (pid_t pid, unsigned int ms)
     int tmr;
     unsigned int ticks;
 
+    if (pid_tmr[pid] != -1)                                             // A process waits on at most one timeout. Re-arm it
+        remove_tmr (pid);
+
     if ((tmr = get_free_tmr ()) < 0) {
         DPRINTF ("XMK: add_tmr -> Out of timers\r\n");
 	return -1;
@@ -163,8 +230,9 @@ int add_tmr (pid_t pid, unsigned int ms)
     ticks = (ticks == 0) ? 1 : ticks;                                   // Bump it up a little
 
     soft_tmrs[tmr].pid = pid;
-    soft_tmrs[tmr].timeout = ticks;
-    active_tmrs[nactive] = tmr;
+    soft_tmrs[tmr].expires = tmr_clock + ticks;
+    tmr_link (tmr);
+    pid_tmr[pid] = tmr;
     nactive++;
 
     return 0;
@@ -172,44 +240,63 @@ int add_tmr (pid_t pid, unsigned int ms)
 
 unsigned int remove_tmr (pid_t pid)
 {
-    int i;
-    unsigned int remain = 0;
+    short tmr = pid_tmr[pid];
+    unsigned int remain;
 
-    for (i = 0; i < MAX_TMRS; i++) {
-        if (soft_tmrs[i].pid == pid) {
-            remain = ticks_to_ms (soft_tmrs[i].timeout);
-            update_active_tmrs_list (pid);
-            break;
-        }
-    }
+    if (tmr == -1)
+        return 0;
+
+    remain = ticks_to_ms (soft_tmrs[tmr].expires - tmr_clock);
+    tmr_unlink (tmr);
+
+    soft_tmrs[tmr].pid = -1;                                            // Make it available for future allocations
+    soft_tmrs[tmr].next = tmr_freelist;
+    tmr_freelist = tmr;
+    pid_tmr[pid] = -1;
+    nactive--;
 
     return remain;
 }
 
-// Timer lists A&B.
-// One acts as a shadow to the other always. On every timer update event,
-// the current list is operated on, while the shadow list keeps getting updates
+// Advance the wheel clock by one tick. Higher levels are cascaded down when
+// the level below them wraps, and then every timer in the current level 0
+// slot has expired.
 void soft_tmr_handler (void)
 {
-    int i;
-    int* tmrshadow;
-    int curactive = 0;
-
-    tmrshadow = get_tmr_list_shadow(active_tmrs);                       // Get the list that can act as a shadow to the current list
-    for (i=0; i < nactive; i++) {
-	soft_tmrs[active_tmrs[i]].timeout--;
-        if (soft_tmrs[active_tmrs[i]].timeout == 0) {                   // Timer expired. Unblock the process
-	    handle_timeout (soft_tmrs[active_tmrs[i]].pid);
-	    soft_tmrs[active_tmrs[i]].pid = -1;
-	}
-	else {
-	    tmrshadow[curactive] = active_tmrs[i];                      // Append timer id to newly formed list
-	    curactive++;
-	}
+    int level;
+    short slot;
+    short tmr, next;
+
+    tmr_clock++;
+
+    for (level = 0; level < (TMR_WHEEL_LEVELS - 1); level++) {
+        if (TMR_WHEEL_INDEX(tmr_clock, level) != 0)
+            break;
+        if (tmr_cascade (level + 1) != 0)
+            break;
     }
 
-    active_tmrs = tmrshadow;
-    nactive = curactive;
+    if (nactive == 0)
+        return;
+
+    slot = TMR_WHEEL_SLOT(0, TMR_WHEEL_INDEX(tmr_clock, 0));
+    tmr = tmr_wheel[slot];
+    tmr_wheel[slot] = -1;
+
+    while (tmr != -1) {                                                 // Timer expired. Unblock the process
+        next = soft_tmrs[tmr].next;
+        handle_timeout (soft_tmrs[tmr].pid);
+
+        pid_tmr[soft_tmrs[tmr].pid] = -1;
+        soft_tmrs[tmr].pid = -1;
+        soft_tmrs[tmr].slot = -1;
+        soft_tmrs[tmr].prev = -1;
+        soft_tmrs[tmr].next = tmr_freelist;
+        tmr_freelist = tmr;
+        nactive--;
+
+        tmr = next;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------//
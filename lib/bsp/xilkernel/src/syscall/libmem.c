@@ -59,4 +59,9 @@ void buffree (membuf_t mbuf, void *mem)
 {
     make_syscall ((void*)mbuf, (void*)mem, NULL, NULL, NULL, SC_BUFFREE);
 }
+
+int bufstats (membuf_t mbuf, membuf_stats_t *stats)
+{
+    return (int)make_syscall ((void*)mbuf, (void*)stats, NULL, NULL, NULL, SC_BUFSTATS);
+}
 #endif /* CONFIG_MALLOC */
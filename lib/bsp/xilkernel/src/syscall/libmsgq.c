@@ -60,4 +60,35 @@ ssize_t msgrcv(int msqid, void *msgp, size_t msgsz, long msgtyp, int msgflg)
 {
     return (ssize_t) make_syscall ((void*)msqid, (void*)msgp, (void*)msgsz, (void*)msgtyp, (void*)msgflg, SC_MSGRCV);
 }
+
+void* msgbuf_alloc(size_t msgsz)
+{
+    return make_syscall ((void*)msgsz, NULL, NULL, NULL, NULL, SC_MSGBUF_ALLOC);
+}
+
+int msgbuf_free(void *msgbuf)
+{
+    return (int) make_syscall (msgbuf, NULL, NULL, NULL, NULL, SC_MSGBUF_FREE);
+}
+
+int msgsnd_zc(int msqid, void *msgbuf, size_t msgsz, int msgflg)
+{
+    return (int) make_syscall ((void*)msqid, msgbuf, (void*)msgsz, (void*)msgflg, NULL, SC_MSGSND_ZC);
+}
+
+int msgrcv_batch(int msqid, struct msgbuf_desc *msgv, int nmsgs, int msgflg)
+{
+    return (int) make_syscall ((void*)msqid, (void*)msgv, (void*)nmsgs, (void*)msgflg, NULL, SC_MSGRCV_BATCH);
+}
+
+ssize_t msgrcv_zc(int msqid, void **msgbuf, int msgflg)
+{
+    struct msgbuf_desc desc;
+
+    if (msgrcv_batch (msqid, &desc, 1, msgflg) != 1)
+        return (ssize_t)-1;
+
+    *msgbuf = desc.msg_buf;
+    return (ssize_t)desc.msg_len;
+}
 #endif /* CONFIG_MSGQ */
@@ -0,0 +1,89 @@
+proc swapp_get_name {} {
+    return "Cache Maintenance Benchmark";
+}
+
+proc swapp_get_description {} {
+    return "Reports the CPU cycles per MB of the Data cache maintenance strategies of the standalone BSP: per line, whole cache, adaptive range and range list.";
+}
+
+proc get_stdout {} {
+    set os [hsi::get_os]
+    if { $os == "" } {
+        error "No Operating System specified in the Board Support Package.";
+    }
+    set stdout [common::get_property CONFIG.STDOUT $os];
+    return $stdout;
+}
+
+proc check_stdout_hw {} {
+	set slaves [common::get_property SLAVES [hsi::get_cells -hier [hsi::get_sw_processor]]]
+	foreach slave $slaves {
+		set slave_type [common::get_property IP_NAME [hsi::get_cells -hier $slave]];
+		# Check for MDM-Uart peripheral. The MDM would be listed as a peripheral
+		# only if it has a UART interface. So no further check is required
+		if { $slave_type == "ps7_uart" || $slave_type == "psu_uart" ||
+			 $slave_type == "axi_uartlite" ||
+			 $slave_type == "axi_uart16550" || $slave_type == "iomodule" ||
+			 $slave_type == "mdm" } {
+			return;
+		}
+	}
+
+	error "This application requires a Uart IP in the hardware."
+}
+
+proc check_stdout_sw {} {
+    set stdout [get_stdout];
+    if { $stdout == "none" } {
+        error "The STDOUT parameter is not set on the OS. This app requires stdout to be set."
+    }
+}
+
+proc swapp_is_supported_hw {} {
+
+    # check processor type
+    set proc_instance [hsi::get_sw_processor];
+    set hw_processor [common::get_property HW_INSTANCE $proc_instance]
+
+    set proc_type [common::get_property IP_NAME [hsi::get_cells -hier $hw_processor]];
+    
+    if { $proc_type != "psu_cortexa53" && $proc_type != "ps7_cortexa9" } {
+                error "This application is supported only for CortexA53 and CortexA9 processors.";
+    }
+
+    # the range list API is only provided by the 64-bit A53 BSP
+    if { $proc_type == "psu_cortexa53" } {
+        set compiler [common::get_property CONFIG.compiler $proc_instance]
+        if {[string compare -nocase $compiler "arm-none-eabi-gcc"] == 0} {
+                error "This application is not supported for 32bit A53.";
+        }
+    }
+
+    # check for uart peripheral
+    check_stdout_hw;
+
+    return 1;
+}
+
+proc swapp_is_supported_sw {} {
+    # check for stdout being set
+    check_stdout_sw;
+
+    return 1;
+}
+
+proc swapp_generate {} {
+
+}
+
+proc swapp_get_linker_constraints {} {
+    return "";
+}
+
+proc swapp_get_supported_processors {} {
+    return "psu_cortexa53 ps7_cortexa9";
+}
+
+proc swapp_get_supported_os {} {
+    return "standalone";
+}
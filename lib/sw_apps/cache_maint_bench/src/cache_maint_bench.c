@@ -0,0 +1,217 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file cache_maint_bench.c
+*	This file contains a benchmark of the Data cache maintenance
+*	strategies of the standalone BSP. For each buffer size it dirties the
+*	buffer and reports the CPU cycles per MB needed to flush it:
+*	- line	 : Xil_DCacheFlushRange in pieces below the threshold, so
+*		   that every line is maintained by address
+*	- whole	 : Xil_DCacheFlush (set/way maintenance of the whole cache)
+*	- range	 : Xil_DCacheFlushRange on the whole buffer (adaptive)
+*	- list	 : Xil_DCacheFlushRangeList on four equal pieces
+*
+* @note
+*
+* None.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.0   ms  10/19/26 First release
+*
+*</pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifdef XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ
+#define BENCH_CPU_FREQ_HZ	XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ
+#else
+#define BENCH_CPU_FREQ_HZ	XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ
+#endif
+
+#define BENCH_MAX_LEN		0x800000U	/* 8 MB */
+#define BENCH_LIST_PIECES	4U
+#define BENCH_MB		0x100000U
+
+/************************** Function Prototypes ******************************/
+
+static u64 BenchToCyclesPerMb(XTime Start, XTime End, u32 Len);
+static void BenchFlushByLine(u8 *Buf, u32 Len);
+static void BenchFlushList(u8 *Buf, u32 Len);
+
+/************************** Variable Definitions *****************************/
+
+static u8 BenchBuffer[BENCH_MAX_LEN] __attribute__ ((aligned(64)));
+
+static const u32 BenchSizes[] = {
+	0x4000U, 0x10000U, 0x40000U, 0x100000U, 0x400000U, BENCH_MAX_LEN
+};
+
+/*****************************************************************************/
+int main(void)
+{
+	XTime Start, End;
+	u32 Index;
+	u32 Len;
+
+	xil_printf("\r\nData cache maintenance benchmark\r\n");
+	xil_printf("Range threshold %d bytes, CPU %d Hz\r\n",
+			XIL_DCACHE_RANGE_THRESHOLD, BENCH_CPU_FREQ_HZ);
+	xil_printf("%10s %12s %12s %12s %12s (cycles/MB)\r\n",
+			"bytes", "line", "whole", "range", "list");
+
+	for (Index = 0U; Index < (sizeof(BenchSizes) / sizeof(BenchSizes[0]));
+			Index++) {
+		Len = BenchSizes[Index];
+		xil_printf("%10d", Len);
+
+		memset(BenchBuffer, (s32)Index, Len);
+		XTime_GetTime(&Start);
+		BenchFlushByLine(BenchBuffer, Len);
+		XTime_GetTime(&End);
+		xil_printf(" %12d", (u32)BenchToCyclesPerMb(Start, End, Len));
+
+		memset(BenchBuffer, (s32)Index + 1, Len);
+		XTime_GetTime(&Start);
+		Xil_DCacheFlush();
+		XTime_GetTime(&End);
+		xil_printf(" %12d", (u32)BenchToCyclesPerMb(Start, End, Len));
+
+		memset(BenchBuffer, (s32)Index + 2, Len);
+		XTime_GetTime(&Start);
+		Xil_DCacheFlushRange((INTPTR)BenchBuffer, (INTPTR)Len);
+		XTime_GetTime(&End);
+		xil_printf(" %12d", (u32)BenchToCyclesPerMb(Start, End, Len));
+
+		memset(BenchBuffer, (s32)Index + 3, Len);
+		XTime_GetTime(&Start);
+		BenchFlushList(BenchBuffer, Len);
+		XTime_GetTime(&End);
+		xil_printf(" %12d\r\n", (u32)BenchToCyclesPerMb(Start, End, Len));
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Convert a global timer interval into CPU cycles per MB of buffer.
+*
+* @param	Start is the timer value before the operation.
+* @param	End is the timer value after the operation.
+* @param	Len is the number of bytes the operation covered.
+*
+* @return	Cycles per MB.
+*
+* @note		None.
+*
+******************************************************************************/
+static u64 BenchToCyclesPerMb(XTime Start, XTime End, u32 Len)
+{
+	u64 Cycles;
+
+	Cycles = ((u64)(End - Start) * (u64)BENCH_CPU_FREQ_HZ) /
+			(u64)COUNTS_PER_SECOND;
+
+	return (Cycles * (u64)BENCH_MB) / (u64)Len;
+}
+
+/*****************************************************************************/
+/**
+*
+* Flush a buffer by address only, in pieces small enough to stay below the
+* whole cache threshold.
+*
+* @param	Buf is the buffer to flush.
+* @param	Len is the length of the buffer in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void BenchFlushByLine(u8 *Buf, u32 Len)
+{
+	u32 Piece = XIL_DCACHE_RANGE_THRESHOLD / 2U;
+	u32 Offset;
+
+	for (Offset = 0U; Offset < Len; Offset += Piece) {
+		if ((Len - Offset) < Piece) {
+			Piece = Len - Offset;
+		}
+		Xil_DCacheFlushRange((INTPTR)(Buf + Offset), (INTPTR)Piece);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Flush a buffer as a list of equal pieces with a single call.
+*
+* @param	Buf is the buffer to flush.
+* @param	Len is the length of the buffer in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void BenchFlushList(u8 *Buf, u32 Len)
+{
+	Xil_CacheRange Ranges[BENCH_LIST_PIECES];
+	u32 Piece = Len / BENCH_LIST_PIECES;
+	u32 Index;
+
+	for (Index = 0U; Index < BENCH_LIST_PIECES; Index++) {
+		Ranges[Index].Addr = (INTPTR)(Buf + (Index * Piece));
+		Ranges[Index].Len = (INTPTR)Piece;
+	}
+
+	Xil_DCacheFlushRangeList(Ranges, BENCH_LIST_PIECES);
+}
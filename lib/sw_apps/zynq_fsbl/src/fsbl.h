@@ -228,6 +228,9 @@
 *                       not correct.
 *                       Resolution: Corresponding fields in the devcfg.STATUS
 *                       register are written to, for clearing DMA done count.
+* 14.00a ms 10/19/26	Added FSBL_TRACE boot stage tracing
+*						QSPI linear mode copies use the PS DMA controller
+*						when it is present in the design
 *
 * </pre>
 *
@@ -251,6 +254,17 @@
 * (in case of SD/NAND bootmode)
 * and programming the devcfg dma is accounted.
 *
+* FSBL_TRACE
+*
+* This Flag can be set at compilation time. Each boot stage (PS init,
+* device init, header parse and per partition copy, checksum,
+* authentication, decryption and PL configuration, handoff) is timed with
+* the global timer and logged to a ring buffer at FSBL_TRACE_BASEADDR in
+* OCM, which is left intact for the handoff application. The 4 KB buffer is
+* only taken from OCM when the flag is set. A boot time report is printed
+* before handoff; FSBL_TRACE_BUDGET_US can be set to a boot time budget to
+* compare against.
+*
 * FSBL provides two debug levels
 * DEBUG GENERAL - fsbl_printf under this category will appear only when the
 * FSBL_DEBUG flag is set during compilation
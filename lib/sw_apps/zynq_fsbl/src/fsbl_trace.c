@@ -0,0 +1,193 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal 
+* in the Software without restriction, including without limitation the rights 
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell  
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications: 
+* (a) running on a Xilinx device, or 
+* (b) that interact with a Xilinx device through a bus or interconnect.  
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF 
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE 
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in 
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_trace.c
+*
+* Contains the boot stage tracing. Every traced stage is timed with the
+* global timer and written as one entry to the trace buffer in OCM, and a
+* boot time budget report is printed from it before handoff.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 14.00a ms	10/19/26 Initial release
+*
+* </pre>
+*
+* @note
+*	The global timer runs from the CPU clock, so the PS init stage which
+*	reprograms the PLLs is only approximate. It is only traced if the
+*	Boot ROM left the global timer running.
+*
+******************************************************************************/
+/****************************** Include Files *********************************/
+
+#include "fsbl.h"
+#include "fsbl_trace.h"
+#include "xtime_l.h"
+
+#ifdef FSBL_TRACE
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define TraceBuf	((XilStageTrace *)(void *)TraceMem)
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * Trace buffer, placed at FSBL_TRACE_BASEADDR by lscript.ld. The section
+ * only exists in builds with FSBL_TRACE.
+ */
+static u64 TraceMem[FSBL_TRACE_SIZE / sizeof(u64)]
+		__attribute__((section(".fsbl_trace")));
+
+static XTime TraceStartTime[FSBL_TRACE_MAX_EVENT];
+
+/*
+ * Stages whose start time was taken with the global timer running
+ */
+static u32 TraceStarted;
+
+static const char * const TraceEventName[FSBL_TRACE_MAX_EVENT] = {
+	"",
+	"PS init",
+	"Device init",
+	"Header parse",
+	"Partition copy",
+	"Authentication",
+	"Decryption",
+	"PL config",
+	"Handoff",
+	"Checksum",
+};
+
+/******************************************************************************/
+/**
+*
+* This function initializes the trace buffer header and starts the global
+* timer if the Boot ROM left it stopped
+*
+* @param	None
+*
+* @return	None
+*
+* @note		Called after ps7_init, stages started before with the global
+*			timer stopped are not traced
+*
+****************************************************************************/
+void FsblTraceInit(void)
+{
+	if ((Xil_In32(GLOBAL_TMR_BASEADDR + GTIMER_CONTROL_OFFSET) & 0x1) == 0) {
+		XTime_SetTime(0);
+		TraceStarted = 0;
+	}
+
+	Xil_StageTraceInit(TraceBuf, FSBL_TRACE_SIZE, COUNTS_PER_SECOND);
+}
+
+/******************************************************************************/
+/**
+*
+* This function marks the start of a boot stage
+*
+* @param	Event is one of the FSBL_TRACE_* stages
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void FsblTraceStart(u32 Event)
+{
+	if (Event < FSBL_TRACE_MAX_EVENT) {
+		XTime_GetTime(&TraceStartTime[Event]);
+		TraceStarted |= (1 << Event);
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function marks the end of a boot stage started with FsblTraceStart
+* and writes its entry to the trace buffer
+*
+* @param	Event is one of the FSBL_TRACE_* stages
+* @param	Id is the partition number or FSBL_TRACE_NO_ID
+* @param	Bytes is the number of bytes processed in the stage
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void FsblTraceEnd(u32 Event, u32 Id, u32 Bytes)
+{
+	XTime EndTime;
+
+	if ((Event >= FSBL_TRACE_MAX_EVENT) ||
+			((TraceStarted & (1 << Event)) == 0)) {
+		return;
+	}
+
+	XTime_GetTime(&EndTime);
+	Xil_StageTraceAdd(TraceBuf, Event, Id, TraceStartTime[Event], EndTime,
+			Bytes);
+}
+
+/******************************************************************************/
+/**
+*
+* This function prints the boot time report and leaves the trace buffer in
+* OCM for the handoff application
+*
+* @param	None
+*
+* @return	None
+*
+* @note		None
+*
+****************************************************************************/
+void FsblTraceReport(void)
+{
+	Xil_StageTraceReport(TraceBuf, TraceEventName, FSBL_TRACE_MAX_EVENT,
+			FSBL_TRACE_BUDGET_US);
+}
+#endif /* FSBL_TRACE */
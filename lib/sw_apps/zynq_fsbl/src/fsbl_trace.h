@@ -0,0 +1,127 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal 
+* in the Software without restriction, including without limitation the rights 
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell  
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications: 
+* (a) running on a Xilinx device, or 
+* (b) that interact with a Xilinx device through a bus or interconnect.  
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF 
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE 
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in 
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file fsbl_trace.h
+*
+* Boot stage numbers and trace functions. The trace format and the report
+* come from xil_stagetrace.h of the BSP. The trace buffer is placed in the
+* .fsbl_trace section, which lscript.ld puts at FSBL_TRACE_BASEADDR so that
+* the handoff application can read it. The stage numbering is the same as
+* in the Zynq MP FSBL.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 14.00a ms	10/19/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#ifndef ___FSBL_TRACE_H___
+#define ___FSBL_TRACE_H___
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_stagetrace.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Trace buffer location in OCM, must match .fsbl_trace in lscript.ld
+ */
+#define FSBL_TRACE_BASEADDR		0xFFFFEE00
+#define FSBL_TRACE_SIZE			0x1000
+
+/*
+ * Boot time budget the report is compared against, 0 disables it
+ */
+#ifndef FSBL_TRACE_BUDGET_US
+#define FSBL_TRACE_BUDGET_US	0
+#endif
+
+/*
+ * Traced boot stages
+ */
+#define FSBL_TRACE_PS_INIT			1
+#define FSBL_TRACE_DEVICE_INIT		2
+#define FSBL_TRACE_HEADER_PARSE		3
+#define FSBL_TRACE_PARTITION_COPY	4
+#define FSBL_TRACE_AUTHENTICATION	5
+#define FSBL_TRACE_DECRYPTION		6
+#define FSBL_TRACE_PL_CONFIG		7
+#define FSBL_TRACE_HANDOFF			8
+#define FSBL_TRACE_CHECKSUM			9
+#define FSBL_TRACE_MAX_EVENT		10
+
+/*
+ * Id of the stages which are not partition specific
+ */
+#define FSBL_TRACE_NO_ID			XIL_STAGETRACE_NO_ID
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+#ifdef FSBL_TRACE
+void FsblTraceInit(void);
+void FsblTraceStart(u32 Event);
+void FsblTraceEnd(u32 Event, u32 Id, u32 Bytes);
+void FsblTraceReport(void);
+#else
+#define FsblTraceInit()
+#define FsblTraceStart(Event)
+#define FsblTraceEnd(Event, Id, Bytes)
+#define FsblTraceReport()
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* ___FSBL_TRACE_H___ */
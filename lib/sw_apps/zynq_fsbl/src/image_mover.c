@@ -73,6 +73,13 @@
 * 						fallback image offset handling using MD5
 * 						Fix for PR#782309 Fallback support for AES
 * 						encryption with E-Fuse - Enhancement
+* 14.00a ms 10/19/26	Added boot stage tracing of header parse, copy,
+* 						checksum, authentication, decryption and PL config
+* 						Checksum is calculated with D-cache enabled and,
+* 						for linear boot devices, block by block while the
+* 						PCAP DMA copies the next block to DDR
+* 						Partitions copied as is from the QSPI linear
+* 						window are moved by the PS DMA controller
 *
 * </pre>
 *
@@ -89,14 +96,17 @@
 #include "pcap.h"
 #include "fsbl_hooks.h"
 #include "md5.h"
+#include "fsbl_trace.h"
+#include "qspi.h"
 
 #ifdef XPAR_XWDTPS_0_BASEADDR
 #include "xwdtps.h"
 #endif
 
+#include "xil_cache.h"
+
 #ifdef RSA_SUPPORT
 #include "rsa.h"
-#include "xil_cache.h"
 #endif
 /************************** Constant Definitions *****************************/
 
@@ -104,6 +114,12 @@
 #define MAXIMUM_IMAGE_WORD_LEN 0x40000000
 #define MD5_CHECKSUM_SIZE   16
 
+/*
+ * Block size used when the partition checksum is calculated, either while
+ * PCAP copies the next block or between watchdog restarts
+ */
+#define CHECKSUM_BLOCK_SIZE	0x10000
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -112,6 +128,8 @@
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
+static u32 PcapDataTransferChecksum(u32 SourceAddr, u32 LoadAddr,
+		u32 WordLen);
 
 /************************** Variable Definitions *****************************/
 /*
@@ -128,6 +146,13 @@ u8 ApplicationFlag;
 u32 ExecutionAddress;
 ImageMoverType MoveImage;
 
+/*
+ * Checksum calculated by PartitionMove while the partition was copied,
+ * consumed by ValidateParition
+ */
+static u8 CopyChecksum[MD5_CHECKSUM_SIZE];
+static u8 CopyChecksumValid;
+
 /*
  * Header array
  */
@@ -227,12 +252,14 @@ u32 LoadBootImage(void)
 	/*
 	 * Get partitions header information
 	 */
+	FsblTraceStart(FSBL_TRACE_HEADER_PARSE);
 	Status = GetPartitionHeaderInfo(ImageStartAddress);
 	if (Status != XST_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL, "Partition Header Load Failed\r\n");
 		OutputStatus(GET_HEADER_INFO_FAIL);
 		FsblFallback();
 	}
+	FsblTraceEnd(FSBL_TRACE_HEADER_PARSE, FSBL_TRACE_NO_ID, 0);
 
 	/*
 	 * RSA is not implemented in 1.0 and 2.0
@@ -265,6 +292,7 @@ u32 LoadBootImage(void)
 			}
 			HeaderSize=TOTAL_HEADER_SIZE+RSA_SIGNATURE_SIZE;
 
+			FsblTraceStart(FSBL_TRACE_AUTHENTICATION);
 			Status = AuthenticatePartition((u8 *)DDR_TEMP_START_ADDR, HeaderSize);
 			if (Status != XST_SUCCESS) {
 				fsbl_printf(DEBUG_GENERAL,
@@ -272,6 +300,8 @@ u32 LoadBootImage(void)
 				OutputStatus(GET_HEADER_INFO_FAIL);
 				FsblFallback();
 			}
+			FsblTraceEnd(FSBL_TRACE_AUTHENTICATION, FSBL_TRACE_NO_ID,
+					HeaderSize);
 #else
 			/*
 			 * In case user not enabled RSA authentication feature
@@ -448,12 +478,15 @@ u32 LoadBootImage(void)
 		/*
 		 * Move partitions from boot device
 		 */
+		FsblTraceStart(FSBL_TRACE_PARTITION_COPY);
 		Status = PartitionMove(ImageStartAddress, HeaderPtr);
 		if (Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL,"PARTITION_MOVE_FAIL\r\n");
 			OutputStatus(PARTITION_MOVE_FAIL);
 			FsblFallback();
 		}
+		FsblTraceEnd(FSBL_TRACE_PARTITION_COPY, PartitionNum,
+				PartitionTotalSize << WORD_LENGTH_SHIFT);
 
 		if ((SignedPartitionFlag) || (PartitionChecksumFlag)) {
 			if(PLPartitionFlag) {
@@ -470,6 +503,7 @@ u32 LoadBootImage(void)
 				/*
 				 * Validate the partition data with checksum
 				 */
+				FsblTraceStart(FSBL_TRACE_CHECKSUM);
 				Status = ValidateParition(PartitionStartAddr,
 						(PartitionTotalSize << WORD_LENGTH_SHIFT),
 						ImageStartAddress  +
@@ -479,6 +513,8 @@ u32 LoadBootImage(void)
 					OutputStatus(PARTITION_CHECKSUM_FAIL);
 					FsblFallback();
 				}
+				FsblTraceEnd(FSBL_TRACE_CHECKSUM, PartitionNum,
+						PartitionTotalSize << WORD_LENGTH_SHIFT);
 
 				fsbl_printf(DEBUG_INFO, "Partition Validation Done\r\n");
 			}
@@ -488,6 +524,7 @@ u32 LoadBootImage(void)
 			 */
 			if (SignedPartitionFlag == 1 ) {
 #ifdef RSA_SUPPORT
+				FsblTraceStart(FSBL_TRACE_AUTHENTICATION);
 				Xil_DCacheEnable();
 				Status = AuthenticatePartition((u8*)PartitionStartAddr,
 						(PartitionTotalSize << WORD_LENGTH_SHIFT));
@@ -501,6 +538,8 @@ u32 LoadBootImage(void)
 				fsbl_printf(DEBUG_INFO,"Authentication Done\r\n");
 				Xil_DCacheFlush();
                 Xil_DCacheDisable();
+				FsblTraceEnd(FSBL_TRACE_AUTHENTICATION, PartitionNum,
+						PartitionTotalSize << WORD_LENGTH_SHIFT);
 #else
 				/*
 				 * In case user not enabled RSA authentication feature
@@ -515,6 +554,7 @@ u32 LoadBootImage(void)
 			 * Decrypt PS partition
 			 */
 			if (EncryptedPartitionFlag && PSPartitionFlag) {
+				FsblTraceStart(FSBL_TRACE_DECRYPTION);
 				Status = DecryptPartition(PartitionStartAddr,
 						PartitionDataLength,
 						PartitionImageLength);
@@ -523,12 +563,15 @@ u32 LoadBootImage(void)
 					OutputStatus(DECRYPTION_FAIL);
 					FsblFallback();
 				}
+				FsblTraceEnd(FSBL_TRACE_DECRYPTION, PartitionNum,
+						PartitionImageLength << WORD_LENGTH_SHIFT);
 			}
 
 			/*
 			 * Load Signed PL partition in Fabric
 			 */
 			if (PLPartitionFlag) {
+				FsblTraceStart(FSBL_TRACE_PL_CONFIG);
 				Status = PcapLoadPartition((u32*)PartitionStartAddr,
 						(u32*)PartitionLoadAddr,
 						PartitionImageLength,
@@ -539,6 +582,8 @@ u32 LoadBootImage(void)
 					OutputStatus(BITSTREAM_DOWNLOAD_FAIL);
 					FsblFallback();
 				}
+				FsblTraceEnd(FSBL_TRACE_PL_CONFIG, PartitionNum,
+						PartitionImageLength << WORD_LENGTH_SHIFT);
 			}
 		}
 
@@ -1050,6 +1095,8 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
     u32 ImageWordLen;
     u32 DataWordLen;
 
+	CopyChecksumValid = 0;
+
 	SourceAddr = ImageBaseAddress;
 	SourceAddr += Header->PartitionStart<<WORD_LENGTH_SHIFT;
 	LoadAddr = Header->LoadAddr;
@@ -1129,13 +1176,28 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 		}
 
 		/*
-		 * Data transfer using PCAP
+		 * Data transfer using PCAP. A partition copied as is for
+		 * checksum validation is checksummed block by block while
+		 * PCAP copies the next block. Other partitions copied as is
+		 * from the QSPI linear window are moved by the PS DMA
+		 * controller, if there is one
 		 */
-		Status = PcapDataTransfer((u32*)SourceAddr,
+		if (PartitionChecksumFlag && (!SecureTransferFlag)) {
+			Status = PcapDataTransferChecksum(SourceAddr, LoadAddr,
+						ImageWordLen);
+#ifdef QSPI_LINEAR_DMA
+		} else if ((!SecureTransferFlag) &&
+				(QspiLinearDmaCopy(SourceAddr, LoadAddr,
+				(ImageWordLen << WORD_LENGTH_SHIFT)) == XST_SUCCESS)) {
+			Status = XST_SUCCESS;
+#endif
+		} else {
+			Status = PcapDataTransfer((u32*)SourceAddr,
 						(u32*)LoadAddr,
 						ImageWordLen,
 						DataWordLen,
 						SecureTransferFlag);
+		}
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "PCAP Data Transfer Failed\r\n");
 			return XST_FAILURE;
@@ -1249,11 +1311,19 @@ u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset)
     fsbl_printf(DEBUG_INFO, "\r\n");
 
     /*
-     * Calculate checksum for the partition
+     * Calculate checksum for the partition, unless it was already
+     * calculated while the partition was copied
      */
-    Status = CalcPartitionChecksum(StartAddr, Length, &CalcChecksum[0]);
-	if(Status != XST_SUCCESS) {
-        return XST_FAILURE;
+    if (CopyChecksumValid) {
+    	for (Index = 0; Index < MD5_CHECKSUM_SIZE; Index++) {
+    		CalcChecksum[Index] = CopyChecksum[Index];
+    	}
+    	CopyChecksumValid = 0;
+    } else {
+    	Status = CalcPartitionChecksum(StartAddr, Length, &CalcChecksum[0]);
+    	if(Status != XST_SUCCESS) {
+    		return XST_FAILURE;
+    	}
     }
 
     fsbl_printf(DEBUG_INFO, "Calculated checksum\r\n");
@@ -1320,16 +1390,139 @@ u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum)
 *		- XST_SUCCESS if Checksum calculate successful
 *		- XST_FAILURE if Checksum calculate failed
 *
-* @note		None
+* @note		D-cache is enabled while the checksum is calculated, as it is
+*		for authentication
 *
 *******************************************************************************/
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
 {
+	MD5Context Context;
+	u32 BlockSize;
+
+	Xil_DCacheEnable();
+
 	/*
 	 * Calculate checksum using MD5 algorithm
 	 */
-	md5((u8*)SourceAddr, DataLength, Checksum, 0 );
+	MD5Init(&Context);
+
+	while (DataLength > 0) {
+		BlockSize = DataLength;
+		if (BlockSize > CHECKSUM_BLOCK_SIZE) {
+			BlockSize = CHECKSUM_BLOCK_SIZE;
+		}
+
+#ifdef	XPAR_XWDTPS_0_BASEADDR
+		/*
+		 * Prevent WDT reset
+		 */
+		XWdtPs_RestartWdt(&Watchdog);
+#endif
+
+		MD5Update(&Context, (u8*)SourceAddr, BlockSize, 0);
+
+		SourceAddr += BlockSize;
+		DataLength -= BlockSize;
+	}
+
+	MD5Final(&Context, Checksum, 0);
+
+	Xil_DCacheFlush();
+	Xil_DCacheDisable();
 
     return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+*
+* This function copies a partition using non-secure PCAP transfers of
+* CHECKSUM_BLOCK_SIZE bytes and calculates its checksum on the way. Each
+* block is checksummed while PCAP copies the next one, so for a linear boot
+* device the checksum costs little more than the copy. The result is kept
+* for ValidateParition.
+*
+* @param	SourceAddr is the partition address in the linear flash window
+* @param	LoadAddr is the address the partition is copied to
+* @param	WordLen is the partition length in words
+*
+* @return
+*		- XST_SUCCESS if the copy is successful
+*		- XST_FAILURE if a PCAP transfer fails
+*
+* @note		Every block is invalidated from the cache after its transfer
+*		completes, so that no line fetched while PCAP was still
+*		writing it is used for the checksum.
+*
+*******************************************************************************/
+static u32 PcapDataTransferChecksum(u32 SourceAddr, u32 LoadAddr,
+		u32 WordLen)
+{
+	MD5Context Context;
+	u32 Status;
+	u32 Length = WordLen << WORD_LENGTH_SHIFT;
+	u32 Offset = 0;
+	u32 BlockSize;
+	u32 NextOffset;
+	u32 NextBlockSize;
+
+	BlockSize = Length;
+	if (BlockSize > CHECKSUM_BLOCK_SIZE) {
+		BlockSize = CHECKSUM_BLOCK_SIZE;
+	}
+
+	Status = PcapDataTransferStart((u32*)SourceAddr, (u32*)LoadAddr,
+				BlockSize >> WORD_LENGTH_SHIFT,
+				BlockSize >> WORD_LENGTH_SHIFT, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	MD5Init(&Context);
+	Xil_DCacheEnable();
+
+	while (Offset < Length) {
+		Status = PcapDataTransferWait();
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		/*
+		 * Start the next block before checksumming this one
+		 */
+		NextOffset = Offset + BlockSize;
+		if (NextOffset < Length) {
+			NextBlockSize = Length - NextOffset;
+			if (NextBlockSize > CHECKSUM_BLOCK_SIZE) {
+				NextBlockSize = CHECKSUM_BLOCK_SIZE;
+			}
+
+			Status = PcapDataTransferStart((u32*)(SourceAddr + NextOffset),
+					(u32*)(LoadAddr + NextOffset),
+					NextBlockSize >> WORD_LENGTH_SHIFT,
+					NextBlockSize >> WORD_LENGTH_SHIFT, 0);
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+		} else {
+			NextBlockSize = 0;
+		}
+
+		Xil_DCacheInvalidateRange((INTPTR)(LoadAddr + Offset), BlockSize);
+		MD5Update(&Context, (u8*)(LoadAddr + Offset), BlockSize, 0);
+
+		Offset = NextOffset;
+		BlockSize = NextBlockSize;
+	}
+
+	if (Status == XST_SUCCESS) {
+		MD5Final(&Context, CopyChecksum, 0);
+		CopyChecksumValid = 1;
+	}
+
+	Xil_DCacheFlush();
+	Xil_DCacheDisable();
+
+	return Status;
+}
+
@@ -99,6 +99,7 @@
 * 11.00a kv 10/08/14	Fix for CR#826030 - LinearBootDeviceFlag should
 *											be initialized to 0 in IO mode
 *											case
+* 14.00a ms 10/19/26	Added boot stage tracing (FSBL_TRACE)
 * </pre>
 *
 * @note
@@ -130,6 +131,7 @@
 #include "xstatus.h"
 #include "fsbl_hooks.h"
 #include "xtime_l.h"
+#include "fsbl_trace.h"
 
 #ifdef XPAR_XWDTPS_0_BASEADDR
 #include "xwdtps.h"
@@ -235,6 +237,7 @@ int main(void)
 	/*
 	 * PCW initialization for MIO,PLL,CLK and DDR
 	 */
+	FsblTraceStart(FSBL_TRACE_PS_INIT);
 	Status = ps7_init();
 	if (Status != FSBL_PS7_INIT_SUCCESS) {
 		fsbl_printf(DEBUG_GENERAL,"PS7_INIT_FAIL : %s\r\n",
@@ -247,6 +250,12 @@ int main(void)
 		FsblHookFallback();
 	}
 
+	/*
+	 * The trace buffer is set up once the PS is initialized
+	 */
+	FsblTraceInit();
+	FsblTraceEnd(FSBL_TRACE_PS_INIT, FSBL_TRACE_NO_ID, 0);
+
 	/*
 	 * Unlock SLCR for SLCR register write
 	 */
@@ -372,6 +381,7 @@ int main(void)
 	/*
 	 * Read bootmode register
 	 */
+	FsblTraceStart(FSBL_TRACE_DEVICE_INIT);
 	BootModeRegister = Xil_In32(BOOT_MODE_REG);
 	BootModeRegister &= BOOT_MODES_MASK;
 
@@ -510,6 +520,7 @@ int main(void)
 	}
 
 	fsbl_printf(DEBUG_INFO,"Flash Base Address: 0x%08lx\r\n", FlashReadBaseAddress);
+	FsblTraceEnd(FSBL_TRACE_DEVICE_INIT, FSBL_TRACE_NO_ID, 0);
 
 	/*
 	 * Check for valid flash address
@@ -706,6 +717,8 @@ void FsblHandoff(u32 FsblStartAddr)
 {
 	u32 Status;
 
+	FsblTraceStart(FSBL_TRACE_HANDOFF);
+
 	/*
 	 * Enable level shifter
 	 */
@@ -759,6 +772,13 @@ void FsblHandoff(u32 FsblStartAddr)
 	XWdtPs_Stop(&Watchdog);
 #endif
 
+	/*
+	 * Close the trace and print the boot time report, the trace
+	 * buffer stays in OCM for the application
+	 */
+	FsblTraceEnd(FSBL_TRACE_HANDOFF, FSBL_TRACE_NO_ID, 0);
+	FsblTraceReport();
+
 	/*
 	 * Clear our mark in reboot status register
 	 */
@@ -67,6 +67,9 @@
 * Ver	Who	Date		Changes
 * ----- ---- -------- -------------------------------------------------------
 * 5.00a sgd	05/17/13 Initial release
+* 14.00a ms	10/19/26 Word aligned input is hashed in place instead of being
+*			 copied block by block into the context, MD5Memcpy copies
+*			 words when both pointers are word aligned
 *
 *
 * </pre>
@@ -127,6 +130,19 @@ inline void * MD5Memcpy( void *dest, const void *src,
 	register char * src8 = (char*)src;
 	
 	if( doByteSwap == FALSE ) {
+		if( ( ( (UINTPTR)dst8 | (UINTPTR)src8 ) & 0x3 ) == 0 ) {
+			register u32 * dst32 = (u32 *)dst8;
+			register u32 * src32 = (u32 *)src8;
+
+			while( count >= sizeof( u32 ) ) {
+				*dst32++ = *src32++;
+				count -= sizeof( u32 );
+			}
+
+			dst8 = (char *)dst32;
+			src8 = (char *)src32;
+		}
+
 		while( count-- )
 			*dst8++ = *src8++;
 	} else {
@@ -354,9 +370,20 @@ inline void MD5Update( MD5Context *context, u8 *buffer,
 	}
 		
 	/*
-	 * Process data in 64-byte, 512 bit, chunks
+	 * Process data in 64-byte, 512 bit, chunks. Word aligned data that
+	 * needs no byte swap is already in the layout MD5Transform expects,
+	 * so it is hashed in place rather than copied to the context first.
 	 */
 
+	if( ( doByteSwap == FALSE ) && ( ( (UINTPTR)buffer & 0x3 ) == 0 ) ) {
+		while( len >= MD5_SIGNATURE_BYTE_SIZE ) {
+			MD5Transform( context->buffer, (u32 *)buffer );
+
+			buffer += MD5_SIGNATURE_BYTE_SIZE;
+			len    -= MD5_SIGNATURE_BYTE_SIZE;
+		}
+	}
+
 	while( len >= MD5_SIGNATURE_BYTE_SIZE ) {
 		MD5Memcpy( context->intermediate, buffer, MD5_SIGNATURE_BYTE_SIZE,
 				 doByteSwap );
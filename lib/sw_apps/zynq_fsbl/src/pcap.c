@@ -74,6 +74,9 @@
 * 10.00a kc 07/24/14    Fix for CR#809336 - Minor code cleanup
 * 13.00a ssc 04/10/15   Fix for CR#846899 - Corrected logic to clear
 *                                           DMA done count
+* 14.00a ms  10/19/26   Split PcapDataTransfer into PcapDataTransferStart
+*                       and PcapDataTransferWait so that the caller can
+*                       checksum data while the next block is transferred
 * </pre>
 *
 * @note
@@ -142,7 +145,60 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
 {
 	u32 Status;
-	u32 IntrStsReg;
+
+#ifdef FSBL_PERF
+	XTime tXferCur = 0;
+	FsblGetGlobalTime(&tXferCur);
+#endif
+
+	Status = PcapDataTransferStart(SourceDataPtr, DestinationDataPtr,
+				SourceLength, DestinationLength, SecureTransfer);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = PcapDataTransferWait();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * For Performance measurement
+	 */
+#ifdef FSBL_PERF
+	XTime tXferEnd = 0;
+	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
+	FsblMeasurePerfTime(tXferCur,tXferEnd);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function starts a PCAP data transfer and returns without waiting for
+* the DMA to complete. PcapDataTransferWait has to be called before the
+* destination is read or another transfer is started.
+*
+* @param 	SourceDataPtr is a pointer to where the data is read from
+* @param 	DestinationDataPtr is a pointer to where the data is written to
+* @param 	SourceLength is the length of the data to be moved in words
+* @param 	DestinationLength is the length of the data to be moved in words
+* @param 	SecureTransfer indicated the encryption key location, 0 for
+* 			non-encrypted
+*
+* @return
+*		- XST_SUCCESS if the transfer is started
+*		- XST_FAILURE if the transfer could not be started
+*
+* @note		 None
+*
+****************************************************************************/
+u32 PcapDataTransferStart(u32 *SourceDataPtr, u32 *DestinationDataPtr,
+				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
+{
+	u32 Status;
 	u32 PcapTransferType = XDCFG_CONCURRENT_NONSEC_READ_WRITE;
 
 	/*
@@ -152,11 +208,6 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		PcapTransferType = XDCFG_CONCURRENT_SECURE_READ_WRITE;
 	}
 
-#ifdef FSBL_PERF
-	XTime tXferCur = 0;
-	FsblGetGlobalTime(&tXferCur);
-#endif
-
 	/*
 	 * Clear the PCAP status registers
 	 */
@@ -196,6 +247,29 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	 */
 	PcapDumpRegisters();
 
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for a transfer started by PcapDataTransferStart to
+* complete and checks the PCAP error status.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the transfer is successful
+*		- XST_FAILURE if the transfer fails
+*
+* @note		 None
+*
+****************************************************************************/
+u32 PcapDataTransferWait(void)
+{
+	u32 Status;
+	u32 IntrStsReg;
+
 	/*
 	 * Poll for the DMA done
 	 */
@@ -206,7 +280,7 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	}
 
 	fsbl_printf(DEBUG_INFO,"DMA Done ! \n\r");
-		
+
 	/*
 	 * Check for errors
 	 */
@@ -216,15 +290,6 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		return XST_FAILURE;
 	}
 
-	/*
-	 * For Performance measurement
-	 */
-#ifdef FSBL_PERF
-	XTime tXferEnd = 0;
-	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
-	FsblMeasurePerfTime(tXferCur,tXferEnd);
-#endif
-
 	return XST_SUCCESS;
 }
 
@@ -44,6 +44,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a ecm	02/10/10 Initial release
 * 2.00a mb  16/08/12 Added the macros and function prototypes
+* 14.00a ms 10/19/26 Added PcapDataTransferStart and PcapDataTransferWait
 * </pre>
 *
 * @note
@@ -91,6 +92,9 @@ u32 PcapLoadPartition(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
 		 	u32 DestinationLength, u32 Flags);
 u32 PcapDataTransfer(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
  			u32 DestinationLength, u32 Flags);
+u32 PcapDataTransferStart(u32 *SourceData, u32 *DestinationData,
+			u32 SourceLength, u32 DestinationLength, u32 Flags);
+u32 PcapDataTransferWait(void);
 /************************** Variable Definitions *****************************/
 #ifdef __cplusplus
 }
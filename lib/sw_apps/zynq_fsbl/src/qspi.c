@@ -58,6 +58,8 @@
 * 7.00a kc  10/25/13 Fix for CR#739968 - FSBL should do the QSPI config
 *                    					 settings for Dual parallel
 *                    					 configuration in IO mode
+* 14.00a ms 10/19/26 Added QspiLinearDmaCopy, partition copies from the
+*                    linear window are done by the PS DMA controller
 *
 * </pre>
 *
@@ -74,6 +76,10 @@
 #include "xqspips_hw.h"
 #include "xqspips.h"
 
+#ifdef XPAR_XDMAPS_1_DEVICE_ID
+#include "xdmaps.h"
+#endif
+
 /************************** Constant Definitions *****************************/
 
 /*
@@ -152,6 +158,19 @@
 					 LQSPI_CR_1_DUMMY_BYTE | \
 					 LQSPI_CR_FAST_QUAD_READ)
 
+/*
+ * The following defines are for partition copies from the linear window
+ * using the secure instance of the PS DMA controller. A DMA program covers
+ * at most 256 x 256 bursts, so longer copies are split in
+ * QSPI_DMA_BLOCK_SIZE blocks.
+ */
+#define QSPI_DMA_DEVICE_ID	XPAR_XDMAPS_1_DEVICE_ID
+#define QSPI_DMA_CHANNEL	0
+#define QSPI_DMA_BLOCK_SIZE	0x100000
+#define QSPI_DMA_BURST_SIZE	4
+#define QSPI_DMA_BURST_LEN	16
+#define QSPI_DMA_TIMEOUT	100000000
+
 
 /**************************** Type Definitions *******************************/
 
@@ -159,6 +178,12 @@
 
 /************************** Function Prototypes ******************************/
 
+#ifdef XPAR_XDMAPS_1_DEVICE_ID
+static u32 InitQspiDma(void);
+static u32 QspiDmaCopy(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 XQspiPs QspiInstance;
@@ -173,6 +198,11 @@ extern u8 LinearBootDeviceFlag;
  * are global to avoid having large buffers on the stack
  */
 u8 ReadBuffer[DATA_SIZE + DATA_OFFSET + DUMMY_SIZE];
+
+#ifdef XPAR_XDMAPS_1_DEVICE_ID
+static XDmaPs QspiDmaInstance;
+static u8 QspiDmaReady;
+#endif
 u8 WriteBuffer[DATA_OFFSET + DUMMY_SIZE];
 
 /******************************************************************************/
@@ -335,6 +365,19 @@ u32 InitQspi(void)
 		XQspiPs_SetLqspiConfigReg(QspiInstancePtr, DUAL_STACK_CONFIG_READ);
 	}
 
+#ifdef XPAR_XDMAPS_1_DEVICE_ID
+	/*
+	 * Partition copies from the linear window are done by DMA, PCAP is
+	 * used if the DMA controller can not be initialized
+	 */
+	if (LinearBootDeviceFlag == 1) {
+		if (InitQspiDma() != XST_SUCCESS) {
+			fsbl_printf(DEBUG_INFO,"QSPI DMA init failed, "
+					"using CPU copy\r\n");
+		}
+	}
+#endif
+
 	return XST_SUCCESS;
 }
 
@@ -745,5 +788,171 @@ u32 SendBankSelect(u8 BankSel)
 
 	return XST_SUCCESS;
 }
+#ifdef XPAR_XDMAPS_1_DEVICE_ID
+/******************************************************************************/
+/**
+*
+* This function initializes the PS DMA controller used for linear mode QSPI
+* copies. The DMA interrupts are not connected, completion is polled.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the DMA controller is ready
+*		- XST_FAILURE otherwise
+*
+* @note		None
+*
+****************************************************************************/
+static u32 InitQspiDma(void)
+{
+	XDmaPs_Config *DmaCfgPtr;
+	u32 Status;
+
+	QspiDmaReady = 0;
+
+	DmaCfgPtr = XDmaPs_LookupConfig(QSPI_DMA_DEVICE_ID);
+	if (DmaCfgPtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	Status = XDmaPs_CfgInitialize(&QspiDmaInstance, DmaCfgPtr,
+					DmaCfgPtr->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	QspiDmaReady = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function copies a partition from the QSPI linear window with the PS
+* DMA controller.
+*
+* @param	SourceAddress is the address in the linear window
+* @param	DestinationAddress is the address in DDR or OCM
+* @param	LengthBytes is the length of the data in bytes, multiple of 4
+*
+* @return
+*		- XST_SUCCESS if the data has been copied
+*		- XST_FAILURE if the DMA controller is not available, nothing
+*		  has been copied then
+*
+* @note		None
+*
+****************************************************************************/
+u32 QspiLinearDmaCopy(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes)
+{
+	if ((LinearBootDeviceFlag == 0) || (QspiDmaReady == 0)) {
+		return XST_FAILURE;
+	}
+
+	return QspiDmaCopy(SourceAddress, DestinationAddress, LengthBytes);
+}
+
+/******************************************************************************/
+/**
+*
+* This function copies data from the QSPI linear window with the PS DMA
+* controller, in blocks of QSPI_DMA_BLOCK_SIZE bytes.
+*
+* @param	SourceAddress is the address in the linear window
+* @param	DestinationAddress is the address in DDR or OCM
+* @param	LengthBytes is the length of the data in bytes, multiple of 4
+*
+* @return
+*		- XST_SUCCESS if the copy completes correctly
+*		- XST_FAILURE if the DMA faults or times out
+*
+* @note		On failure the DMA controller is not used again and the copy
+*		is retried with memcpy.
+*
+****************************************************************************/
+static u32 QspiDmaCopy(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes)
+{
+	XDmaPs_Cmd DmaCmd;
+	u32 BaseAddress = QspiDmaInstance.Config.BaseAddress;
+	u32 BlockSize;
+	u32 IntrStatus;
+	u32 Count;
+	u32 Status = XST_SUCCESS;
+	u32 Offset = 0;
+
+	while (Offset < LengthBytes) {
+		BlockSize = LengthBytes - Offset;
+		if (BlockSize > QSPI_DMA_BLOCK_SIZE) {
+			BlockSize = QSPI_DMA_BLOCK_SIZE;
+		}
+
+		memset(&DmaCmd, 0, sizeof(XDmaPs_Cmd));
+		DmaCmd.ChanCtrl.SrcBurstSize = QSPI_DMA_BURST_SIZE;
+		DmaCmd.ChanCtrl.SrcBurstLen = QSPI_DMA_BURST_LEN;
+		DmaCmd.ChanCtrl.SrcInc = 1;
+		DmaCmd.ChanCtrl.DstBurstSize = QSPI_DMA_BURST_SIZE;
+		DmaCmd.ChanCtrl.DstBurstLen = QSPI_DMA_BURST_LEN;
+		DmaCmd.ChanCtrl.DstInc = 1;
+		DmaCmd.BD.SrcAddr = SourceAddress + Offset;
+		DmaCmd.BD.DstAddr = DestinationAddress + Offset;
+		DmaCmd.BD.Length = BlockSize;
+
+		Status = XDmaPs_Start(&QspiDmaInstance, QSPI_DMA_CHANNEL,
+					&DmaCmd, 0);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		/*
+		 * Poll for the channel done event, the DMA program signals
+		 * it when the last store has completed
+		 */
+		Count = QSPI_DMA_TIMEOUT;
+		do {
+			IntrStatus = XDmaPs_ReadReg(BaseAddress,
+						XDMAPS_INTSTATUS_OFFSET);
+			if (XDmaPs_ReadReg(BaseAddress, XDMAPS_FSC_OFFSET) &
+					(1U << QSPI_DMA_CHANNEL)) {
+				fsbl_printf(DEBUG_GENERAL,"QSPI DMA fault 0x%lx\r\n",
+					XDmaPs_ReadReg(BaseAddress,
+					XDmaPs_FTCn_OFFSET(QSPI_DMA_CHANNEL)));
+				Status = XST_FAILURE;
+				break;
+			}
+			Count--;
+		} while (((IntrStatus & (1U << QSPI_DMA_CHANNEL)) == 0) &&
+				(Count != 0));
+
+		if ((Status != XST_SUCCESS) || (Count == 0)) {
+			Status = XST_FAILURE;
+			break;
+		}
+
+		/*
+		 * Acknowledge the event and release the DMA program buffer
+		 */
+		XDmaPs_DoneISR_0(&QspiDmaInstance);
+
+		Offset += BlockSize;
+	}
+
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"QSPI DMA copy failed, "
+				"using CPU copy\r\n");
+		XDmaPs_ResetChannel(&QspiDmaInstance, QSPI_DMA_CHANNEL);
+		QspiDmaReady = 0;
+
+		memcpy((void*)DestinationAddress, (const void*)SourceAddress,
+			(size_t)LengthBytes);
+	}
+
+	return XST_SUCCESS;
+}
+#endif
+
 #endif
 
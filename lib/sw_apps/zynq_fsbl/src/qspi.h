@@ -45,6 +45,7 @@
 * 3.00a mb  01/09/12 Added the Delay Values defines for qspi
 * 5.00a sgd	05/17/13 Added Flash Size > 128Mbit support
 * 					 Dual Stack support
+* 14.00a ms 10/19/26 Added QspiLinearDmaCopy
 * </pre>
 *
 * @note
@@ -103,6 +104,15 @@ extern "C" {
 #define FLASH_SIZE_512M			0x4000000
 #define FLASH_SIZE_1G			0x8000000
 
+/*
+ * Partitions are copied from the QSPI linear window by the PS DMA controller
+ * when the design has one
+ */
+#if defined(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR) && \
+	defined(XPAR_XDMAPS_1_DEVICE_ID)
+#define QSPI_LINEAR_DMA
+#endif
+
 /************************** Function Prototypes ******************************/
 u32 InitQspi(void);
 
@@ -112,6 +122,11 @@ u32 QspiAccess( u32 SourceAddress,
 
 u32 FlashReadID(void);
 u32 SendBankSelect(u8 BankSel);
+
+#ifdef QSPI_LINEAR_DMA
+u32 QspiLinearDmaCopy(u32 SourceAddress, u32 DestinationAddress,
+		u32 LengthBytes);
+#endif
 /************************** Variable Definitions *****************************/
 
 
@@ -43,6 +43,8 @@
  * Ver   Who  Date        Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.00  ba   11/17/14 Initial release
+ * 1.01  ms   10/19/26 Added XFsbl_StreamToPcap, which loads a bitstream
+ *                     from the boot device through two OCM buffers
  *
  * </pre>
  *
@@ -62,8 +64,17 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static void XFsbl_PcapSelectDma(void);
 
 /************************** Variable Definitions *****************************/
+#ifdef XFSBL_PL_STREAM
+/**
+ * Ping-pong buffers, one is read from the boot device while CSU DMA
+ * streams the other one to PCAP
+ */
+static u8 PlStreamBuffer[2U][XFSBL_PL_STREAM_CHUNK_SIZE]
+					__attribute__ ((aligned(64)));
+#endif
 
 /*****************************************************************************/
 /** This function does the necessary initialization of PCAP interface
@@ -153,16 +164,9 @@ static u32 XFsbl_PcapWaitForDone() {
  *
  *****************************************************************************/
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
-	u32 RegVal;
 	u32 Status = XFSBL_SUCCESS;
 
-	/*
-	 * Setup the  SSS, setup the PCAP to receive from DMA source
-	 */
-	RegVal = XFsbl_In32(CSU_CSU_SSS_CFG) & CSU_CSU_SSS_CFG_PCAP_SSS_MASK;
-	RegVal = RegVal
-			| (XFSBL_CSU_SSS_SRC_SRC_DMA << CSU_CSU_SSS_CFG_PCAP_SSS_SHIFT);
-	XFsbl_Out32(CSU_CSU_SSS_CFG, RegVal);
+	XFsbl_PcapSelectDma();
 
 	/* Setup the source DMA channel */
 	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (PTRSIZE) WrAddr, WrSize, 0);
@@ -182,6 +186,104 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 	END: return Status;
 }
 
+/*****************************************************************************/
+/** This function sets up the SSS so that PCAP receives from the CSU DMA
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_PcapSelectDma(void) {
+	u32 RegVal;
+
+	/*
+	 * Setup the  SSS, setup the PCAP to receive from DMA source
+	 */
+	RegVal = XFsbl_In32(CSU_CSU_SSS_CFG) & CSU_CSU_SSS_CFG_PCAP_SSS_MASK;
+	RegVal = RegVal
+			| (XFSBL_CSU_SSS_SRC_SRC_DMA << CSU_CSU_SSS_CFG_PCAP_SSS_SHIFT);
+	XFsbl_Out32(CSU_CSU_SSS_CFG, RegVal);
+}
+
+#ifdef XFSBL_PL_STREAM
+/*****************************************************************************/
+/** This function loads a bitstream from the boot device to PCAP without
+ *  staging it in DDR. The bitstream is read in XFSBL_PL_STREAM_CHUNK_SIZE
+ *  chunks into two OCM buffers; while CSU DMA streams one buffer to PCAP
+ *  the next chunk is read into the other one.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the bitstream offset in the boot device
+ * @param	WrSize: Number of 32bit words to be written to the PCAP
+ *          interface
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_StreamToPcap(XFsblPs * FsblInstancePtr, u32 SrcAddress, u32 WrSize)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Remaining = WrSize * XIH_PARTITION_WORD_LENGTH;
+	u32 ChunkSize;
+	u32 NextChunkSize = 0U;
+	u32 BufferIndex = 0U;
+
+	ChunkSize = Remaining;
+	if (ChunkSize > XFSBL_PL_STREAM_CHUNK_SIZE) {
+		ChunkSize = XFSBL_PL_STREAM_CHUNK_SIZE;
+	}
+
+	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+			(PTRSIZE) PlStreamBuffer[BufferIndex], ChunkSize);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	XFsbl_PcapSelectDma();
+
+	while (Remaining > 0U) {
+		/* Stream the current buffer to PCAP */
+		XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL,
+			(PTRSIZE) PlStreamBuffer[BufferIndex],
+			ChunkSize / XIH_PARTITION_WORD_LENGTH, 0);
+
+		Remaining -= ChunkSize;
+		SrcAddress += ChunkSize;
+
+		/* Read the next chunk into the other buffer meanwhile */
+		if (Remaining > 0U) {
+			NextChunkSize = Remaining;
+			if (NextChunkSize > XFSBL_PL_STREAM_CHUNK_SIZE) {
+				NextChunkSize = XFSBL_PL_STREAM_CHUNK_SIZE;
+			}
+
+			Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+				(PTRSIZE) PlStreamBuffer[BufferIndex ^ 1U],
+				NextChunkSize);
+		}
+
+		XCsuDma_WaitForDone(&CsuDma, XCSUDMA_SRC_CHANNEL);
+		XCsuDma_IntrClear(&CsuDma, XCSUDMA_SRC_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+
+		BufferIndex ^= 1U;
+		ChunkSize = NextChunkSize;
+	}
+
+	XFsbl_Printf(DEBUG_GENERAL, "DMA transfer done \r\n");
+	Status = XFsbl_PcapWaitForDone();
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This function waits for PL Done bit to be set or till timeout and resets
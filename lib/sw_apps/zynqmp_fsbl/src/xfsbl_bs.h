@@ -44,6 +44,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  ba   11/17/14 Initial release
+* 1.01  ms   10/19/26 Added XFsbl_StreamToPcap
 *
 * </pre>
 *
@@ -81,6 +82,9 @@ u32 XFsbl_BitstreamLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum, PTRSIZE Loa
 u32 XFsbl_PcapInit(void);
 u32 XFsbl_PLWaitForDone(void);
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr);
+#ifdef XFSBL_PL_STREAM
+u32 XFsbl_StreamToPcap(XFsblPs * FsblInstancePtr, u32 SrcAddress, u32 WrSize);
+#endif
 
 /************************** Variable Definitions *****************************/
 
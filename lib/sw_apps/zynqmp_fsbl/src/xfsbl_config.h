@@ -44,6 +44,11 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 Added FSBL_ECC_DMA_EXCLUDE_VAL option
+*                     Added FSBL_TRACE_EXCLUDE_VAL option and trace buffer
+*                     location
+*                     Added FSBL_PL_STREAM_EXCLUDE_VAL option and stream
+*                     chunk size
 *
 * </pre>
 *
@@ -63,6 +68,24 @@ extern "C" {
 /* This is the address in DDR where bitstream will be copied temporarily */
 #define XFSBL_DDR_TEMP_ADDRESS			(0x100000U)
 
+/**
+ * Boot stage trace buffer in OCM. When tracing is included the linker
+ * scripts place the .fsbl_trace section here and check that the FSBL
+ * does not overlap it, otherwise the region stays available to the FSBL.
+ * The buffer is kept intact for the handoff application.
+ * XFSBL_TRACE_BUDGET_US is the boot time budget compared against in the
+ * trace report, 0 disables the comparison.
+ */
+#define XFSBL_TRACE_BASE_ADDR			(0xFFFFEE00U)
+#define XFSBL_TRACE_SIZE			(0x1000U)
+#define XFSBL_TRACE_BUDGET_US			(0U)
+
+/**
+ * Size of each of the two OCM buffers used to stream a bitstream from the
+ * boot device to PCAP. Has to be a multiple of 4.
+ */
+#define XFSBL_PL_STREAM_CHUNK_SIZE		(0x4000U)
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -124,6 +147,15 @@ extern "C" {
  *     - FSBL_SHA2_EXCLUDE SHA2 code will be excluded
  *     - FSBL_EARLY_HANDOFF_EXCLUDE Early handoff related code will be excluded
  *     - FSBL_WDT_EXCLUDE WDT code will be excluded
+ *     - FSBL_ECC_DMA_EXCLUDE TCM ECC initialization is done by the CPU
+ *       instead of the ADMA/GDMA (ZDMA) write only mode
+ *     - FSBL_TRACE_EXCLUDE Boot stage tracing and the boot time report
+ *       will be excluded
+ *     - FSBL_PL_STREAM_EXCLUDE Bitstreams which are neither encrypted nor
+ *       authenticated are copied to DDR before PCAP download instead of
+ *       being streamed to PCAP through OCM buffers. Excluded by default as
+ *       streaming takes 2 * XFSBL_PL_STREAM_CHUNK_SIZE bytes of OCM .bss;
+ *       the linker script checks that the FSBL still fits
  */
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
 #define FSBL_QSPI_EXCLUDE_VAL			(0U)
@@ -134,6 +166,9 @@ extern "C" {
 #define FSBL_SHA2_EXCLUDE_VAL			(1U)
 #define FSBL_EARLY_HANDOFF_EXCLUDE_VAL	(1U)
 #define FSBL_WDT_EXCLUDE_VAL			(0U)
+#define FSBL_ECC_DMA_EXCLUDE_VAL		(0U)
+#define FSBL_TRACE_EXCLUDE_VAL			(1U)
+#define FSBL_PL_STREAM_EXCLUDE_VAL		(1U)
 
 #if FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE
@@ -171,6 +206,18 @@ extern "C" {
 #define FSBL_WDT_EXCLUDE
 #endif
 
+#if FSBL_ECC_DMA_EXCLUDE_VAL
+#define FSBL_ECC_DMA_EXCLUDE
+#endif
+
+#if FSBL_TRACE_EXCLUDE_VAL
+#define FSBL_TRACE_EXCLUDE
+#endif
+
+#if FSBL_PL_STREAM_EXCLUDE_VAL
+#define FSBL_PL_STREAM_EXCLUDE
+#endif
+
 
 /************************** Function Prototypes ******************************/
 
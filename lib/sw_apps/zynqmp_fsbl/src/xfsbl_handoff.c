@@ -43,6 +43,8 @@
  * Ver   Who  Date        Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.00  kc   10/21/13 Initial release
+ * 1.01  ms   10/19/26 Print ECC initialization time before handoff
+ *                     Added boot stage trace report
  *
  * </pre>
  *
@@ -56,6 +58,7 @@
 #include "psu_init.h"
 #include "xfsbl_main.h"
 #include "xfsbl_image_header.h"
+#include "xfsbl_trace.h"
 
 /************************** Constant Definitions *****************************/
 #define XFSBL_CPU_POWER_UP		(0x1U)
@@ -850,6 +853,8 @@ u32 XFsbl_Handoff (XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyHandoff
 	 * Put QSPI in linear mode
 	 */
 
+	XFsbl_EccInitPrintStats();
+
 	/**
 	 * FSBL hook before Handoff
 	 */
@@ -1054,6 +1059,13 @@ u32 XFsbl_Handoff (XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyHandoff
 	}
 
 
+	/**
+	 * Close the trace and print the boot time report, the trace
+	 * buffer stays in OCM for the handoff application
+	 */
+	XFsbl_TraceEnd(XFSBL_TRACE_HANDOFF, XFSBL_TRACE_NO_ID, 0U);
+	XFsbl_TraceReport();
+
 	/**
 	 * Mark Error status with Fsbl completed
 	 */
@@ -44,6 +44,8 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 Added XFSBL_ECC_DMA and XFSBL_TRACE definitions
+*                     Added XFSBL_PL_STREAM definition
 *
 * </pre>
 *
@@ -536,6 +538,14 @@ extern "C" {
 #define XFSBL_WDT_PRESENT
 #endif
 
+/**
+ * Definition for ZDMA based TCM ECC initialization to be included
+ */
+#if (!defined(FSBL_ECC_DMA_EXCLUDE) && defined(XPAR_XZDMA_0_DEVICE_ID))
+#define XFSBL_ECC_DMA
+#define XFSBL_ECC_DMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID
+#endif
+
 /**
  * Definitions for SD to be included
  */
@@ -584,6 +594,13 @@ extern "C" {
 #define XFSBL_BS
 #endif
 
+/**
+ * Definition for streaming bitstreams to PCAP to be included
+ */
+#if (defined(XFSBL_BS) && !defined(FSBL_PL_STREAM_EXCLUDE))
+#define XFSBL_PL_STREAM
+#endif
+
 
 /**
  * Definition for early handoff feature to be included
@@ -599,6 +616,13 @@ extern "C" {
 #define XFSBL_SHA2
 #endif
 
+/**
+ * Definition for boot stage tracing to be included
+ */
+#if !defined(FSBL_TRACE_EXCLUDE)
+#define XFSBL_TRACE
+#endif
+
 #define XFSBL_QSPI_LINEAR_BASE_ADDRESS_START		(0xC0000000U)
 #define XFSBL_QSPI_LINEAR_BASE_ADDRESS_END		(0xDFFFFFFFU)
 
@@ -43,6 +43,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 Added boot stage tracing
 * 2.00  sg   13/03/15 Added QSPI 32Bit bootmode
 *
 * </pre>
@@ -58,6 +59,7 @@
 #include "psu_init.h"
 #include "xfsbl_qspi.h"
 #include "xfsbl_csu_dma.h"
+#include "xfsbl_trace.h"
 
 /************************** Constant Definitions *****************************/
 #define XFSBL_R5_VECTOR_VALUE 	0xEAFEFFFEU
@@ -177,18 +179,22 @@ u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr)
 	/**
 	 * Configure the primary boot device
 	 */
+	XFsbl_TraceStart(XFSBL_TRACE_DEVICE_INIT);
 	Status = XFsbl_PrimaryBootDeviceInit(FsblInstancePtr);
 	if (XFSBL_SUCCESS != Status) {
 		goto END;
 	}
+	XFsbl_TraceEnd(XFSBL_TRACE_DEVICE_INIT, XFSBL_TRACE_NO_ID, 0U);
 
 	/**
 	 * Read and Validate the header
 	 */
+	XFsbl_TraceStart(XFSBL_TRACE_HEADER_PARSE);
 	Status = XFsbl_ValidateHeader(FsblInstancePtr);
 	if (XFSBL_SUCCESS != Status) {
 		goto END;
 	}
+	XFsbl_TraceEnd(XFSBL_TRACE_HEADER_PARSE, XFSBL_TRACE_NO_ID, 0U);
 
 	/**
 	 * Update the secondary boot device
@@ -201,10 +207,12 @@ u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr)
 	 */
 	if (FsblInstancePtr->SecondaryBootDevice !=
 			FsblInstancePtr->PrimaryBootDevice) {
+		XFsbl_TraceStart(XFSBL_TRACE_DEVICE_INIT);
 		Status = XFsbl_SecondaryBootDeviceInit(FsblInstancePtr);
 		if (XFSBL_SUCCESS != Status) {
 			goto END;
 		}
+		XFsbl_TraceEnd(XFSBL_TRACE_DEVICE_INIT, XFSBL_TRACE_NO_ID, 0U);
 	}
 
 END:
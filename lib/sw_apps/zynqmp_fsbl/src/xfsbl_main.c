@@ -43,6 +43,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 Added boot stage tracing
 *
 * </pre>
 *
@@ -53,6 +54,7 @@
 /***************************** Include Files *********************************/
 #include "xfsbl_hw.h"
 #include "xfsbl_main.h"
+#include "xfsbl_trace.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -87,6 +89,7 @@ int main(void )
 	 * Initialize globals.
 	 */
 	FsblInstancePtr.ErrorCode = FsblStatus;
+	XFsbl_TraceInit();
 
 	while (1) {
 
@@ -100,6 +103,7 @@ int main(void )
 				 */
 				XFsbl_CfgInitialize(&FsblInstancePtr);
 
+				XFsbl_TraceStart(XFSBL_TRACE_PS_INIT);
 				FsblStatus = XFsbl_Initialize(&FsblInstancePtr);
 				if (XFSBL_SUCCESS != FsblStatus)
 				{
@@ -107,11 +111,8 @@ int main(void )
 					FsblStage = XFSBL_STAGE_ERR;
 				} else {
 
-					/**
-					 *
-					 * Include the code for FSBL time measurements
-					 * Initialize the global timer and get the value
-					 */
+					XFsbl_TraceEnd(XFSBL_TRACE_PS_INIT,
+							XFSBL_TRACE_NO_ID, 0U);
 
 					FsblStage = XFSBL_STAGE2;
 				}
@@ -227,6 +228,7 @@ int main(void )
 				 * xip
 				 * ps7 post config
 				 */
+				XFsbl_TraceStart(XFSBL_TRACE_HANDOFF);
 				FsblStatus = XFsbl_Handoff(&FsblInstancePtr, PartitionNum, EarlyHandoff);
 
 				if (XFSBL_STATUS_CONTINUE_PARTITION_LOAD == FsblStatus) {
@@ -43,6 +43,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 Added XFsbl_EccInitPrintStats
 *
 * </pre>
 *
@@ -154,6 +155,7 @@ u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr);
  * Functions defined in xfsbl_partition_load.c
  */
 u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum);
+void XFsbl_EccInitPrintStats(void);
 
 /**
  * Functions defined in xfsbl_handoff.c
@@ -43,6 +43,12 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 1.01  ms   10/19/26 TCM ECC initialization is done with the ZDMA in write
+*                     only mode. Added ECC initialization timing.
+*                     Added boot stage tracing of copy, authentication,
+*                     decryption and PL configuration
+*                     Bitstreams that are neither encrypted nor authenticated
+*                     are streamed from the boot device to PCAP
 *
 * </pre>
 *
@@ -58,6 +64,11 @@
 #include "xfsbl_hooks.h"
 #include "xfsbl_authentication.h"
 #include "xfsbl_bs.h"
+#include "xfsbl_trace.h"
+#include "xtime_l.h"
+#ifdef XFSBL_ECC_DMA
+#include "xzdma.h"
+#endif
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -72,6 +83,12 @@
 #define XFSBL_R5_1_TCM		(0x2U)
 #define XFSBL_R5_L_TCM		(0x3U)
 
+/**
+ * Pattern written for ECC initialization. GDMA takes four words and
+ * ADMA takes two words of write only data.
+ */
+#define XFSBL_ECC_INIT_PATTERN	(0x1U)
+
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
 		u32 PartitionNum);
@@ -82,16 +99,28 @@ static u32 XFsbl_CheckHandoffCpu (XFsblPs * FsblInstancePtr,
 		u32 DestinationCpu);
 static u32 XFsbl_ConfigureMemory(u32 RunningCpu, u32 DestinationCpu,
 		u64 Address, u32 Length);
-void XFsbl_EccInitialize(u32 Address, u32 Length);
+static u32 XFsbl_EccInitialize(u32 Address, u32 Length);
+#ifdef XFSBL_ECC_DMA
+static u32 XFsbl_EccDmaWait(void);
+#endif
 u32 XFsbl_GetLoadAddress(u32 DestinationCpu, PTRSIZE * LoadAddressPtr,
 		u32 Length);
 static void XFsbl_CheckPmuFw(XFsblPs * FsblInstancePtr, u32 PartitionNum);
+#ifdef XFSBL_PL_STREAM
+static u32 XFsbl_IsPlStreamed(XFsblPs_PartitionHeader * PartitionHeader);
+#endif
 
 /************************** Variable Definitions *****************************/
 static int IsR50TcmEccInitialized = FALSE;
 static int IsR51TcmEccInitialized = FALSE;
 static int IsR5LTcmEccInitialized = FALSE;
 
+#ifdef XFSBL_ECC_DMA
+static XZDma EccZDma;
+#endif
+static u64 EccInitTotalTime = 0U;
+static u32 EccInitTotalLength = 0U;
+
 u8 TcmVectorArray[32];
 u32 TcmSkipLength=0U;
 PTRSIZE TcmSkipAddress=0U;
@@ -493,24 +522,219 @@ END:
 	return Status;
 }
 
-void XFsbl_EccInitialize(u32 Address, u32 Length)
+#ifdef XFSBL_ECC_DMA
+/*****************************************************************************/
+/**
+ * This function initializes the ZDMA channel used for ECC initialization
+ * in simple write only mode. It is done only once.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_ERROR_ECC_DMA_INIT on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccDmaInit(void)
 {
+	u32 Status = XFSBL_SUCCESS;
+	XZDma_Config *ZDmaConfig;
+	XZDma_DataConfig DataConfig = {0U};
+
+	if (EccZDma.IsReady == XIL_COMPONENT_IS_READY) {
+		goto END;
+	}
+
+	ZDmaConfig = XZDma_LookupConfig(XFSBL_ECC_DMA_DEVICE_ID);
+	if (NULL == ZDmaConfig) {
+		Status = XFSBL_ERROR_ECC_DMA_INIT;
+		goto END;
+	}
+
+	if (XZDma_CfgInitialize(&EccZDma, ZDmaConfig,
+			ZDmaConfig->BaseAddress) != XST_SUCCESS) {
+		Status = XFSBL_ERROR_ECC_DMA_INIT;
+		goto END;
+	}
+
+	if (XZDma_SetMode(&EccZDma, FALSE, XZDMA_WRONLY_MODE) != XST_SUCCESS) {
+		Status = XFSBL_ERROR_ECC_DMA_INIT;
+		goto END;
+	}
+
+	/**
+	 * Longest INCR bursts and maximum outstanding transactions,
+	 * the source side is unused in write only mode
+	 */
+	DataConfig.OverFetch = 0U;
+	DataConfig.SrcIssue = 0x1FU;
+	DataConfig.SrcBurstType = XZDMA_INCR_BURST;
+	DataConfig.SrcBurstLen = 0xFU;
+	DataConfig.DstBurstType = XZDMA_INCR_BURST;
+	DataConfig.DstBurstLen = 0xFU;
+	if (XZDma_SetChDataConfig(&EccZDma, &DataConfig) != XST_SUCCESS) {
+		Status = XFSBL_ERROR_ECC_DMA_INIT;
+		goto END;
+	}
+
+	/**
+	 * Completion is polled, no interrupts are used
+	 */
+	XZDma_DisableIntr(&EccZDma, XZDMA_IXR_ALL_INTR_MASK);
+
+END:
+	if (Status != XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ECC_DMA_INIT\n\r");
+	}
+	return Status;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function does the ECC initialization of the memory region.
+ * With XFSBL_ECC_DMA the region is filled by the ZDMA in write only mode,
+ * otherwise it is written by the CPU with the data cache disabled.
+ * The time from the start of the fill to its completion is accounted.
+ *
+ * @param	Address is the start address of the region
+ *
+ * @param	Length is the length of the region in bytes
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccInitialize(u32 Address, u32 Length)
+{
+	u32 Status = XFSBL_SUCCESS;
+	XTime StartTime;
+	XTime EndTime;
+#ifdef XFSBL_ECC_DMA
+	u32 Pattern[4] = {XFSBL_ECC_INIT_PATTERN, XFSBL_ECC_INIT_PATTERN,
+			XFSBL_ECC_INIT_PATTERN, XFSBL_ECC_INIT_PATTERN};
+	XZDma_Transfer Transfer;
+#else
 	u32 Index=0U;
+#endif
+
+#ifdef XFSBL_ECC_DMA
+	Status = XFsbl_EccDmaInit();
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	Transfer.SrcAddr = 0U;
+	Transfer.DstAddr = (UINTPTR)Address;
+	Transfer.Size = Length;
+	Transfer.SrcCoherent = 0U;
+	Transfer.DstCoherent = 0U;
+	Transfer.Pause = 0U;
+
+	XZDma_IntrClear(&EccZDma, XZDMA_IXR_ALL_INTR_MASK);
+	XZDma_WOData(&EccZDma, Pattern);
+	XTime_GetTime(&StartTime);
+	if (XZDma_Start(&EccZDma, &Transfer, 1U) != XST_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ECC_DMA_FAIL\n\r");
+		Status = XFSBL_ERROR_ECC_DMA_FAIL;
+		goto END;
+	}
+	Status = XFsbl_EccDmaWait();
+	XTime_GetTime(&EndTime);
+
+	/**
+	 * Drop any stale cache lines of the region filled behind the CPU
+	 */
+	Xil_DCacheInvalidateRange((INTPTR)Address, Length);
 
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+#else
+	XTime_GetTime(&StartTime);
 	/* Disable cache to ensure proper ECC initialization */
 	Xil_DCacheDisable();
 	while (Index<Length)
 	{
-		XFsbl_Out32(Address+Index, 1U) ;
+		XFsbl_Out32(Address+Index, XFSBL_ECC_INIT_PATTERN) ;
 		Index += 4U;
 	}
 	Xil_DCacheEnable();
+	XTime_GetTime(&EndTime);
+#endif
+
+	EccInitTotalTime += EndTime - StartTime;
+	EccInitTotalLength += Length;
 
 	XFsbl_Printf(DEBUG_INFO,
-	  "Address 0x%0lx, Length %0lx, ECC initialized \r\n",
-		Address, Length);
+	  "Address 0x%0lx, Length %0lx, ECC initialized in %0lu us \r\n",
+		Address, Length,
+		(u32)(((u64)(EndTime - StartTime) * 1000000U) /
+				COUNTS_PER_SECOND));
+
+#ifdef XFSBL_ECC_DMA
+END:
+#endif
+	return Status;
+}
+
+#ifdef XFSBL_ECC_DMA
+/*****************************************************************************/
+/**
+ * This function polls the ZDMA channel until the ECC initialization fill
+ * completes.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_ERROR_ECC_DMA_FAIL if the ZDMA reported an error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccDmaWait(void)
+{
+	u32 Status = XFSBL_SUCCESS;
+
+	while (XZDma_ChannelState(&EccZDma) == XZDMA_BUSY) {
+		/* Wait for the fill to complete */
+	}
+
+	if ((XZDma_IntrGetStatus(&EccZDma) & XZDMA_IXR_ERR_MASK) != 0U) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ECC_DMA_FAIL\n\r");
+		Status = XFSBL_ERROR_ECC_DMA_FAIL;
+	}
+	XZDma_IntrClear(&EccZDma, XZDMA_IXR_ALL_INTR_MASK);
+
+	/**
+	 * The driver keeps the channel busy until its interrupt handler
+	 * runs, which is not used here
+	 */
+	EccZDma.ChannelState = XZDMA_IDLE;
 
-	return ;
+	return Status;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function prints the total time spent in ECC initialization
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_EccInitPrintStats(void)
+{
+	if (EccInitTotalLength != 0U) {
+		XFsbl_Printf(DEBUG_GENERAL,
+		  "ECC initialization: %0lu bytes in %0lu us (%s)\r\n",
+			EccInitTotalLength,
+			(u32)(((u64)EccInitTotalTime * 1000000U) / COUNTS_PER_SECOND),
+#ifdef XFSBL_ECC_DMA
+			"ZDMA");
+#else
+			"CPU");
+#endif
+	}
 }
 
 
@@ -649,8 +873,11 @@ static u32 XFsbl_ConfigureMemory(u32 RunningCpu, u32 DestinationCpu,
 		 */
 		if (IsR50TcmEccInitialized == FALSE)
 		{
-			XFsbl_EccInitialize(XFSBL_R50_HIGH_TCM_START_ADDRESS,
+			Status = XFsbl_EccInitialize(XFSBL_R50_HIGH_TCM_START_ADDRESS,
 				XFSBL_R5_TCM_LENGTH);
+			if (Status != XFSBL_SUCCESS) {
+				goto END;
+			}
 		}
 		IsR50TcmEccInitialized = TRUE;
 
@@ -679,8 +906,11 @@ static u32 XFsbl_ConfigureMemory(u32 RunningCpu, u32 DestinationCpu,
 		 */
 		if (IsR51TcmEccInitialized == FALSE)
 		{
-			XFsbl_EccInitialize(XFSBL_R51_HIGH_TCM_START_ADDRESS,
+			Status = XFsbl_EccInitialize(XFSBL_R51_HIGH_TCM_START_ADDRESS,
 					XFSBL_R5_TCM_LENGTH);
+			if (Status != XFSBL_SUCCESS) {
+				goto END;
+			}
 		}
 		IsR51TcmEccInitialized = TRUE;
 	} else
@@ -709,8 +939,11 @@ static u32 XFsbl_ConfigureMemory(u32 RunningCpu, u32 DestinationCpu,
 		 */
 		if (IsR5LTcmEccInitialized == FALSE)
 		{
-			XFsbl_EccInitialize(XFSBL_R50_HIGH_TCM_START_ADDRESS,
+			Status = XFsbl_EccInitialize(XFSBL_R50_HIGH_TCM_START_ADDRESS,
 					XFSBL_R5_TCM_LENGTH*2U);
+			if (Status != XFSBL_SUCCESS) {
+				goto END;
+			}
 		}
 		IsR5LTcmEccInitialized = TRUE;
 	} else
@@ -820,6 +1053,18 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		{
 			LoadAddress = XFSBL_DDR_TEMP_ADDRESS;
 		}
+
+#ifdef XFSBL_PL_STREAM
+		/**
+		 * Streamed bitstreams are read from the boot device
+		 * during the PCAP download, nothing to copy here
+		 */
+		if (XFsbl_IsPlStreamed(PartitionHeader) == TRUE)
+		{
+			Status = XFSBL_SUCCESS;
+			goto END;
+		}
+#endif
 #else
 		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_PL_NOT_ENABLED \r\n");
 		Status = XFSBL_ERROR_PL_NOT_ENABLED;
@@ -855,8 +1100,12 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	/**
 	 * Configure the memory
 	 */
-	XFsbl_ConfigureMemory(RunningCpu, DestinationCpu,
+	Status = XFsbl_ConfigureMemory(RunningCpu, DestinationCpu,
 						LoadAddress, Length);
+	if (XFSBL_SUCCESS != Status)
+	{
+		goto END;
+	}
 
 	/**
 	 *
@@ -925,12 +1174,14 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	/**
 	 * Copy the partition to PS_DDR/PL_DDR/TCM
 	 */
+	XFsbl_TraceStart(XFSBL_TRACE_PARTITION_COPY);
 	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
 					LoadAddress, Length);
 	if (XFSBL_SUCCESS != Status)
 	{
 		goto END;
 	}
+	XFsbl_TraceEnd(XFSBL_TRACE_PARTITION_COPY, PartitionNum, Length);
 
 END:
 	return Status;
@@ -1100,6 +1351,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 		/**
 		 * Do the authentication validation
 		 */
+		XFsbl_TraceStart(XFSBL_TRACE_AUTHENTICATION);
 		Status = XFsbl_Authentication(FsblInstancePtr, LoadAddress, Length,
 			(LoadAddress + Length) - XFSBL_AUTH_CERT_MIN_SIZE,
 			HashLen);
@@ -1108,6 +1360,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
                 {
                         goto END;
                 }
+		XFsbl_TraceEnd(XFSBL_TRACE_AUTHENTICATION, PartitionNum, Length);
 #else
 		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_RSA_NOT_ENABLED \r\n");
 		Status = XFSBL_ERROR_RSA_NOT_ENABLED;
@@ -1137,6 +1390,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 
 
 		if (DestinationDevice != XIH_PH_ATTRB_DEST_DEVICE_PL) {
+			XFsbl_TraceStart(XFSBL_TRACE_DECRYPTION);
 			Status = XSecure_AesDecrypt(&SecureAes, (u8 *) LoadAddress,
 					(u8 *) LoadAddress, UnencryptedLength);
 
@@ -1145,6 +1399,8 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 				XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DECRYPTION_FAIL\r\n");
 				goto END;
 			} else {
+				XFsbl_TraceEnd(XFSBL_TRACE_DECRYPTION, PartitionNum,
+						UnencryptedLength);
 				XFsbl_Printf(DEBUG_GENERAL, "Decryption Successful\r\n");
 			}
 		}
@@ -1175,6 +1431,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 
 		XFsbl_Printf(DEBUG_GENERAL, "Bitstream download to start now\r\n");
 
+		XFsbl_TraceStart(XFSBL_TRACE_PL_CONFIG);
 		Status = XFsbl_PcapInit();
 		if (Status != XFSBL_SUCCESS) {
 			goto END;
@@ -1209,8 +1466,22 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			/* Use CSU DMA to load Bit stream to PL */
 			BitstreamWordSize = PartitionHeader->UnEncryptedDataWordLength;
 
-			Status = XFsbl_WriteToPcap(BitstreamWordSize, (u8 *) LoadAddress);
+#ifdef XFSBL_PL_STREAM
+			if (XFsbl_IsPlStreamed(PartitionHeader) == TRUE) {
+				Status = XFsbl_StreamToPcap(FsblInstancePtr,
+					FsblInstancePtr->ImageOffsetAddress +
+					(PartitionHeader->DataWordOffset *
+						XIH_PARTITION_WORD_LENGTH),
+					BitstreamWordSize);
+			} else
+#endif
+			{
+				Status = XFsbl_WriteToPcap(BitstreamWordSize,
+						(u8 *) LoadAddress);
+			}
 			if (Status != XFSBL_SUCCESS) {
+				/* Reset PL */
+				XFsbl_Out32(CSU_PCAP_PROG, 0x0);
 				goto END;
 			}
 		}
@@ -1219,6 +1490,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 		if (Status != XFSBL_SUCCESS) {
 			goto END;
 		}
+		XFsbl_TraceEnd(XFSBL_TRACE_PL_CONFIG, PartitionNum,
+				PartitionHeader->UnEncryptedDataWordLength *
+				XIH_PARTITION_WORD_LENGTH);
 
 		/**
 		 * Fsbl hook after bit stream download
@@ -1311,3 +1585,36 @@ static void XFsbl_CheckPmuFw(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	}
 
 }
+
+#ifdef XFSBL_PL_STREAM
+/*****************************************************************************/
+/**
+ * This function checks if a partition is a bitstream that can be streamed
+ * from the boot device to PCAP. Encrypted and authenticated bitstreams are
+ * staged in memory as the whole partition has to be present before it is
+ * decrypted or sent to the PL.
+ *
+ * @param	PartitionHeader is pointer to the partition header
+ *
+ * @return	TRUE if the bitstream is streamed, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_IsPlStreamed(XFsblPs_PartitionHeader * PartitionHeader)
+{
+	u32 Status = FALSE;
+
+	if ((XFsbl_GetDestinationDevice(PartitionHeader) ==
+			XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		(XFsbl_IsEncrypted(PartitionHeader) !=
+			XIH_PH_ATTRB_ENCRYPTION) &&
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) !=
+			XIH_PH_ATTRB_RSA_SIGNATURE) &&
+		(XFsbl_GetChecksumType(PartitionHeader) ==
+			XIH_PH_ATTRB_NOCHECKSUM))
+	{
+		Status = TRUE;
+	}
+
+	return Status;
+}
+#endif
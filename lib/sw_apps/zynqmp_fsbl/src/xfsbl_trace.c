@@ -0,0 +1,185 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_trace.c
+ *
+ * Contains the boot stage tracing. Each traced stage is timed with the XTime
+ * counter and written as one entry to the trace buffer, and a boot time
+ * budget report is printed from it before handoff. The buffer is left in
+ * OCM so that the handoff application can read it.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  ms   10/19/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xtime_l.h"
+#include "xfsbl_trace.h"
+
+#ifdef XFSBL_TRACE
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define TraceBuf	((XilStageTrace *)(void *)TraceMem)
+
+/************************** Function Prototypes ******************************/
+static u64 XFsbl_TraceGetTime(void);
+
+/************************** Variable Definitions *****************************/
+/**
+ * Trace buffer, placed at XFSBL_TRACE_BASE_ADDR by the linker scripts.
+ * The section only exists in builds with tracing.
+ */
+static u64 TraceMem[XFSBL_TRACE_SIZE / sizeof(u64)]
+		__attribute__((section(".fsbl_trace")));
+
+static u64 TraceStartTime[XFSBL_TRACE_MAX_EVENT];
+
+static const char * const TraceEventName[XFSBL_TRACE_MAX_EVENT] = {
+	"",
+	"PS init",
+	"Device init",
+	"Header parse",
+	"Partition copy",
+	"Authentication",
+	"Decryption",
+	"PL config",
+	"Handoff",
+	"Checksum",
+};
+
+/*****************************************************************************/
+/**
+ * This function reads the XTime counter
+ *
+ * @param	None
+ *
+ * @return	Counter value
+ *
+ *****************************************************************************/
+static u64 XFsbl_TraceGetTime(void)
+{
+	XTime Time;
+
+	XTime_GetTime(&Time);
+
+	return (u64)Time;
+}
+
+/*****************************************************************************/
+/**
+ * This function initializes the trace buffer header and discards any
+ * entries from an earlier boot
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_TraceInit(void)
+{
+	u32 Index;
+
+	Xil_StageTraceInit(TraceBuf, XFSBL_TRACE_SIZE, COUNTS_PER_SECOND);
+
+	for (Index = 0U; Index < XFSBL_TRACE_MAX_EVENT; Index++) {
+		TraceStartTime[Index] = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function marks the start of a boot stage
+ *
+ * @param	Event is one of the XFSBL_TRACE_* stages
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_TraceStart(u32 Event)
+{
+	if (Event < XFSBL_TRACE_MAX_EVENT) {
+		TraceStartTime[Event] = XFsbl_TraceGetTime();
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function marks the end of a boot stage started with
+ * XFsbl_TraceStart() and writes its entry to the trace buffer
+ *
+ * @param	Event is one of the XFSBL_TRACE_* stages
+ *
+ * @param	Id is the partition number or XFSBL_TRACE_NO_ID
+ *
+ * @param	Bytes is the number of bytes processed in the stage
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_TraceEnd(u32 Event, u32 Id, u32 Bytes)
+{
+	if (Event < XFSBL_TRACE_MAX_EVENT) {
+		Xil_StageTraceAdd(TraceBuf, Event, Id, TraceStartTime[Event],
+				XFsbl_TraceGetTime(), Bytes);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the boot time report and leaves the trace buffer
+ * in OCM for the handoff application
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_TraceReport(void)
+{
+	Xil_StageTraceReport(TraceBuf, TraceEventName, XFSBL_TRACE_MAX_EVENT,
+			XFSBL_TRACE_BUDGET_US);
+}
+#endif /* XFSBL_TRACE */
@@ -0,0 +1,104 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_trace.h
+*
+* Contains the boot stage numbers and the trace functions. The trace
+* format and the report come from xil_stagetrace.h of the BSP. The trace
+* buffer is placed in the .fsbl_trace section, which the linker scripts put
+* at XFSBL_TRACE_BASE_ADDR so that it can be read after handoff.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ms   10/19/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XFSBL_TRACE_H
+#define XFSBL_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xil_stagetrace.h"
+
+/**************************** Macros Definitions *****************************/
+/**
+ * Traced boot stages, the numbering is shared with the Zynq FSBL trace
+ */
+#define XFSBL_TRACE_PS_INIT		(0x1U)
+#define XFSBL_TRACE_DEVICE_INIT		(0x2U)
+#define XFSBL_TRACE_HEADER_PARSE	(0x3U)
+#define XFSBL_TRACE_PARTITION_COPY	(0x4U)
+#define XFSBL_TRACE_AUTHENTICATION	(0x5U)
+#define XFSBL_TRACE_DECRYPTION		(0x6U)
+#define XFSBL_TRACE_PL_CONFIG		(0x7U)
+#define XFSBL_TRACE_HANDOFF		(0x8U)
+#define XFSBL_TRACE_CHECKSUM		(0x9U)
+#define XFSBL_TRACE_MAX_EVENT		(0xAU)
+
+/**
+ * Id used for the stages which are not partition specific
+ */
+#define XFSBL_TRACE_NO_ID		XIL_STAGETRACE_NO_ID
+
+/************************** Function Prototypes ******************************/
+#ifdef XFSBL_TRACE
+void XFsbl_TraceInit(void);
+void XFsbl_TraceStart(u32 Event);
+void XFsbl_TraceEnd(u32 Event, u32 Id, u32 Bytes);
+void XFsbl_TraceReport(void);
+#else
+#define XFsbl_TraceInit()
+#define XFsbl_TraceStart(Event)
+#define XFsbl_TraceEnd(Event, Id, Bytes)
+#define XFsbl_TraceReport()
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_TRACE_H */
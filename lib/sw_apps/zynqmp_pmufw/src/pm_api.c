@@ -101,6 +101,12 @@ static const PmApiEntry pmApiTable[] = {
 	}, {
 		.apiId = PM_MMIO_READ,
 		.argTypes = { ARG_UINT32, ARG_UINT32, ARG_UNDEF, ARG_UNDEF }
+	}, {
+		.apiId = PM_BATCH,
+		.argTypes = { ARG_UINT32, ARG_UINT32, ARG_UINT32, ARG_UNDEF }
+	}, {
+		.apiId = PM_SET_STATUS_PAGE,
+		.argTypes = { ARG_UINT32, ARG_UNDEF, ARG_UNDEF, ARG_UNDEF }
 	},
 };
 
@@ -39,6 +39,7 @@
 #include "pm_common.h"
 #include "pm_proc.h"
 #include "pm_core.h"
+#include "pm_status.h"
 #include "ipi_buffer.h"
 
 /**
@@ -52,6 +53,12 @@
 void XPfw_PmInit(void)
 {
 	PmDbg("Power Management Init\n");
+	/* Build requirements lookup data before any request is received */
+	PmMasterInit();
+	/* Time stamps are used for the status page and latency statistics */
+	XPfw_UtilTimeStampInit();
+	/* Status pages are built from these states, later kept by the nodes */
+	PmStatusInit();
 	/* Disable all wake requests in GPI1 */
 	DISABLE_WAKE(PMU_IOMODULE_GPI1_WAKES_ALL_MASK);
 	/* Disable all wfi requests in GPI2 */
@@ -156,6 +163,7 @@ int XPfw_PmWfiHandler(const u32 srcMask)
 		 */
 		PmOpportunisticSuspend(proc->node.parent);
 	}
+	PmStatusPublish();
 
 done:
 	return status;
@@ -197,6 +205,7 @@ int XPfw_PmWakeHandler(const u32 srcMask)
 		/* Slave wake */
 		status = PmSlaveProcessWake(srcMask);
 	}
+	PmStatusPublish();
 
 	return status;
 }
@@ -240,3 +249,16 @@ XPfw_PmIpiStatus XPfw_PmCheckIpiRequest(const u32 isrVal,
 done:
 	return status;
 }
+
+#ifdef ENABLE_PM_LATENCY
+/**
+ * XPfw_PmPrintLatency() - Print processing time statistics of PM API calls
+ *
+ * @note    Processing time is measured from the moment payload is validated
+ *          until the call is processed, so it does not include IPI handling.
+ */
+void XPfw_PmPrintLatency(void)
+{
+	PmPrintLatency();
+}
+#endif
@@ -66,4 +66,7 @@ int XPfw_PmWfiHandler(const u32 srcMask);
 /* Call from GPI1 interrupt routine to handle wake request */
 int XPfw_PmWakeHandler(const u32 srcMask);
 
+/* Print processing time statistics of PM API calls (ENABLE_PM_LATENCY) */
+void XPfw_PmPrintLatency(void);
+
 #endif
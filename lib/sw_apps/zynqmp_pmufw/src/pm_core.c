@@ -39,8 +39,25 @@
 #include "pm_defs.h"
 #include "pm_common.h"
 #include "pm_callbacks.h"
+#include "pm_status.h"
 #include "ipi_buffer.h"
 
+#ifdef ENABLE_PM_LATENCY
+/**
+ * PmLatency - Processing time of PM API calls with the same api id
+ * @count   Number of processed calls
+ * @total   Sum of processing times, in time stamp counts
+ * @max     Longest processing time, in time stamp counts
+ */
+typedef struct {
+	u32 count;
+	u32 total;
+	u32 max;
+} PmLatency;
+
+static PmLatency pmLatency[PM_API_MAX + 1U];
+#endif
+
 /**
  * PmProcessAckRequest() -Returns appropriate acknowledge if required
  * @ack     Ack argument as requested by the master
@@ -331,7 +348,7 @@ static void PmReleaseNode(const PmMaster *master,
 
 	/* Release requirements */
 	status = PmRequirementUpdate(masterReq, 0U);
-	masterReq->info &= ~PM_MASTER_USING_SLAVE_MASK;
+	PmRequirementSetUsage(masterReq, false);
 
 	if (XST_SUCCESS != status) {
 		PmDbg("ERROR PmRequirementUpdate status = %d\n", status);
@@ -388,7 +405,7 @@ static void PmRequestNode(const PmMaster *master,
 	}
 
 	/* Set requested capabilities if they are valid */
-	masterReq->info |= PM_MASTER_USING_SLAVE_MASK;
+	PmRequirementSetUsage(masterReq, true);
 	status = PmRequirementUpdate(masterReq, capabilities);
 
 done:
@@ -666,6 +683,103 @@ static void PmResetGetStatus(const PmMaster *const master, const u32 reset)
 	PmDbg("(%d) not implemented\n", reset);
 }
 
+/**
+ * PmBatch() - Execute a list of PM API calls received in one request
+ * @master  Initiator of the request
+ * @address Address of the first call entry
+ * @count   Number of call entries
+ * @flags   PM_BATCH_STOP_ON_ERROR to skip the calls following a failed one
+ *
+ * @note    Each entry (PM_BATCH_ENTRY_SIZE bytes) holds an api id and its
+ *          arguments. Every call is checked and processed as if it was
+ *          received through IPI, and its status and return value are written
+ *          back into the entry. Calls which acknowledge through a callback
+ *          are rejected, because the callback would overwrite the response
+ *          the master is waiting for. The response holds the status of the
+ *          first failed call (or success) and the number of processed calls.
+ */
+static void PmBatch(const PmMaster *const master, const u32 address,
+		    const u32 count, const u32 flags)
+{
+	u32 i, j, ack;
+	u32 pload[PAYLOAD_ELEM_CNT];
+	u32 entry = address;
+	u32 callStatus;
+	u32 processed = 0U;
+	u32 status = XST_SUCCESS;
+
+	PmDbg("(0x%x, %d, 0x%x)\n", address, count, flags);
+
+	if ((0U != (address & (PM_BATCH_ENTRY_SIZE - 1U))) || (0U == count) ||
+	    (count > PM_BATCH_MAX_CALLS)) {
+		status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	for (i = 0U; i < count; i++) {
+		for (j = 0U; j < PAYLOAD_ELEM_CNT; j++) {
+			pload[j] = XPfw_Read32(entry + (j * PAYLOAD_ELEM_SIZE));
+		}
+
+		/* Outcome of the calls which do not write a response */
+		XPfw_Write32(master->buffer + IPI_BUFFER_RESP_OFFSET, XST_SUCCESS);
+		XPfw_Write32(master->buffer + IPI_BUFFER_RESP_OFFSET +
+			     PAYLOAD_ELEM_SIZE, 0U);
+
+		ack = PmRequestAcknowledge(pload);
+		if ((PM_BATCH == pload[0]) ||
+		    (PM_PAYLOAD_OK != PmCheckPayload(pload)) ||
+		    (REQUEST_ACK_CB_STANDARD == ack)) {
+			callStatus = XST_INVALID_PARAM;
+		} else {
+			PmProcessApiCall(master, pload);
+			callStatus = XPfw_Read32(master->buffer +
+						 IPI_BUFFER_RESP_OFFSET);
+		}
+
+		XPfw_Write32(entry + PM_BATCH_STATUS_OFFSET, callStatus);
+		XPfw_Write32(entry + PM_BATCH_VALUE_OFFSET,
+			     XPfw_Read32(master->buffer + IPI_BUFFER_RESP_OFFSET +
+					 PAYLOAD_ELEM_SIZE));
+		entry += PM_BATCH_ENTRY_SIZE;
+		processed++;
+
+		if (XST_SUCCESS != callStatus) {
+			PmDbg("call #%d (api %d) failed - code %d\n", i, pload[0],
+			      callStatus);
+			if (XST_SUCCESS == status) {
+				status = callStatus;
+			}
+			if (0U != (flags & PM_BATCH_STOP_ON_ERROR)) {
+				break;
+			}
+		}
+	}
+
+done:
+	XPfw_Write32(master->buffer + IPI_BUFFER_RESP_OFFSET, status);
+	XPfw_Write32(master->buffer + IPI_BUFFER_RESP_OFFSET + PAYLOAD_ELEM_SIZE,
+		     processed);
+}
+
+/**
+ * PmSetStatusPage() - Register a page into which the PMU publishes status
+ * @master  Master who registers the page
+ * @address Address of the page (PM_STATUS_PAGE_SIZE bytes), 0 to unregister
+ *
+ * @note    Once registered, the master can read node states and its own
+ *          suspend/resume time stamps from the page without an IPI.
+ */
+static void PmSetStatusPage(const PmMaster *const master, const u32 address)
+{
+	int status;
+
+	PmDbg("(0x%x)\n", address);
+
+	status = PmStatusSetPage(master, address);
+	XPfw_Write32(master->buffer + IPI_BUFFER_RESP_OFFSET, status);
+}
+
 /**
  * PmProcessApiCall() - Called to process PM API call
  * @master  Pointer to a requesting master structure
@@ -738,6 +852,12 @@ void PmProcessApiCall(const PmMaster *const master,
 	case PM_MMIO_READ:
 		PmMmioRead(master, pload[1], pload[2]);
 		break;
+	case PM_BATCH:
+		PmBatch(master, pload[1], pload[2], pload[3]);
+		break;
+	case PM_SET_STATUS_PAGE:
+		PmSetStatusPage(master, pload[1]);
+		break;
 	default:
 		PmDbg("ERROR unsupported PM API #%d\n", pload[0]);
 		PmProcessAckRequest(PmRequestAcknowledge(pload), master,
@@ -761,7 +881,21 @@ void PmProcessRequest(const PmMaster *const master,
 	PmPayloadStatus status = PmCheckPayload(pload);
 
 	if (PM_PAYLOAD_OK == status) {
+#ifdef ENABLE_PM_LATENCY
+		u32 start = XPfw_UtilTimeStamp();
+		u32 time;
+
 		PmProcessApiCall(master, pload);
+
+		time = XPfw_UtilTimeStamp() - start;
+		pmLatency[pload[0]].count++;
+		pmLatency[pload[0]].total += time;
+		if (time > pmLatency[pload[0]].max) {
+			pmLatency[pload[0]].max = time;
+		}
+#else
+		PmProcessApiCall(master, pload);
+#endif
 	} else {
 		PmDbg("ERROR invalid payload, status #%d\n", status);
 		/* Acknowledge if possible */
@@ -775,4 +909,27 @@ void PmProcessRequest(const PmMaster *const master,
 			}
 		}
 	}
+
+	PmStatusPublish();
+}
+
+#ifdef ENABLE_PM_LATENCY
+/**
+ * PmPrintLatency() - Print processing time of each PM API call received so far
+ */
+void PmPrintLatency(void)
+{
+	u32 api;
+
+	fw_printf("PM API latency (us): api count avg max\r\n");
+	for (api = PM_API_MIN; api <= PM_API_MAX; api++) {
+		if (0U == pmLatency[api].count) {
+			continue;
+		}
+		fw_printf("%d %d %d %d\r\n", api, pmLatency[api].count,
+			  pmLatency[api].total / (pmLatency[api].count *
+						  XPFW_UTIL_TIMESTAMP_PER_US),
+			  pmLatency[api].max / XPFW_UTIL_TIMESTAMP_PER_US);
+	}
 }
+#endif
@@ -49,4 +49,11 @@
 void PmProcessRequest(const PmMaster *const master,
 		      const u32 payload[PAYLOAD_ELEM_CNT]);
 
+void PmProcessApiCall(const PmMaster *const master,
+		      const u32 pload[PAYLOAD_ELEM_CNT]);
+
+#ifdef ENABLE_PM_LATENCY
+void PmPrintLatency(void);
+#endif
+
 #endif
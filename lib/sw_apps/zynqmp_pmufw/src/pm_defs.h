@@ -89,8 +89,41 @@
 #define PM_MMIO_WRITE               19U
 #define PM_MMIO_READ                20U
 
+#define PM_BATCH                    21U
+#define PM_SET_STATUS_PAGE          22U
+
 #define PM_API_MIN	PM_GET_API_VERSION
-#define PM_API_MAX	PM_MMIO_READ
+#define PM_API_MAX	PM_SET_STATUS_PAGE
+
+/*
+ * PM_BATCH call entry layout: api id and 4 arguments, followed by the
+ * status and the return value written back by the PMU
+ */
+#define PM_BATCH_ENTRY_SIZE     32U
+#define PM_BATCH_STATUS_OFFSET  20U
+#define PM_BATCH_VALUE_OFFSET   24U
+#define PM_BATCH_MAX_CALLS      32U
+
+/* PM_BATCH flags */
+#define PM_BATCH_STOP_ON_ERROR  0x1U
+
+/*
+ * Status page layout (offsets in bytes). The page is published by the PMU
+ * into master's memory, sequence number is odd while the page is updated.
+ * Time stamps are taken by the PMU when the primary processor of the master
+ * suspends, goes to sleep, starts waking up and is running again.
+ */
+#define PM_STATUS_SEQ_OFFSET            0U
+#define PM_STATUS_WAKE_CNT_OFFSET       4U
+#define PM_STATUS_TS_SUSPEND_OFFSET     8U
+#define PM_STATUS_TS_SLEEP_OFFSET       12U
+#define PM_STATUS_TS_WAKE_OFFSET        16U
+#define PM_STATUS_TS_ACTIVE_OFFSET      20U
+#define PM_STATUS_TS_FREQ_OFFSET        24U
+#define PM_STATUS_NODE_OFFSET           32U
+#define PM_STATUS_NODE_CNT              64U
+#define PM_STATUS_PAGE_SIZE     (PM_STATUS_NODE_OFFSET + \
+				 (4U * PM_STATUS_NODE_CNT))
 
 /* PM API callback ids */
 #define PM_INIT_SUSPEND_CB      30U
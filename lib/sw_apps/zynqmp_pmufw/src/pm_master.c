@@ -558,6 +558,70 @@ PmMaster *const pmAllMasters[PM_MASTER_MAX] = {
 	&pmMasterRpu1_g,
 };
 
+/*
+ * Master/slave requirement matrix: index of the master's requirement for
+ * each slave node (row per master as ordered in pmAllMasters), or
+ * PM_REQUIREMENT_NONE if the master is not allowed to use the slave.
+ * Built by PmMasterInit.
+ */
+static PmRequirementId pmReqMatrix[PM_MASTER_MAX][NODE_MAX + 1U];
+
+/**
+ * PmRequirementCaps() - Get capabilities the requirement contributes to the
+ *                       slave
+ * @masterReq   Master's requirement for the slave
+ *
+ * @return      Currently required capabilities if the master uses the slave,
+ *              0 otherwise
+ */
+static u32 PmRequirementCaps(const PmRequirement* const masterReq)
+{
+	u32 caps = 0U;
+
+	if (0U != (PM_MASTER_USING_SLAVE_MASK & masterReq->info)) {
+		caps = masterReq->currReq;
+	}
+
+	return caps;
+}
+
+/**
+ * PmRequirementSetCurrent() - Set current requirement of a master for a slave
+ * @masterReq   Master's requirement for the slave
+ * @caps        Capabilities the master currently requires
+ *
+ * @note        Only updates capabilities required from the slave, slave state
+ *              is updated by PmUpdateSlave.
+ */
+static void PmRequirementSetCurrent(PmRequirement* const masterReq,
+				    const u32 caps)
+{
+	u32 oldCaps = PmRequirementCaps(masterReq);
+
+	masterReq->currReq = caps;
+	PmSlaveReqCapsChanged(masterReq->slave, oldCaps,
+			      PmRequirementCaps(masterReq));
+}
+
+/**
+ * PmRequirementSetUsage() - Set or clear the flag stating that the master is
+ *                           using the slave
+ * @masterReq   Master's requirement for the slave
+ * @used        True if the master uses the slave, false otherwise
+ */
+void PmRequirementSetUsage(PmRequirement* const masterReq, const bool used)
+{
+	u32 oldCaps = PmRequirementCaps(masterReq);
+
+	if (true == used) {
+		masterReq->info |= PM_MASTER_USING_SLAVE_MASK;
+	} else {
+		masterReq->info &= ~PM_MASTER_USING_SLAVE_MASK;
+	}
+	PmSlaveReqCapsChanged(masterReq->slave, oldCaps,
+			      PmRequirementCaps(masterReq));
+}
+
 /**
  * PmRequirementSchedule() - Schedule requirements of the master for slave.
  *                           Slave state will be updated according to the
@@ -611,7 +675,7 @@ int PmRequirementUpdate(PmRequirement* const masterReq, const u32 caps)
 
 	/* Configure requested capabilities */
 	tmpCaps = masterReq->currReq;
-	masterReq->currReq = caps;
+	PmRequirementSetCurrent(masterReq, caps);
 	status = PmUpdateSlave(masterReq->slave);
 
 	if (XST_SUCCESS == status) {
@@ -619,7 +683,7 @@ int PmRequirementUpdate(PmRequirement* const masterReq, const u32 caps)
 		masterReq->nextReq = masterReq->currReq;
 	} else {
 		/* Remember the last setting, will report an error */
-		masterReq->currReq = tmpCaps;
+		PmRequirementSetCurrent(masterReq, tmpCaps);
 	}
 
 done:
@@ -673,7 +737,7 @@ static int PmRequirementUpdateScheduled(const PmMaster* const master,
 				}
 			}
 
-			master->reqs[i].currReq = tmpReq;
+			PmRequirementSetCurrent(&master->reqs[i], tmpReq);
 
 			/* Update slave setting */
 			status = PmUpdateSlave(master->reqs[i].slave);
@@ -725,7 +789,7 @@ static void PmRequirementRequestDefault(const PmMaster* const master)
 	for (i = 0; i < master->reqsCnt; i++) {
 		if (0U != master->reqs[i].defaultReq) {
 			/* Set flag to state that master is using slave */
-			master->reqs[i].info |= PM_MASTER_USING_SLAVE_MASK;
+			PmRequirementSetUsage(&master->reqs[i], true);
 			master->reqs[i].nextReq = master->reqs[i].defaultReq;
 		}
 	}
@@ -748,7 +812,7 @@ static int PmRequirementReleaseAll(const PmMaster* const master)
 	for (i = 0; i < master->reqsCnt; i++) {
 		if (0U != (PM_MASTER_USING_SLAVE_MASK & master->reqs[i].info)) {
 			/* Clear flag - master is not using slave anymore */
-			master->reqs[i].info &= ~PM_MASTER_USING_SLAVE_MASK;
+			PmRequirementSetUsage(&master->reqs[i], false);
 			/* Release current and next requirements */
 			master->reqs[i].currReq = 0U;
 			master->reqs[i].nextReq = 0U;
@@ -780,18 +844,54 @@ PmRequirement* PmGetRequirementForSlave(const PmMaster* const master,
 					const PmNodeId nodeId)
 {
 	u32 i;
+	PmRequirementId idx;
 	PmRequirement *req = NULL;
 
-	for (i = 0; i < master->reqsCnt; i++) {
-		if (master->reqs[i].slave->node.nodeId == nodeId) {
-			req = &master->reqs[i];
+	if (nodeId > NODE_MAX) {
+		goto done;
+	}
+
+	for (i = 0U; i < PM_MASTER_MAX; i++) {
+		if (master == pmAllMasters[i]) {
+			idx = pmReqMatrix[i][nodeId];
+			if (PM_REQUIREMENT_NONE != idx) {
+				req = &master->reqs[idx];
+			}
 			break;
 		}
 	}
 
+done:
 	return req;
 }
 
+/**
+ * PmMasterInit() - Initialize master/slave requirements data
+ *
+ * @note    Builds the requirement matrix used by PmGetRequirementForSlave
+ *          and computes capabilities required from each slave according to
+ *          the statically assigned requirements. Call once at PM init, before
+ *          any PM API call is processed.
+ */
+void PmMasterInit(void)
+{
+	u32 i;
+	u32 n;
+	PmRequirementId r;
+	const PmMaster* master;
+
+	for (i = 0U; i < PM_MASTER_MAX; i++) {
+		master = pmAllMasters[i];
+		for (n = 0U; n <= NODE_MAX; n++) {
+			pmReqMatrix[i][n] = PM_REQUIREMENT_NONE;
+		}
+		for (r = 0U; r < master->reqsCnt; r++) {
+			pmReqMatrix[i][master->reqs[r].slave->node.nodeId] = r;
+			PmSlaveReqCapsInit(master->reqs[r].slave);
+		}
+	}
+}
+
 /**
  * PmEnableAllMasterIpis() - Iterate through all masters and enable their IPI
  *                           interrupt
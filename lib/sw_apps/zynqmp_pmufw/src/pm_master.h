@@ -129,6 +129,9 @@ typedef struct PmMaster PmMaster;
 /* Maximum number of masters currently supported */
 #define PM_MASTER_MAX               3U
 
+/* Requirement index of a slave the master is not allowed to use */
+#define PM_REQUIREMENT_NONE         0xFFU
+
 /*********************************************************************
  * Structure definitions
  ********************************************************************/
@@ -236,6 +239,10 @@ PmRequirement* PmGetRequirementForSlave(const PmMaster* const master,
 /* Requirements related functions */
 int PmRequirementSchedule(PmRequirement* const masterReq, const u32 caps);
 int PmRequirementUpdate(PmRequirement* const masterReq, const u32 caps);
+void PmRequirementSetUsage(PmRequirement* const masterReq, const bool used);
+
+/* Call at initialization to build master/slave requirements data */
+void PmMasterInit(void);
 /* Notify master by a primary core when changing state */
 int PmMasterNotify(PmMaster* const master, const PmProcEvent event);
 
@@ -40,6 +40,7 @@
 #include "pm_usb.h"
 #include "pm_periph.h"
 #include "pm_pll.h"
+#include "pm_status.h"
 
 static PmNode* const pmNodes[NODE_MAX] = {
 	&pmApuProcs_g[PM_PROC_APU_0].node,
@@ -117,3 +118,36 @@ PmNode* PmGetNodeById(const u32 nodeId)
 
 	return node;
 }
+
+/**
+ * PmGetNodeByIndex() - Get node at the given position in the nodes array
+ * @index       Position of the node, from 0 to NODE_MAX - 1
+ *
+ * @returns     Pointer to PmNode structure (or NULL if index is out of range)
+ *
+ * @note        Used to walk all nodes without searching by node ID
+ */
+PmNode* PmGetNodeByIndex(const u32 index)
+{
+	PmNode* node = NULL;
+
+	if (index < NODE_MAX) {
+		node = pmNodes[index];
+	}
+
+	return node;
+}
+
+/**
+ * PmNodeUpdateCurState() - Change the current state of a node
+ * @node        Node whose state has changed
+ * @state       New state of the node
+ *
+ * @note        All state changes after initialization go through here so
+ *              that the status pages get to know about them
+ */
+void PmNodeUpdateCurState(PmNode* const node, const PmStateId state)
+{
+	node->currState = state;
+	PmStatusNodeChanged(node);
+}
@@ -115,5 +115,7 @@ typedef struct PmNode {
  * Function declarations
  ********************************************************************/
 PmNode* PmGetNodeById(const u32 nodeId);
+PmNode* PmGetNodeByIndex(const u32 index);
+void PmNodeUpdateCurState(PmNode* const node, const PmStateId state);
 
 #endif /* PM_NODE_H_ */
@@ -693,7 +693,7 @@ static int PmGppFsmHandler(PmSlave* const slave, const PmStateId nextState)
 		break;
 	}
 	if (XST_SUCCESS == status) {
-		slave->node.currState = nextState;
+		PmNodeUpdateCurState(&slave->node, nextState);
 	}
 
 	return status;
@@ -186,7 +186,7 @@ static int PmPllFsmHandler(PmSlave* const slave, const PmStateId nextState)
 	}
 
 	if (XST_SUCCESS == status) {
-		slave->node.currState = nextState;
+		PmNodeUpdateCurState(&slave->node, nextState);
 	}
 
 	return status;
@@ -50,6 +50,7 @@
 #include "pm_defs.h"
 #include "pm_proc.h"
 #include "pm_master.h"
+#include "pm_status.h"
 #include "crl_apb.h"
 #include "xpfw_rom_interface.h"
 
@@ -101,7 +102,7 @@ int PmProcSleep(PmNode* const nodePtr)
 	}
 
 	if (XST_SUCCESS == status) {
-		nodePtr->currState = PM_PROC_STATE_SLEEP;
+		PmNodeUpdateCurState(nodePtr, PM_PROC_STATE_SLEEP);
 	}
 
 done:
@@ -161,7 +162,7 @@ int PmProcWake(PmNode* const nodePtr)
 	}
 
 	if (XST_SUCCESS == status) {
-		nodePtr->currState = PM_PROC_STATE_ACTIVE;
+		PmNodeUpdateCurState(nodePtr, PM_PROC_STATE_ACTIVE);
 	}
 
 done:
@@ -182,7 +183,10 @@ static int PmProcTrActiveToSuspend(PmProc* const proc)
 	PmDbg("ACTIVE->SUSPENDING %s\n", PmStrNode(proc->node.nodeId));
 
 	ENABLE_WFI(proc->wfiEnableMask);
-	proc->node.currState = PM_PROC_STATE_SUSPENDING;
+	PmNodeUpdateCurState(&proc->node, PM_PROC_STATE_SUSPENDING);
+	if (true == proc->isPrimary) {
+		PmStatusStamp(proc->master, PM_STATUS_TS_SUSPEND_OFFSET);
+	}
 
 	return XST_SUCCESS;
 }
@@ -209,7 +213,7 @@ static int PmProcTrToForcedOff(PmProc* const proc)
 
 	status = PmProcSleep(&proc->node);
 	/* Override the state set in PmProcSleep to indicate FORCED OFF */
-	proc->node.currState = PM_PROC_STATE_FORCEDOFF;
+	PmNodeUpdateCurState(&proc->node, PM_PROC_STATE_FORCEDOFF);
 	if ((true == proc->isPrimary) && (XST_SUCCESS == status)) {
 		/* Notify master to release all requirements of this processor */
 		status = PmMasterNotify(proc->master, PM_PROC_EVENT_FORCE_PWRDN);
@@ -237,7 +241,7 @@ static int PmProcTrSuspendToActive(PmProc* const proc)
 
 	/* Notify master to cancel scheduled requests */
 	status = PmMasterNotify(proc->master, PM_PROC_EVENT_ABORT_SUSPEND);
-	proc->node.currState = PM_PROC_STATE_ACTIVE;
+	PmNodeUpdateCurState(&proc->node, PM_PROC_STATE_ACTIVE);
 
 	return status;
 }
@@ -259,6 +263,7 @@ static int PmProcTrSuspendToSleep(PmProc* const proc)
 
 	status = PmProcSleep(&proc->node);
 	if ((true == proc->isPrimary) && (XST_SUCCESS == status)) {
+		PmStatusStamp(proc->master, PM_STATUS_TS_SLEEP_OFFSET);
 		/*
 		 * Notify master to update slave capabilities according to the
 		 * scheduled requests for after primary processor goes to sleep.
@@ -295,6 +300,7 @@ static int PmProcTrSleepToActive(PmProc* const proc)
 	int status = XST_SUCCESS;
 
 	if (true == proc->isPrimary) {
+		PmStatusStamp(proc->master, PM_STATUS_TS_WAKE_OFFSET);
 		/*
 		 * Notify master to update slave capabilities according to the
 		 * scheduled requests for before the primary processor gets
@@ -309,6 +315,9 @@ static int PmProcTrSleepToActive(PmProc* const proc)
 		DISABLE_WFI(proc->wfiEnableMask);
 		DISABLE_WAKE(proc->wakeEnableMask);
 	}
+	if ((true == proc->isPrimary) && (XST_SUCCESS == status)) {
+		PmStatusWake(proc->master);
+	}
 
 	return status;
 }
@@ -331,6 +340,7 @@ static int PmProcTrForcePwrdnToActive(PmProc* const proc)
 	PmDbg("FORCED_PWRDN->ACTIVE %s\n", PmStrNode(proc->node.nodeId));
 
 	if (true == proc->isPrimary) {
+		PmStatusStamp(proc->master, PM_STATUS_TS_WAKE_OFFSET);
 		/*
 		 * Notify master to update slave capabilities according to the
 		 * scheduled requests. For waking-up from forced powerdown,
@@ -341,6 +351,9 @@ static int PmProcTrForcePwrdnToActive(PmProc* const proc)
 	if (XST_SUCCESS == status) {
 		status = PmProcWake(&proc->node);
 	}
+	if ((true == proc->isPrimary) && (XST_SUCCESS == status)) {
+		PmStatusWake(proc->master);
+	}
 
 	return status;
 }
@@ -127,28 +127,18 @@ static PmSlave* const pmSlaves[] = {
  */
 bool PmSlaveHasCapRequests(const PmSlave* const slave)
 {
-	u32 i;
-	bool hasReq = false;
-
-	for (i = 0U; i < slave->reqsCnt; i++) {
-		if ((0U != (PM_MASTER_USING_SLAVE_MASK & slave->reqs[i]->info)) &&
-		    (0U != slave->reqs[i]->currReq)) {
-			/* Slave is used by this master and has current request for caps */
-			hasReq = true;
-			break;
-		}
-	}
-
-	return hasReq;
+	return 0U != slave->reqCaps;
 }
 
 /**
- * PmGetMaxCapabilities()- Get maximum of all requested capabilities of slave
- * @slave   Slave whose maximum required capabilities should be determined
+ * PmSlaveReqCapsInit() - Compute capabilities required from the slave
+ * @slave   Slave whose required capabilities should be determined
  *
- * @return  32bit value encoding the capabilities
+ * @note    Called at initialization, to take into account requirements which
+ *          are statically assigned to masters, and when a requirement is
+ *          dropped (the remaining requirements have to be merged again).
  */
-static u32 PmGetMaxCapabilities(const PmSlave* const slave)
+void PmSlaveReqCapsInit(PmSlave* const slave)
 {
 	u32 i;
 	u32 maxCaps = 0U;
@@ -159,7 +149,28 @@ static u32 PmGetMaxCapabilities(const PmSlave* const slave)
 		}
 	}
 
-	return maxCaps;
+	slave->reqCaps = maxCaps;
+}
+
+/**
+ * PmSlaveReqCapsChanged() - Update capabilities required from the slave when
+ *                           requirement of one master is changed
+ * @slave   Slave whose requirement has changed
+ * @oldCaps Capabilities the master has required before the change
+ * @newCaps Capabilities the master requires after the change
+ *
+ * @note    Capabilities only added by the master are merged in place. If the
+ *          master dropped a capability, other masters may still require it,
+ *          so the requirements of all masters are merged again.
+ */
+void PmSlaveReqCapsChanged(PmSlave* const slave, const u32 oldCaps,
+			   const u32 newCaps)
+{
+	if (0U == (oldCaps & ~newCaps)) {
+		slave->reqCaps |= newCaps;
+	} else {
+		PmSlaveReqCapsInit(slave);
+	}
 }
 
 /**
@@ -310,7 +321,7 @@ int PmUpdateSlave(PmSlave* const slave)
 {
 	PmStateId state;
 	int status = XST_SUCCESS;
-	u32 capsToSet = PmGetMaxCapabilities(slave);
+	u32 capsToSet = slave->reqCaps;
 
 	if (0U == capsToSet) {
 		/*
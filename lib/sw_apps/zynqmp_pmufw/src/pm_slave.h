@@ -174,6 +174,10 @@ typedef struct {
  * @reqsCnt     Size of masterReq array
  * @wake        Wake event this slave can generate
  * @slvFsm      Slave finite state machine
+ * @reqCaps     Capabilities currently required by all masters using the slave.
+ *              Updated through PmSlaveReqCapsChanged whenever a master's
+ *              requirement changes, so it does not have to be recomputed
+ *              from all requirements when the slave state is updated.
  */
 typedef struct PmSlave {
 	PmNode node;
@@ -181,6 +185,7 @@ typedef struct PmSlave {
 	u8 reqsCnt;
 	const PmWakeProperties* wake;
 	const PmSlaveFsm* slvFsm;
+	u32 reqCaps;
 } PmSlave;
 
 /*********************************************************************
@@ -196,6 +201,10 @@ int PmCheckCapabilities(PmSlave* const slave, const u32 capabilities);
 
 bool PmSlaveHasCapRequests(const PmSlave* const slave);
 
+void PmSlaveReqCapsInit(PmSlave* const slave);
+void PmSlaveReqCapsChanged(PmSlave* const slave, const u32 oldCaps,
+			   const u32 newCaps);
+
 int PmSlaveProcessWake(const u32 wakeMask);
 void PmSlaveWakeEnable(PmSlave* const slave);
 void PmSlaveWakeDisable(PmSlave* const slave);
@@ -115,7 +115,7 @@ static int PmSramFsmHandler(PmSlave* const slave, const PmStateId nextState)
 	}
 
 	if (XST_SUCCESS == status) {
-		slave->node.currState = nextState;
+		PmNodeUpdateCurState(&slave->node, nextState);
 	}
 
 	return status;
@@ -0,0 +1,394 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ */
+
+/*********************************************************************
+ * Status page: node states and suspend/resume time stamps published
+ * by the PMU into memory of the master, so the master can read them
+ * without issuing an IPI.
+ *
+ * Nodes report their state changes through PmStatusNodeChanged, and only
+ * those nodes are written into the pages. Pages are published after each
+ * processed request, wfi and wake event. A page is not touched while the
+ * memory holding it is not on; it is written as a whole once the memory
+ * is back on.
+ *********************************************************************/
+
+#include "pm_status.h"
+#include "pm_node.h"
+#include "pm_sram.h"
+#include "pm_power.h"
+#include "pm_common.h"
+
+/**
+ * PmStatusMem - Memory which can hold a status page
+ * @base    Start address of the memory
+ * @size    Size of the memory in bytes
+ * @node    Node whose state tells whether the memory is accessible
+ * @onState State of the node in which the memory is accessible
+ */
+typedef struct {
+	const u32 base;
+	const u32 size;
+	PmNode* const node;
+	const PmStateId onState;
+} PmStatusMem;
+
+static const PmStatusMem pmStatusMems[] = {
+	{ 0xFFFC0000U, 0x10000U, &pmSlaveOcm0_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFFD0000U, 0x10000U, &pmSlaveOcm1_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFFE0000U, 0x10000U, &pmSlaveOcm2_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFFF0000U, 0x10000U, &pmSlaveOcm3_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFE00000U, 0x10000U, &pmSlaveTcm0A_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFE20000U, 0x10000U, &pmSlaveTcm0B_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFE90000U, 0x10000U, &pmSlaveTcm1A_g.slv.node, PM_SRAM_STATE_ON },
+	{ 0xFFEB0000U, 0x10000U, &pmSlaveTcm1B_g.slv.node, PM_SRAM_STATE_ON },
+	/* Lower DDR, the DDR controller is in the full power domain */
+	{ 0x00000000U, 0x80000000U, &pmPowerDomainFpd_g.node, PM_PWR_STATE_ON },
+};
+
+/* Address of the status page for each master, 0 if not registered */
+static u32 pmStatusPages[PM_MASTER_MAX];
+
+/* Memory holding the status page of each master */
+static const PmStatusMem* pmStatusPageMem[PM_MASTER_MAX];
+
+/* Page has missed updates while its memory was not on */
+static bool pmStatusPageStale[PM_MASTER_MAX];
+
+/* Number of registered status pages */
+static u32 pmStatusPageCnt;
+
+/* Node states, indexed by node ID */
+static PmStateId pmStatusStates[PM_STATUS_NODE_CNT];
+
+/* Nodes whose state is not published yet, bit per node ID */
+static u32 pmStatusDirty[PM_STATUS_NODE_CNT / 32U];
+
+/**
+ * PmStatusGetMem() - Find the memory which holds a status page
+ * @address Address of the page
+ *
+ * @return  Pointer to the memory or NULL if the page is not entirely
+ *          within one of the known memories
+ */
+static const PmStatusMem* PmStatusGetMem(const u32 address)
+{
+	u32 i;
+	const PmStatusMem* mem = NULL;
+
+	for (i = 0U; i < ARRAY_SIZE(pmStatusMems); i++) {
+		if ((address >= pmStatusMems[i].base) &&
+		    ((address - pmStatusMems[i].base) <=
+		     (pmStatusMems[i].size - PM_STATUS_PAGE_SIZE))) {
+			mem = &pmStatusMems[i];
+			break;
+		}
+	}
+
+	return mem;
+}
+
+/**
+ * PmStatusGetPageIdx() - Get index of the master's status page
+ * @master  Master whose page is needed
+ *
+ * @return  Index of the page or PM_MASTER_MAX if the master has not
+ *          registered one or the memory holding it is not on
+ */
+static u32 PmStatusGetPageIdx(const PmMaster* const master)
+{
+	u32 i;
+
+	for (i = 0U; i < PM_MASTER_MAX; i++) {
+		if (master == pmAllMasters[i]) {
+			break;
+		}
+	}
+
+	if ((PM_MASTER_MAX != i) && ((0U == pmStatusPages[i]) ||
+	    (pmStatusPageMem[i]->onState !=
+	     pmStatusPageMem[i]->node->currState))) {
+		i = PM_MASTER_MAX;
+	}
+
+	return i;
+}
+
+/**
+ * PmStatusUpdateBegin() - Mark the page as being updated (odd sequence)
+ * @page    Address of the status page
+ */
+static void PmStatusUpdateBegin(const u32 page)
+{
+	u32 seq = XPfw_Read32(page + PM_STATUS_SEQ_OFFSET);
+
+	XPfw_Write32(page + PM_STATUS_SEQ_OFFSET, (seq | 1U));
+}
+
+/**
+ * PmStatusUpdateEnd() - Mark the page as consistent (even sequence)
+ * @page    Address of the status page
+ */
+static void PmStatusUpdateEnd(const u32 page)
+{
+	u32 seq = XPfw_Read32(page + PM_STATUS_SEQ_OFFSET);
+
+	XPfw_Write32(page + PM_STATUS_SEQ_OFFSET, seq + 1U);
+}
+
+/**
+ * PmStatusWriteNodes() - Write states of all nodes into a page
+ * @page    Address of the status page
+ */
+static void PmStatusWriteNodes(const u32 page)
+{
+	u32 i;
+
+	for (i = 0U; i < PM_STATUS_NODE_CNT; i++) {
+		XPfw_Write32(page + PM_STATUS_NODE_OFFSET + (4U * i),
+			     pmStatusStates[i]);
+	}
+}
+
+/**
+ * PmStatusInit() - Take the initial state of all nodes
+ *
+ * @note    Called once at PMU firmware start, before any node changes state
+ */
+void PmStatusInit(void)
+{
+	u32 i;
+	PmNode* node;
+
+	for (i = 0U; i < NODE_MAX; i++) {
+		node = PmGetNodeByIndex(i);
+		if ((NULL != node) && (node->nodeId < PM_STATUS_NODE_CNT)) {
+			pmStatusStates[node->nodeId] = node->currState;
+		}
+	}
+}
+
+/**
+ * PmStatusNodeChanged() - Record that the state of a node has changed
+ * @node    Node whose state has changed
+ *
+ * @note    Nodes call this whenever they change currState, so that
+ *          PmStatusPublish writes only what has changed
+ */
+void PmStatusNodeChanged(const PmNode* const node)
+{
+	if (node->nodeId < PM_STATUS_NODE_CNT) {
+		pmStatusStates[node->nodeId] = node->currState;
+		pmStatusDirty[node->nodeId / 32U] |= (u32)1U << (node->nodeId % 32U);
+	}
+}
+
+/**
+ * PmStatusSetPage() - Register the status page of a master
+ * @master  Master who registers the page
+ * @address Address of the page, 0 to unregister the page
+ *
+ * @return  XST_SUCCESS if the page is registered, XST_INVALID_PARAM if
+ *          address is not aligned, the page is not in OCM, TCM or lower
+ *          DDR or the master is not known. XST_FAILURE if the memory
+ *          holding the page is not on.
+ *
+ * @note    The whole page is written when it is registered, afterwards only
+ *          the changes are published.
+ */
+int PmStatusSetPage(const PmMaster* const master, const u32 address)
+{
+	int status = XST_INVALID_PARAM;
+	u32 i, idx;
+	const PmStatusMem* mem = NULL;
+
+	if (0U != (address & 3U)) {
+		goto done;
+	}
+
+	for (idx = 0U; idx < PM_MASTER_MAX; idx++) {
+		if (master == pmAllMasters[idx]) {
+			break;
+		}
+	}
+	if (PM_MASTER_MAX == idx) {
+		goto done;
+	}
+
+	if (0U != address) {
+		mem = PmStatusGetMem(address);
+		if (NULL == mem) {
+			goto done;
+		}
+		if (mem->onState != mem->node->currState) {
+			status = XST_FAILURE;
+			goto done;
+		}
+	}
+
+	if ((0U != pmStatusPages[idx]) && (0U == address)) {
+		pmStatusPageCnt--;
+	} else if ((0U == pmStatusPages[idx]) && (0U != address)) {
+		pmStatusPageCnt++;
+	} else {
+	}
+	pmStatusPages[idx] = address;
+	pmStatusPageMem[idx] = mem;
+	pmStatusPageStale[idx] = false;
+	status = XST_SUCCESS;
+
+	if (0U == address) {
+		goto done;
+	}
+
+	XPfw_Write32(address + PM_STATUS_SEQ_OFFSET, 1U);
+	XPfw_Write32(address + PM_STATUS_WAKE_CNT_OFFSET, 0U);
+	for (i = PM_STATUS_TS_SUSPEND_OFFSET; i <= PM_STATUS_TS_ACTIVE_OFFSET;
+	     i += 4U) {
+		XPfw_Write32(address + i, 0U);
+	}
+	XPfw_Write32(address + PM_STATUS_TS_FREQ_OFFSET,
+		     XPFW_UTIL_TIMESTAMP_FREQ);
+	PmStatusWriteNodes(address);
+	PmStatusUpdateEnd(address);
+
+done:
+	return status;
+}
+
+/**
+ * PmStatusStamp() - Write current time stamp into the master's status page
+ * @master  Master whose primary processor changes state
+ * @offset  One of PM_STATUS_TS_*_OFFSET
+ */
+void PmStatusStamp(const PmMaster* const master, const u32 offset)
+{
+	u32 idx;
+
+	if (0U == pmStatusPageCnt) {
+		goto done;
+	}
+
+	idx = PmStatusGetPageIdx(master);
+	if (PM_MASTER_MAX != idx) {
+		XPfw_Write32(pmStatusPages[idx] + offset, XPfw_UtilTimeStamp());
+	}
+
+done:
+	return;
+}
+
+/**
+ * PmStatusWake() - Record that the master's primary processor is running
+ * @master  Master whose primary processor has been woken up
+ */
+void PmStatusWake(const PmMaster* const master)
+{
+	u32 idx, page;
+
+	if (0U == pmStatusPageCnt) {
+		goto done;
+	}
+
+	idx = PmStatusGetPageIdx(master);
+	if (PM_MASTER_MAX != idx) {
+		page = pmStatusPages[idx];
+		XPfw_Write32(page + PM_STATUS_TS_ACTIVE_OFFSET,
+			     XPfw_UtilTimeStamp());
+		XPfw_Write32(page + PM_STATUS_WAKE_CNT_OFFSET,
+			     XPfw_Read32(page + PM_STATUS_WAKE_CNT_OFFSET) + 1U);
+	}
+
+done:
+	return;
+}
+
+/**
+ * PmStatusPublish() - Write node states which have changed into all pages
+ *
+ * @note    Pages whose memory is not on are skipped and written as a whole
+ *          on the first publication after their memory is on again
+ */
+void PmStatusPublish(void)
+{
+	u32 p, w, b, bits, page;
+	u32 dirty[ARRAY_SIZE(pmStatusDirty)];
+	bool changed = false;
+
+	for (w = 0U; w < ARRAY_SIZE(pmStatusDirty); w++) {
+		dirty[w] = pmStatusDirty[w];
+		pmStatusDirty[w] = 0U;
+		if (0U != dirty[w]) {
+			changed = true;
+		}
+	}
+
+	if (0U == pmStatusPageCnt) {
+		goto done;
+	}
+
+	for (p = 0U; p < PM_MASTER_MAX; p++) {
+		page = pmStatusPages[p];
+		if (0U == page) {
+			continue;
+		}
+		if (pmStatusPageMem[p]->onState !=
+		    pmStatusPageMem[p]->node->currState) {
+			pmStatusPageStale[p] = true;
+			continue;
+		}
+		if (true == pmStatusPageStale[p]) {
+			PmStatusUpdateBegin(page);
+			PmStatusWriteNodes(page);
+			PmStatusUpdateEnd(page);
+			pmStatusPageStale[p] = false;
+			continue;
+		}
+		if (false == changed) {
+			continue;
+		}
+
+		PmStatusUpdateBegin(page);
+		for (w = 0U; w < ARRAY_SIZE(dirty); w++) {
+			bits = dirty[w];
+			for (b = 32U * w; 0U != bits; b++) {
+				if (0U != (bits & 1U)) {
+					XPfw_Write32(page + PM_STATUS_NODE_OFFSET +
+						     (4U * b), pmStatusStates[b]);
+				}
+				bits >>= 1U;
+			}
+		}
+		PmStatusUpdateEnd(page);
+	}
+
+done:
+	return;
+}
@@ -89,7 +89,7 @@ static int PmUsbFsmHandler(PmSlave* const slave, const PmStateId nextState)
 		break;
 	}
 	if (XST_SUCCESS == status) {
-		slave->node.currState = nextState;
+		PmNodeUpdateCurState(&slave->node, nextState);
 	}
 
 	return status;
@@ -53,4 +53,17 @@
 #undef ENABLE_RTC_TEST
 #undef ENABLE_SCHEDULER
 
+/*
+ * Measure processing time of PM API calls, PIT2 is used for time stamps.
+ * Statistics are printed periodically if ENABLE_SCHEDULER is also defined.
+ */
+#undef ENABLE_PM_LATENCY
+
+/**
+ * Measure Event and IPI dispatch latency (interrupt entry to module handler)
+ * and handler execution time, PIT2 is used for time stamps.
+ * Statistics are printed by XPfw_CorePrintStats.
+ */
+#undef ENABLE_DISPATCH_STATS
+
 #endif /* XPFW_CONFIG_H_ */
@@ -43,6 +43,82 @@ static XPfw_Core_t XPfwCore = { .IsReady = CORE_IS_DEAD };
 /* Declare the Core Pointer as constant, since we don't intend to change it */
 static XPfw_Core_t * const CorePtr = &XPfwCore;
 
+/**
+ * Add a ModId to a dispatch list, keeping the list sorted by ModId so that
+ * Mods are called in the same order in which they were created
+ */
+static void XPfw_CoreListAdd(u8 *List, u8 *Count, u8 ModId)
+{
+	u32 Idx;
+	u32 Pos = *Count;
+
+	for (Idx = 0U; Idx < *Count; Idx++) {
+		if (List[Idx] == ModId) {
+			goto Done;
+		}
+		if ((List[Idx] > ModId) && (Pos == *Count)) {
+			Pos = Idx;
+		}
+	}
+	if (*Count >= XPFW_MAX_MOD_COUNT) {
+		goto Done;
+	}
+	for (Idx = *Count; Idx > Pos; Idx--) {
+		List[Idx] = List[Idx - 1U];
+	}
+	List[Pos] = ModId;
+	(*Count)++;
+Done:
+	return;
+}
+
+static void XPfw_CoreListRemove(u8 *List, u8 *Count, u8 ModId)
+{
+	u32 Idx;
+	u32 Found = 0U;
+
+	for (Idx = 0U; Idx < *Count; Idx++) {
+		if (Found != 0U) {
+			List[Idx - 1U] = List[Idx];
+		} else if (List[Idx] == ModId) {
+			Found = 1U;
+		} else {
+			/* Keep looking */
+		}
+	}
+	if (Found != 0U) {
+		(*Count)--;
+	}
+}
+
+#ifdef ENABLE_DISPATCH_STATS
+static void XPfw_CoreUpdateStats(XPfw_DispatchStats_t *Stats, u32 Start)
+{
+	u32 Latency = Start - XPfw_InterruptGetTimeStamp();
+	u32 ExecTime = XPfw_UtilTimeStamp() - Start;
+
+	Stats->Count++;
+	if (Latency > Stats->MaxLatency) {
+		Stats->MaxLatency = Latency;
+	}
+	if (ExecTime > Stats->MaxExecTime) {
+		Stats->MaxExecTime = ExecTime;
+	}
+}
+
+static void XPfw_CorePrintDispatchStats(const char *Name, u32 Id,
+		const XPfw_DispatchStats_t *Stats)
+{
+	u32 NsPerCount = 1000U / XPFW_UTIL_TIMESTAMP_PER_US;
+
+	if (Stats->Count != 0U) {
+		fw_printf("%s %d: %d dispatches, max latency %d ns, max exec %d ns\r\n",
+			Name, Id, Stats->Count, Stats->MaxLatency * NsPerCount,
+			Stats->MaxExecTime * NsPerCount);
+	}
+}
+#endif
+
 XStatus XPfw_CoreInit(u32 Options)
 {
 	u32 Index;
@@ -57,6 +133,16 @@ XStatus XPfw_CoreInit(u32 Options)
 
 		CorePtr->ModCount = (u8)0U;
 
+		for (Index = 0U; Index < ARRAYSIZE(CorePtr->EventModCount); Index++) {
+			CorePtr->EventModCount[Index] = (u8)0U;
+		}
+		for (Index = 0U; Index < ARRAYSIZE(CorePtr->IpiModCount); Index++) {
+			CorePtr->IpiModCount[Index] = (u8)0U;
+		}
+#ifdef ENABLE_DISPATCH_STATS
+		XPfw_UtilTimeStampInit();
+#endif
+
 		for (Index = 0U; Index < ARRAYSIZE(CorePtr->ModList); Index++) {
 			Status = XPfw_ModuleInit(&CorePtr->ModList[Index], (u8) 0U);
 			/* If there was an error, then just get out of here */
@@ -111,29 +197,30 @@ XStatus XPfw_CoreConfigure(void)
 
 XStatus XPfw_CoreDispatchEvent(u32 EventId)
 {
-	XStatus Status;
+	XStatus Status = XST_FAILURE;
 	u32 Idx;
-	u32 CallCount = 0U;
-	if ((CorePtr != NULL) && (EventId < XPFW_EV_MAX)) {
+	u8 ModId;
+#ifdef ENABLE_DISPATCH_STATS
+	u32 Start = XPfw_UtilTimeStamp();
+#endif
 
-		for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
-			/**
-			 * Check if Mod[Idx] is registered for this event
-			 */
-			if ((XPfw_EventGetModMask(EventId) & ((u32) 1U << Idx))
-					== ((u32) 1U << Idx)) {
-				CorePtr->ModList[Idx].EventHandler(&CorePtr->ModList[Idx],
+	if ((CorePtr != NULL) && (EventId < XPFW_EV_MAX)) {
+		/* Call only the Mods in the dispatch table of this event */
+		for (Idx = 0U; Idx < CorePtr->EventModCount[EventId]; Idx++) {
+			ModId = CorePtr->EventModList[EventId][Idx];
+			if (NULL != CorePtr->ModList[ModId].EventHandler) {
+				CorePtr->ModList[ModId].EventHandler(&CorePtr->ModList[ModId],
 						EventId);
-				CallCount++;
+				Status = XST_SUCCESS;
 			}
 		}
+#ifdef ENABLE_DISPATCH_STATS
+		if (XST_SUCCESS == Status) {
+			XPfw_CoreUpdateStats(&CorePtr->EventStats[EventId], Start);
+		}
+#endif
 	}
-	/* fw_printf("%s: Event(%d) dispatched to  %d Mods\r\n", __func__, EventId,CallCount); */
-	if (CallCount > 0U) {
-		Status = XST_SUCCESS;
-	} else {
-		Status = XST_FAILURE;
-	}
+
 	return Status;
 }
 
@@ -144,29 +231,25 @@ XStatus XPfw_CoreDispatchEvent(u32 EventId)
  */
 XStatus XPfw_CoreDispatchIpi(u32 IpiNum)
 {
-	XStatus Status;
+	XStatus Status = XST_FAILURE;
 	u32 Idx;
-	u32 CallCount = 0U;
-
-	if ((CorePtr != NULL) && (IpiNum < 4U)) {
-		for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
-			/**
-			 * TODO: Check if Mod[Idx] is registered for this Ipi
-			 * TODO: What if it is registered , but Handler is NULL. Report it!
-			 */
-			if (NULL != CorePtr->ModList[Idx].IpiHandler) {
-				CorePtr->ModList[Idx].IpiHandler(&CorePtr->ModList[Idx], IpiNum,
-						0U);
-				CallCount++;
-			}
+	u8 ModId;
+#ifdef ENABLE_DISPATCH_STATS
+	u32 Start = XPfw_UtilTimeStamp();
+#endif
+
+	if ((CorePtr != NULL) && (IpiNum < XPFW_IPI_MAX)) {
+		for (Idx = 0U; Idx < CorePtr->IpiModCount[IpiNum]; Idx++) {
+			ModId = CorePtr->IpiModList[IpiNum][Idx];
+			CorePtr->ModList[ModId].IpiHandler(&CorePtr->ModList[ModId],
+					IpiNum, 0U);
+			Status = XST_SUCCESS;
 		}
-	}
-	/* fw_printf("%s: IPI-%d dispatched to  %d Mods\r\n", __func__, IpiNum,
-			CallCount); */
-	if (CallCount > 0U) {
-		Status = XST_SUCCESS;
-	} else {
-		Status = XST_FAILURE;
+#ifdef ENABLE_DISPATCH_STATS
+		if (XST_SUCCESS == Status) {
+			XPfw_CoreUpdateStats(&CorePtr->IpiStats[IpiNum], Start);
+		}
+#endif
 	}
 
 	return Status;
@@ -207,6 +290,21 @@ XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval,
 	return Status;
 }
 
+XStatus XPfw_CoreScheduleOneShotTask(const XPfw_Module_t *ModPtr, u32 Delay,
+		VoidFunction_t CallbackRef)
+{
+	XStatus Status;
+
+	if ((ModPtr != NULL) && (CorePtr != NULL)) {
+		Status = XPfw_SchedulerAddOneShotTask(&CorePtr->Scheduler,
+				ModPtr->ModId, Delay, CallbackRef);
+	} else {
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval,
 		VoidFunction_t CallbackRef)
 {
@@ -287,6 +385,20 @@ void XPfw_CorePrintStats(void)
 	fw_printf("Module Count: %d (%d)\r\n", CorePtr->ModCount, XPFW_MAX_MOD_COUNT);
 	fw_printf("Scheduler State: %s\r\n",((CorePtr->Scheduler.Enabled == TRUE)?"ENABLED":"DISABLED"));
 	fw_printf("Scheduler Ticks: %d\r\n",CorePtr->Scheduler.Tick);
+	XPfw_SchedulerPrintStats(&CorePtr->Scheduler);
+#ifdef ENABLE_DISPATCH_STATS
+	{
+		u32 Idx;
+		for (Idx = 0U; Idx < XPFW_EV_MAX; Idx++) {
+			XPfw_CorePrintDispatchStats("Event", Idx,
+					&CorePtr->EventStats[Idx]);
+		}
+		for (Idx = 0U; Idx < XPFW_IPI_MAX; Idx++) {
+			XPfw_CorePrintDispatchStats("IPI", Idx,
+					&CorePtr->IpiStats[Idx]);
+		}
+	}
+#endif
 	fw_printf("######################################################\r\n");
 	}
 }
@@ -296,10 +408,16 @@ XStatus XPfw_CoreRegisterEvent(const XPfw_Module_t *ModPtr, u32 EventId)
 {
 	XStatus Status;
 
-	if (NULL == ModPtr) {
+	if ((NULL == ModPtr) || (CorePtr == NULL)) {
 		Status = XST_FAILURE;
 	} else {
 		Status = XPfw_EventAddOwner(ModPtr->ModId, EventId);
+		/* Keep the dispatch table in sync with the Event's ModMask */
+		if ((XST_SUCCESS == Status) && (EventId < XPFW_EV_MAX) &&
+				(ModPtr->ModId < XPFW_MAX_MOD_COUNT)) {
+			XPfw_CoreListAdd(CorePtr->EventModList[EventId],
+					&CorePtr->EventModCount[EventId], ModPtr->ModId);
+		}
 	}
 	return Status;
 }
@@ -308,10 +426,16 @@ XStatus XPfw_CoreDeRegisterEvent(const XPfw_Module_t *ModPtr, u32 EventId)
 {
 	XStatus Status;
 
-	if (NULL == ModPtr) {
+	if ((NULL == ModPtr) || (CorePtr == NULL)) {
 		Status = XST_FAILURE;
 	} else {
 		Status = XPfw_EventRemoveOwner(ModPtr->ModId, EventId);
+		/* Keep the dispatch table in sync with the Event's ModMask */
+		if ((EventId < XPFW_EV_MAX) &&
+				(ModPtr->ModId < XPFW_MAX_MOD_COUNT)) {
+			XPfw_CoreListRemove(CorePtr->EventModList[EventId],
+					&CorePtr->EventModCount[EventId], ModPtr->ModId);
+		}
 	}
 	return Status;
 }
@@ -367,10 +491,25 @@ XStatus XPfw_CoreSetEventHandler(const XPfw_Module_t *ModPtr, XPfwModEventHandle
 XStatus XPfw_CoreSetIpiHandler(const XPfw_Module_t *ModPtr, XPfwModIpiHandler_t IpiHandlerFn, u32 IpiId)
 {
 	XStatus Status;
+	u32 Idx;
 	if ((ModPtr != NULL) && (CorePtr != NULL)) {
 		if (ModPtr->ModId < CorePtr->ModCount) {
 			CorePtr->ModList[ModPtr->ModId].IpiHandler = IpiHandlerFn;
 			CorePtr->ModList[ModPtr->ModId].IpiId = IpiId;
+			/*
+			 * IpiId filters on the message header, not on the IPI channel,
+			 * so the Mod is added to (or removed from) the table of every
+			 * PMU IPI channel
+			 */
+			for (Idx = 0U; Idx < XPFW_IPI_MAX; Idx++) {
+				if (NULL != IpiHandlerFn) {
+					XPfw_CoreListAdd(CorePtr->IpiModList[Idx],
+							&CorePtr->IpiModCount[Idx], ModPtr->ModId);
+				} else {
+					XPfw_CoreListRemove(CorePtr->IpiModList[Idx],
+							&CorePtr->IpiModCount[Idx], ModPtr->ModId);
+				}
+			}
 			Status = XST_SUCCESS;
 		} else {
 			Status = XST_FAILURE;
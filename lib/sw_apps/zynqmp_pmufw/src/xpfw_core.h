@@ -36,19 +36,44 @@
 
 #include "xpfw_module.h"
 #include "xpfw_scheduler.h"
+#include "xpfw_events.h"
 
 #define XPFW_MAX_MOD_COUNT 4U
+#define XPFW_IPI_MAX 4U
 
 #define XPFW_CORE_ERR_TASK_MISS
 #define XPFW_CORe_ERR_TASK_NULL
 
 
+#ifdef ENABLE_DISPATCH_STATS
+/**
+ * Dispatch statistics of one Event or IPI, in time stamp counts
+ */
+typedef struct {
+	u32 Count;	/**< Number of dispatches */
+	u32 MaxLatency;	/**< Max time from interrupt entry to first handler */
+	u32 MaxExecTime;	/**< Max time spent in the handlers */
+} XPfw_DispatchStats_t;
+#endif
+
 typedef struct {
 	XPfw_Module_t ModList[XPFW_MAX_MOD_COUNT];
 	XPfw_Scheduler_t Scheduler;
 	u8 ModCount;
 	u32 IsReady;
 	u8 Mode;	/**< Mode - Safety Diagnostics Mode / Normal Mode */
+	/**
+	 * Dispatch tables: Ids of the Mods to be called for each Event/IPI,
+	 * in ModId order. Built at registration time.
+	 */
+	u8 EventModList[XPFW_EV_MAX][XPFW_MAX_MOD_COUNT];
+	u8 EventModCount[XPFW_EV_MAX];
+	u8 IpiModList[XPFW_IPI_MAX][XPFW_MAX_MOD_COUNT];
+	u8 IpiModCount[XPFW_IPI_MAX];
+#ifdef ENABLE_DISPATCH_STATS
+	XPfw_DispatchStats_t EventStats[XPFW_EV_MAX];
+	XPfw_DispatchStats_t IpiStats[XPFW_IPI_MAX];
+#endif
 } XPfw_Core_t;
 
 XStatus XPfw_CoreInit(u32 Options);
@@ -56,6 +81,7 @@ XStatus XPfw_CoreConfigure(void);
 XStatus XPfw_CoreDispatchEvent( u32 EventId);
 const XPfw_Module_t *XPfw_CoreCreateMod(void);
 XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
+XStatus XPfw_CoreScheduleOneShotTask(const XPfw_Module_t *ModPtr, u32 Delay, VoidFunction_t CallbackRef);
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
 XStatus XPfw_CoreStopScheduler(void);
 XStatus XPfw_CoreLoop(void);
@@ -40,6 +40,13 @@
  */
 static u32 InterruptRegsiter;
 
+#ifdef ENABLE_DISPATCH_STATS
+/**
+ * Time stamp taken on entry to the top level interrupt handler
+ */
+static u32 InterruptTimeStamp;
+#endif
+
 /**
  * This list of IDs enables re-ordering of Events for GPI1 as per user's priority
  */
@@ -345,6 +352,9 @@ void XPfw_InterruptHandler(void)
 	u32 l_IrqReg;
 	u32 l_index;
 
+#ifdef ENABLE_DISPATCH_STATS
+	InterruptTimeStamp = XPfw_UtilTimeStamp();
+#endif
 	if (XST_SUCCESS == XPfw_CoreIsReady()) {
 		/* Latch the IRQ_PENDING register into a local variable */
 		l_IrqReg = XPfw_Read32(PMU_IOMODULE_IRQ_PENDING);
@@ -380,3 +390,10 @@ void XPfw_InterruptEnable(u32 Mask)
 	InterruptRegsiter = InterruptRegsiter | Mask;
 	XPfw_Write32(PMU_IOMODULE_IRQ_ENABLE, InterruptRegsiter);
 }
+
+#ifdef ENABLE_DISPATCH_STATS
+u32 XPfw_InterruptGetTimeStamp(void)
+{
+	return InterruptTimeStamp;
+}
+#endif
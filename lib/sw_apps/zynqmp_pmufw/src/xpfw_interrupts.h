@@ -38,6 +38,9 @@
 void XPfw_InterruptHandler(void) __attribute__ ((interrupt_handler));
 void XPfw_InterruptDisable(u32 Mask);
 void XPfw_InterruptEnable(u32 Mask);
+#ifdef ENABLE_DISPATCH_STATS
+u32 XPfw_InterruptGetTimeStamp(void);
+#endif
 void XPfw_InterruptStart(void);
 void XPfw_InterruptInit(void);
 
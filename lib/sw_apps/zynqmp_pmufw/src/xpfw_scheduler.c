@@ -37,6 +37,7 @@
 #define PMU_PIT_CLK_FREQ	4000000U
 #define TICK_MILLISECONDS	10U
 #define COUNT_PER_TICK ((PMU_PIT_CLK_FREQ / 1000U)* TICK_MILLISECONDS )
+#define COUNT_PER_MICROSECOND	(PMU_PIT_CLK_FREQ / 1000000U)
 
 /**
  * Microblaze IOModule PIT Register Offsets
@@ -46,6 +47,153 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
+/* Interrupt enable bit in the MicroBlaze MSR */
+#define MSR_IE_MASK	0x2U
+
+/* True if tick A is at or after tick B, tolerates Tick wrap around */
+#define TICK_REACHED(A, B)	((s32)((A) - (B)) >= 0)
+
+/**
+ * The task list is shared with the PIT1 handler, these mask interrupts
+ * around an update and restore the previous state, so they can be used
+ * from both the main loop and interrupt handlers
+ */
+static inline u32 XPfw_SchedulerLock(void)
+{
+	u32 Msr = mfmsr();
+	microblaze_disable_interrupts();
+	return Msr;
+}
+
+static inline void XPfw_SchedulerUnlock(u32 Msr)
+{
+	if ((Msr & MSR_IE_MASK) != 0U) {
+		microblaze_enable_interrupts();
+	}
+}
+
+/**
+ * Time since the scheduler start in PIT counts. Wraps around every
+ * ~1000 seconds, only meant for measuring short intervals.
+ */
+static u32 XPfw_SchedulerGetTime(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Tick;
+	u32 Count;
+
+	/* Re-read if the tick handler ran in between */
+	do {
+		Tick = SchedPtr->Tick;
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+	} while (Tick != SchedPtr->Tick);
+
+	return (Tick * COUNT_PER_TICK) + (COUNT_PER_TICK - Count);
+}
+
+/* Convert a time period in milliseconds into scheduler ticks, at least 1 */
+static u32 XPfw_SchedulerMsToTicks(u32 MilliSeconds)
+{
+	u32 Ticks = MilliSeconds / TICK_MILLISECONDS;
+
+	if (Ticks == 0U) {
+		Ticks = 1U;
+	}
+
+	return Ticks;
+}
+
+/* Insert a task in the timer list, keeping the list ordered by Expiry */
+static void XPfw_SchedulerArm(XPfw_Scheduler_t *SchedPtr, u8 Idx)
+{
+	struct XPfw_Task_t *TaskPtr = &SchedPtr->TaskList[Idx];
+	u8 *LinkPtr = &SchedPtr->TimerHead;
+
+	while ((*LinkPtr != XPFW_SCHED_NO_TASK) &&
+		TICK_REACHED(TaskPtr->Expiry, SchedPtr->TaskList[*LinkPtr].Expiry)) {
+		LinkPtr = &SchedPtr->TaskList[*LinkPtr].Next;
+	}
+
+	TaskPtr->Next = *LinkPtr;
+	*LinkPtr = Idx;
+}
+
+/* Take a task out of the timer list, if it is in there */
+static void XPfw_SchedulerDisarm(XPfw_Scheduler_t *SchedPtr, u8 Idx)
+{
+	u8 *LinkPtr = &SchedPtr->TimerHead;
+
+	while (*LinkPtr != XPFW_SCHED_NO_TASK) {
+		if (*LinkPtr == Idx) {
+			*LinkPtr = SchedPtr->TaskList[Idx].Next;
+			break;
+		}
+		LinkPtr = &SchedPtr->TaskList[*LinkPtr].Next;
+	}
+}
+
+/* Return a task entry to the free list */
+static void XPfw_SchedulerFreeTask(XPfw_Scheduler_t *SchedPtr, u8 Idx)
+{
+	struct XPfw_Task_t *TaskPtr = &SchedPtr->TaskList[Idx];
+
+	TaskPtr->Interval = 0U;
+	TaskPtr->OwnerId = 0U;
+	TaskPtr->Callback = NULL;
+	TaskPtr->Status = XPFW_TASK_STATUS_DISABLED;
+	TaskPtr->Next = SchedPtr->FreeHead;
+	SchedPtr->FreeHead = Idx;
+	SchedPtr->TriggerMask &= ~((u32)1U << Idx);
+	SchedPtr->TaskCount--;
+}
+
+static XStatus XPfw_SchedulerAdd(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,
+		u32 MilliSeconds, XPfw_Callback_t Callback, u8 Type)
+{
+	struct XPfw_Task_t *TaskPtr;
+	XStatus Status;
+	u32 Msr;
+	u8 Idx;
+
+	if ((SchedPtr == NULL) || (Callback == NULL)) {
+		Status = XST_FAILURE;
+		goto done;
+	}
+
+	Msr = XPfw_SchedulerLock();
+
+	/* Get the Next Free Task Index */
+	Idx = SchedPtr->FreeHead;
+
+	/* Check if we have reached Max Task limit */
+	if (XPFW_SCHED_NO_TASK == Idx) {
+		XPfw_SchedulerUnlock(Msr);
+		Status = XST_FAILURE;
+		goto done;
+	}
+
+	TaskPtr = &SchedPtr->TaskList[Idx];
+	SchedPtr->FreeHead = TaskPtr->Next;
+	SchedPtr->TaskCount++;
+
+	/* Add Interval as a factor of TICK_MILLISECONDS */
+	TaskPtr->Interval = XPfw_SchedulerMsToTicks(MilliSeconds);
+	TaskPtr->OwnerId = OwnerId;
+	TaskPtr->Callback = Callback;
+	TaskPtr->Status = XPFW_TASK_STATUS_DISABLED;
+	TaskPtr->Type = Type;
+	TaskPtr->Expiry = SchedPtr->Tick + TaskPtr->Interval;
+	TaskPtr->RunCount = 0U;
+	TaskPtr->MissCount = 0U;
+	TaskPtr->MaxExecTime = 0U;
+	XPfw_SchedulerArm(SchedPtr, Idx);
+
+	XPfw_SchedulerUnlock(Msr);
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
 XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 {
 	u32 Idx;
@@ -56,13 +204,19 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 		goto done;
 	}
 
-	/* Disable all the tasks */
+	/* Disable all the tasks and chain them in the free list */
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
 		SchedPtr->TaskList[Idx].Interval = 0U;
 		SchedPtr->TaskList[Idx].Callback = NULL;
 		SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+		SchedPtr->TaskList[Idx].Next = (u8)(Idx + 1U);
 	}
+	SchedPtr->TaskList[XPFW_SCHED_MAX_TASK - 1U].Next = XPFW_SCHED_NO_TASK;
 
+	SchedPtr->FreeHead = 0U;
+	SchedPtr->TimerHead = XPFW_SCHED_NO_TASK;
+	SchedPtr->TriggerMask = 0U;
+	SchedPtr->TaskCount = 0U;
 	SchedPtr->Enabled = FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
@@ -107,35 +261,100 @@ XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
-	u32 Idx;
-	/* TODO: Add check to detect task misses */
+	struct XPfw_Task_t *TaskPtr;
+	u8 Idx;
+
 	SchedPtr->Tick++;
-	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
-		/* Check if it this task can be triggered */
-		if ((0U != SchedPtr->TaskList[Idx].Interval) &&
-			(NULL != SchedPtr->TaskList[Idx].Callback) &&
-			(0U == (SchedPtr->Tick % SchedPtr->TaskList[Idx].Interval))) {
-			/* Mark the Task as TRIGGERED */
-			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
+
+	/*
+	 * The timer list is ordered by expiry, so only the head needs to be
+	 * checked. Tasks which are due are moved to the trigger mask and
+	 * periodic ones are re-armed for their next period.
+	 */
+	while ((SchedPtr->TimerHead != XPFW_SCHED_NO_TASK) &&
+		TICK_REACHED(SchedPtr->Tick,
+			SchedPtr->TaskList[SchedPtr->TimerHead].Expiry)) {
+		Idx = SchedPtr->TimerHead;
+		TaskPtr = &SchedPtr->TaskList[Idx];
+		SchedPtr->TimerHead = TaskPtr->Next;
+
+		/* Previous trigger has not been processed yet */
+		if (XPFW_TASK_STATUS_TRIGGERED == TaskPtr->Status) {
+			TaskPtr->MissCount++;
+		}
+
+		/* Mark the Task as TRIGGERED */
+		TaskPtr->Status = XPFW_TASK_STATUS_TRIGGERED;
+		SchedPtr->TriggerMask |= ((u32)1U << Idx);
+
+		if (XPFW_TASK_TYPE_PERIODIC == TaskPtr->Type) {
+			TaskPtr->Expiry += TaskPtr->Interval;
+			XPfw_SchedulerArm(SchedPtr, Idx);
 		}
 	}
 }
 
 XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 {
-	u32 Idx;
+	struct XPfw_Task_t *TaskPtr;
+	XPfw_Callback_t Callback;
 	XStatus Status;
 	u32 CallCount = 0U;
+	u32 StartTime;
+	u32 ExecTime;
+	u32 Msr;
+	u8 Type;
+	u8 Idx;
 
-	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
-		/* Check if the task is triggered and has a valid Callback */
-		if ((XPFW_TASK_STATUS_TRIGGERED == SchedPtr->TaskList[Idx].Status) &&
-			(NULL != SchedPtr->TaskList[Idx].Callback)) {
-			/* Execute the Task */
-			SchedPtr->TaskList[Idx].Callback();
-			/* Disable the executed Task */
-			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
-			CallCount++;
+	while (SchedPtr->TriggerMask != 0U) {
+		Msr = XPfw_SchedulerLock();
+
+		/* The mask may have been cleared (e.g. task removed) before the lock */
+		if (SchedPtr->TriggerMask == 0U) {
+			XPfw_SchedulerUnlock(Msr);
+			break;
+		}
+
+		/* Pick the lowest triggered task and disable it */
+		Idx = 0U;
+		while ((SchedPtr->TriggerMask & ((u32)1U << Idx)) == 0U) {
+			Idx++;
+		}
+		TaskPtr = &SchedPtr->TaskList[Idx];
+		SchedPtr->TriggerMask &= ~((u32)1U << Idx);
+		TaskPtr->Status = XPFW_TASK_STATUS_DISABLED;
+		Callback = TaskPtr->Callback;
+		Type = TaskPtr->Type;
+
+		/* One-shot tasks are done with their only trigger */
+		if (XPFW_TASK_TYPE_ONESHOT == Type) {
+			XPfw_SchedulerFreeTask(SchedPtr, Idx);
+		}
+
+		XPfw_SchedulerUnlock(Msr);
+
+		if (NULL == Callback) {
+			continue;
+		}
+
+		/* Execute the Task */
+		StartTime = XPfw_SchedulerGetTime(SchedPtr);
+		Callback();
+		ExecTime = XPfw_SchedulerGetTime(SchedPtr) - StartTime;
+		CallCount++;
+
+		if (XPFW_TASK_TYPE_PERIODIC == Type) {
+			Msr = XPfw_SchedulerLock();
+
+			/* Skip if the task was removed by its own callback */
+			if (Callback == TaskPtr->Callback) {
+				TaskPtr->RunCount++;
+				if (ExecTime > TaskPtr->MaxExecTime) {
+					TaskPtr->MaxExecTime = ExecTime;
+				}
+			}
+
+			XPfw_SchedulerUnlock(Msr);
 		}
 	}
 
@@ -151,51 +370,64 @@ XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t Callback)
 {
-	u32 Idx;
-	XStatus Status;
-
-	/* Get the Next Free Task Index */
-	for (Idx=0U;Idx < XPFW_SCHED_MAX_TASK;Idx++) {
-		if (0U == SchedPtr->TaskList[Idx].Interval) {
-			break;
-		}
-	}
-
-	/* Check if we have reached Max Task limit */
-	if (XPFW_SCHED_MAX_TASK == Idx) {
-		Status = XST_FAILURE;
-		goto done;
-	}
-
-	/* Add Interval as a factor of TICK_MILLISECONDS */
-	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
-	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
-	SchedPtr->TaskList[Idx].Callback = Callback;
-	Status = XST_SUCCESS;
+	return XPfw_SchedulerAdd(SchedPtr, OwnerId, MilliSeconds, Callback,
+			XPFW_TASK_TYPE_PERIODIC);
+}
 
-done:
-	return Status;
+XStatus XPfw_SchedulerAddOneShotTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t Callback)
+{
+	return XPfw_SchedulerAdd(SchedPtr, OwnerId, MilliSeconds, Callback,
+			XPFW_TASK_TYPE_ONESHOT);
 }
 
 XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t Callback)
 {
 	u32 Idx;
 	u32 TaskCount = 0;
+	u32 Msr;
+
+	Msr = XPfw_SchedulerLock();
 
 	/*Find the Task Index */
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
-		if ((Callback == SchedPtr->TaskList[Idx].Callback) &&
+		if ((NULL != SchedPtr->TaskList[Idx].Callback) &&
+		    (Callback == SchedPtr->TaskList[Idx].Callback) &&
 		    (SchedPtr->TaskList[Idx].OwnerId == OwnerId) &&
-		    ((SchedPtr->TaskList[Idx].Interval == MilliSeconds/TICK_MILLISECONDS) ||
+		    ((SchedPtr->TaskList[Idx].Interval ==
+				XPfw_SchedulerMsToTicks(MilliSeconds)) ||
 				(0U == MilliSeconds))) {
-			SchedPtr->TaskList[Idx].Interval = 0U;
-			SchedPtr->TaskList[Idx].OwnerId = 0U;
-			SchedPtr->TaskList[Idx].Callback = NULL;
+			XPfw_SchedulerDisarm(SchedPtr, (u8)Idx);
+			XPfw_SchedulerFreeTask(SchedPtr, (u8)Idx);
 			TaskCount++;
 		}
 	}
 
+	XPfw_SchedulerUnlock(Msr);
+
 	fw_printf("%s: Removed %d tasks\r\n", __func__, TaskCount);
 
 	return ((TaskCount > 0) ? XST_SUCCESS : XST_FAILURE);
 }
+
+void XPfw_SchedulerPrintStats(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Idx;
+	const struct XPfw_Task_t *TaskPtr;
+
+	fw_printf("Scheduler Tasks: %d (%d)\r\n", SchedPtr->TaskCount,
+			XPFW_SCHED_MAX_TASK);
+
+	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		TaskPtr = &SchedPtr->TaskList[Idx];
+		if (NULL == TaskPtr->Callback) {
+			continue;
+		}
+		fw_printf("  Task %d: Mod %d %s %d ms, Runs %d, Missed %d, "
+				"WCET %d us\r\n", Idx, TaskPtr->OwnerId,
+				((XPFW_TASK_TYPE_ONESHOT == TaskPtr->Type) ?
+						"one-shot" : "every"),
+				TaskPtr->Interval * TICK_MILLISECONDS,
+				TaskPtr->RunCount, TaskPtr->MissCount,
+				TaskPtr->MaxExecTime / COUNT_PER_MICROSECOND);
+	}
+}
@@ -33,12 +33,20 @@
 
 #include "xpfw_default.h"
 
-#define XPFW_SCHED_MAX_TASK	10U
+/* Not more than 32, triggered tasks are tracked in a 32-bit mask */
+#define XPFW_SCHED_MAX_TASK	16U
 
 /* Values for TaskPtr->Status */
 #define XPFW_TASK_STATUS_TRIGGERED	0x5AFEC0C0U
 #define XPFW_TASK_STATUS_DISABLED	0x00000000U
 
+/* Values for TaskPtr->Type */
+#define XPFW_TASK_TYPE_PERIODIC	0U
+#define XPFW_TASK_TYPE_ONESHOT	1U
+
+/* Marks the end of the timer and free lists */
+#define XPFW_SCHED_NO_TASK	0xFFU
+
 typedef void (*XPfw_Callback_t) (void);
 
 struct XPfw_Task_t{
@@ -46,6 +54,13 @@ struct XPfw_Task_t{
 	u32 OwnerId;
 	u32 Status;
 	XPfw_Callback_t Callback;
+	u32 Expiry;		/**< Tick at which the task is due next */
+	u32 RunCount;		/**< Number of times the task has run */
+	u32 MissCount;		/**< Triggers missed as the previous one was
+				  *  still pending */
+	u32 MaxExecTime;	/**< Worst case execution time in PIT counts */
+	u8 Type;		/**< XPFW_TASK_TYPE_PERIODIC or _ONESHOT */
+	u8 Next;		/**< Next task in the timer list or free list */
 };
 
 typedef struct {
@@ -54,6 +69,9 @@ typedef struct {
 	u32 PitBaseAddr;
 	u32 Tick;
 	u32 Enabled;
+	u32 TriggerMask;	/**< Tasks triggered and waiting to be run */
+	u8 TimerHead;		/**< Armed tasks, ordered by Expiry */
+	u8 FreeHead;		/**< Unused entries of TaskList */
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -62,6 +80,8 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t Callback);
+XStatus XPfw_SchedulerAddOneShotTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t Callback);
 XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t Callback);
+void XPfw_SchedulerPrintStats(const XPfw_Scheduler_t *SchedPtr);
 
 #endif /* XPFW_SCHEDULER_H_ */
@@ -46,6 +46,9 @@
 #include "xpfw_mod_em.h"
 
 #ifdef ENABLE_PM
+/* Period of PM API latency reports */
+#define PM_LATENCY_REPORT_MS	10000U
+
 static void PmIpiHandler(const XPfw_Module_t *ModPtr, u32 IpiNum, u32 SrcMask)
 {
 	u32 isrVal, isrClr, apiId;
@@ -154,6 +157,11 @@ static void PmCfgInit(const XPfw_Module_t *ModPtr, const u32 *CfgData, u32 Len)
  * all modules should use Register/DeRegister Event
  */
 	XPfw_PmInit();
+
+#if defined(ENABLE_PM_LATENCY) && defined(ENABLE_SCHEDULER)
+	(void)XPfw_CoreScheduleTask(ModPtr, PM_LATENCY_REPORT_MS,
+				    XPfw_PmPrintLatency);
+#endif
 }
 static void ModPmInit(void)
 {
@@ -32,6 +32,7 @@
 
 #include "xil_io.h"
 #include "xpfw_util.h"
+#include "pmu_iomodule.h"
 
 void XPfw_UtilRMW(u32 RegAddress, u32 Mask, u32 Value)
 {
@@ -101,3 +102,18 @@ void XPfw_UtilWait(u32 TimeOutCount)
 		TimeOut--;
 	}
 }
+
+void XPfw_UtilTimeStampInit(void)
+{
+	Xil_Out32(PMU_IOMODULE_PIT2_PRELOAD, 0xFFFFFFFFU);
+	/* Enable with reload, so the counter never stops */
+	Xil_Out32(PMU_IOMODULE_PIT2_CONTROL,
+		  PMU_IOMODULE_PIT2_CONTROL_PRELOAD_MASK |
+		  PMU_IOMODULE_PIT2_CONTROL_EN_MASK);
+}
+
+u32 XPfw_UtilTimeStamp(void)
+{
+	/* PIT counts down, invert to get an increasing value */
+	return ~Xil_In32(PMU_IOMODULE_PIT2_COUNTER);
+}
@@ -71,5 +71,25 @@ XStatus XPfw_UtilPollForZero(u32 RegAddress, u32 Mask, u32 TimeOutCount);
  */
 void XPfw_UtilWait(u32 TimeOutCount);
 
+/**
+ * Time stamps are counted in PIT clock cycles
+ */
+#define XPFW_UTIL_TIMESTAMP_FREQ	4000000U
+#define XPFW_UTIL_TIMESTAMP_PER_US	(XPFW_UTIL_TIMESTAMP_FREQ / 1000000U)
+
+/**
+ * Start PIT2 as a free running counter used for time stamps.
+ * PIT2 is not used by any other part of the firmware.
+ */
+void XPfw_UtilTimeStampInit(void);
+
+/**
+ * Get current time stamp. The value wraps around every 2^32 counts,
+ * so only differences of time stamps are meaningful.
+ *
+ * @return Time stamp in PIT clock cycles
+ */
+u32 XPfw_UtilTimeStamp(void);
+
 
 #endif /* XPFW_UTIL_H_ */
@@ -0,0 +1,234 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+/*
+ *
+ * CONTENT
+ * Compares the cost of bringing up a set of slaves with one IPI round trip
+ * per PM call against sending the same calls to the PMU as one batch.
+ * 1) PROCESSOR requests and then sets requirements of each slave using
+ *    blocking XPm_RequestNode/XPm_SetRequirement calls, and releases them.
+ * 2) PROCESSOR packs the same calls into a batch and sends it using
+ *    XPm_BatchSend, then releases the slaves using a second batch.
+ * 3) Status of each call, number of IPI round trips and time spent are
+ *    printed for both runs.
+ */
+
+#include <xil_printf.h>
+#include <xil_cache.h>
+#include <xstatus.h>
+#include <xtime_l.h>
+#include "pm_api_sys.h"
+#include "pm_client.h"
+
+/* Number of times each run is repeated */
+#define BATCH_EXAMPLE_ITERATIONS	10U
+
+#ifdef __aarch64__
+static const enum XPmNodeId Slaves[] = {
+	NODE_USB_0,
+	NODE_USB_1,
+	NODE_TTC_0,
+	NODE_GPU_PP_0,
+	NODE_GPU_PP_1,
+};
+#else
+static const enum XPmNodeId Slaves[] = {
+	NODE_USB_0,
+	NODE_USB_1,
+	NODE_TTC_0,
+};
+#endif
+
+#define SLAVE_CNT	(sizeof(Slaves) / sizeof(Slaves[0]))
+
+static struct XPm_Batch Batch;
+
+/**
+ * RunSingleCalls() - bring up and release slaves with one request per call
+ * @RoundTrips	Incremented by the number of IPI round trips used
+ *
+ * @return	XST_SUCCESS if all calls have succeeded, XST_FAILURE otherwise
+ */
+static u32 RunSingleCalls(u32 *RoundTrips)
+{
+	u32 i;
+	u32 Status = XST_SUCCESS;
+	enum XPmStatus Ret;
+
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		Ret = XPm_RequestNode(Slaves[i], PM_CAP_ACCESS, 0,
+				      REQUEST_ACK_BLOCKING);
+		(*RoundTrips)++;
+		if (PM_RET_SUCCESS != Ret) {
+			xil_printf("RequestNode(%d) failed - code %d\r\n",
+				   Slaves[i], Ret);
+			Status = XST_FAILURE;
+		}
+	}
+
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		Ret = XPm_SetRequirement(Slaves[i], PM_CAP_ACCESS, MAX_QOS,
+					 REQUEST_ACK_BLOCKING);
+		(*RoundTrips)++;
+		if (PM_RET_SUCCESS != Ret) {
+			xil_printf("SetRequirement(%d) failed - code %d\r\n",
+				   Slaves[i], Ret);
+			Status = XST_FAILURE;
+		}
+	}
+
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		XPm_ReleaseNode(Slaves[i], 0);
+		(*RoundTrips)++;
+	}
+
+	return Status;
+}
+
+/**
+ * SendBatch() - send the batch and report status of each failed call
+ * @RoundTrips	Incremented by the number of IPI round trips used
+ *
+ * @return	XST_SUCCESS if all calls have succeeded, XST_FAILURE otherwise
+ */
+static u32 SendBatch(u32 *RoundTrips)
+{
+	u32 i;
+	u32 Processed = 0U;
+	enum XPmStatus Ret;
+
+	Ret = XPm_BatchSend(&Batch, 0U, &Processed);
+	(*RoundTrips)++;
+	if (PM_RET_SUCCESS == Ret) {
+		return XST_SUCCESS;
+	}
+
+	for (i = 0U; i < Processed; i++) {
+		Ret = XPm_BatchGetStatus(&Batch, i, NULL);
+		if (PM_RET_SUCCESS != Ret) {
+			xil_printf("Batch call #%d (api %d) failed - code %d\r\n",
+				   i, Batch.call[i].api, Ret);
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/**
+ * RunBatchedCalls() - bring up and release slaves using batches
+ * @RoundTrips	Incremented by the number of IPI round trips used
+ *
+ * @return	XST_SUCCESS if all calls have succeeded, XST_FAILURE otherwise
+ */
+static u32 RunBatchedCalls(u32 *RoundTrips)
+{
+	u32 i;
+	u32 Status;
+
+	XPm_BatchInit(&Batch);
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		XPm_BatchAdd(&Batch, PM_REQUEST_NODE, Slaves[i], PM_CAP_ACCESS,
+			     0, REQUEST_ACK_BLOCKING);
+	}
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		XPm_BatchAdd(&Batch, PM_SET_REQUIREMENT, Slaves[i],
+			     PM_CAP_ACCESS, MAX_QOS, REQUEST_ACK_BLOCKING);
+	}
+	Status = SendBatch(RoundTrips);
+
+	XPm_BatchInit(&Batch);
+	for (i = 0U; i < SLAVE_CNT; i++) {
+		XPm_BatchAdd(&Batch, PM_RELEASE_NODE, Slaves[i], 0, 0, 0);
+	}
+	if (XST_SUCCESS != SendBatch(RoundTrips)) {
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
+/**
+ * ReportRun() - print round trips and average time of one run
+ */
+static void ReportRun(const char *Name, const u32 RoundTrips,
+		      const XTime Start, const XTime End)
+{
+	u32 Us = (u32)(((End - Start) * 1000000U) /
+		       (COUNTS_PER_SECOND * BATCH_EXAMPLE_ITERATIONS));
+
+	xil_printf("%s: %d IPI round trips, %d us per iteration\r\n", Name,
+		   RoundTrips / BATCH_EXAMPLE_ITERATIONS, Us);
+}
+
+int main(void)
+{
+	u32 i;
+	u32 Status = XST_SUCCESS;
+	u32 SingleTrips = 0U;
+	u32 BatchTrips = 0U;
+	XTime Start, End;
+
+	Xil_DCacheEnable();
+
+	xil_printf("PM batch example: %d slaves, %d iterations\r\n",
+		   SLAVE_CNT, BATCH_EXAMPLE_ITERATIONS);
+
+	XTime_GetTime(&Start);
+	for (i = 0U; i < BATCH_EXAMPLE_ITERATIONS; i++) {
+		if (XST_SUCCESS != RunSingleCalls(&SingleTrips)) {
+			Status = XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	ReportRun("Single calls", SingleTrips, Start, End);
+
+	XTime_GetTime(&Start);
+	for (i = 0U; i < BATCH_EXAMPLE_ITERATIONS; i++) {
+		if (XST_SUCCESS != RunBatchedCalls(&BatchTrips)) {
+			Status = XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	ReportRun("Batched calls", BatchTrips, Start, End);
+
+	xil_printf("Round trips saved per iteration: %d\r\n",
+		   (SingleTrips - BatchTrips) / BATCH_EXAMPLE_ITERATIONS);
+
+	if (XST_SUCCESS != Status) {
+		xil_printf("PM batch example failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran PM batch example\r\n");
+	return XST_SUCCESS;
+}
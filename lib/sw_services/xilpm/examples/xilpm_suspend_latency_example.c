@@ -0,0 +1,350 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+/*
+ *
+ * CONTENT
+ * Measures suspend-to-idle and resume latency of the PROCESSOR and the time
+ * needed to find out node states after resume with and without an IPI.
+ * 1) PROCESSOR configures timer0, registers a status page in memory that is
+ *    retained during suspend and measures the cost of one IPI round trip
+ *    against reading a node state from the status page.
+ * 2) After few timer ticks PROCESSOR saves its context and suspends itself,
+ *    measuring how long the self suspend request takes.
+ * 3) Timer interrupt wakes the PROCESSOR up. On resume it reads its own
+ *    state from the status page, without an IPI, and prints the breakdown:
+ *    PMU time stamps (request processed, sleep, wake, running) published in
+ *    the status page and the PROCESSOR's own measurements.
+ * 4) PROCESSOR waits for few more timer ticks and repeats the procedure.
+ */
+
+#include <xil_exception.h>
+#include <xil_printf.h>
+#include <xil_io.h>
+#include <xil_cache.h>
+#include <xstatus.h>
+#include <xtime_l.h>
+#include "pm_api_sys.h"
+#include "timer.h"
+#include "pm_client.h"
+
+extern void *_vector_table;
+
+/* Number of reads used to measure the cost of getting a node state */
+#define LATENCY_EXAMPLE_ITERATIONS	100U
+
+#ifdef __aarch64__
+	/* Use OCM for saving context */
+	#define CONTEXT_MEM_BASE	0xFFFC0000U
+	/* Last 4KB of OCM bank 0, retained with the context */
+	#define STATUS_PAGE_BASE	0xFFFCF000U
+	#define SELF_NODE		NODE_APU_0
+#else
+	/* Use TCM for saving context */
+	#define CONTEXT_MEM_BASE	0x8000U
+	/*
+	 * Last 4KB of RPU0 ATCM through its global address, must not be used
+	 * by the linker script
+	 */
+	#define STATUS_PAGE_BASE	0xFFE0F000U
+	#define SELF_NODE		NODE_RPU_0
+#endif
+
+#define StatusPage	((struct XPm_StatusPage *)STATUS_PAGE_BASE)
+
+/* The below sections will be saved during suspend */
+extern u8 __data_start;
+extern u8 __bss_start__;
+extern u8 __data_end;
+extern u8 __bss_end__;
+
+/* Measured before suspend, restored with the context on resume */
+static XTime SuspendStart;
+static XTime SuspendAck;
+static u32 IpiRoundTripNs;
+static u32 CachedReadNs;
+
+/**
+ * SaveContext() - called to save context of bss and data sections
+ */
+static void SaveContext(void)
+{
+	u8 *MemPtr;
+	u8 *ContextMemPtr = (u8 *)CONTEXT_MEM_BASE;
+
+	for (MemPtr = &__data_start; MemPtr < &__data_end; MemPtr++, ContextMemPtr++) {
+		*ContextMemPtr = *MemPtr;
+	}
+
+	for (MemPtr = &__bss_start__; MemPtr < &__bss_end__; MemPtr++, ContextMemPtr++) {
+		*ContextMemPtr = *MemPtr;
+	}
+}
+
+/**
+ * RestoreContext() - called to restore context of bss and data sections
+ */
+static void RestoreContext(void)
+{
+	u8 *MemPtr;
+	u8 *ContextMemPtr = (u8 *)CONTEXT_MEM_BASE;
+
+	for (MemPtr = &__data_start; MemPtr < &__data_end; MemPtr++, ContextMemPtr++) {
+		*MemPtr = *ContextMemPtr;
+	}
+
+	for (MemPtr = &__bss_start__; MemPtr < &__bss_end__; MemPtr++, ContextMemPtr++) {
+		*MemPtr = *ContextMemPtr;
+	}
+}
+
+static u32 GetCpuId(void)
+{
+#ifdef __aarch64__
+	u64 id;
+
+	__asm__ volatile("mrs	%0, MPIDR_EL1\n"
+			: "=r"(id)
+	);
+#else
+	u32 id;
+
+	__asm__ volatile("mrc	p15, 0, %0, c0, c0, 5\n"
+			: "=r"(id)
+	);
+#endif
+
+	return id & 0xff;
+}
+
+/**
+ * CountsToNs() - convert a duration in XTime counts to nanoseconds
+ */
+static u32 CountsToNs(const XTime Counts)
+{
+	return (u32)((Counts * 1000000000U) / COUNTS_PER_SECOND);
+}
+
+/**
+ * PmuTsToUs() - convert a duration in PMU time stamp counts to microseconds
+ */
+static u32 PmuTsToUs(const u32 Counts, const u32 Freq)
+{
+	return (u32)(((u64)Counts * 1000000U) / Freq);
+}
+
+/**
+ * MeasureStatusRead() - compare IPI round trip with a status page read
+ *
+ * @return	XST_SUCCESS if both ways of reading have succeeded
+ */
+static u32 MeasureStatusRead(void)
+{
+	u32 i, Version, State;
+	XTime Start, End;
+	enum XPmStatus Ret = PM_RET_SUCCESS;
+
+	XTime_GetTime(&Start);
+	for (i = 0U; (i < LATENCY_EXAMPLE_ITERATIONS) && (PM_RET_SUCCESS == Ret); i++) {
+		Ret = XPm_GetApiVersion(&Version);
+	}
+	XTime_GetTime(&End);
+	IpiRoundTripNs = CountsToNs(End - Start) / LATENCY_EXAMPLE_ITERATIONS;
+
+	XTime_GetTime(&Start);
+	for (i = 0U; (i < LATENCY_EXAMPLE_ITERATIONS) && (PM_RET_SUCCESS == Ret); i++) {
+		Ret = XPm_GetNodeStatusCached(SELF_NODE, &State);
+	}
+	XTime_GetTime(&End);
+	CachedReadNs = CountsToNs(End - Start) / LATENCY_EXAMPLE_ITERATIONS;
+
+	return (PM_RET_SUCCESS == Ret) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/**
+ * ReportResume() - print the suspend/resume breakdown
+ * @ResumeStart	Time when the PROCESSOR started executing after wake-up
+ * @StateKnown	Time when the PROCESSOR has read its state after wake-up
+ */
+static void ReportResume(const XTime ResumeStart, const XTime StateKnown)
+{
+	struct XPm_StatusPage Snapshot;
+
+	if (PM_RET_SUCCESS != XPm_GetStatusSnapshot(&Snapshot)) {
+		xil_printf("Status page is not available\r\n");
+		return;
+	}
+
+	xil_printf("Wake-up #%d\r\n", Snapshot.wake_count);
+	xil_printf("  self suspend request (IPI round trip): %d ns\r\n",
+		   CountsToNs(SuspendAck - SuspendStart));
+	xil_printf("  PMU: request processed to sleep:       %d us\r\n",
+		   PmuTsToUs(Snapshot.ts_sleep - Snapshot.ts_suspend,
+			     Snapshot.ts_freq));
+	xil_printf("  PMU: asleep:                           %d us\r\n",
+		   PmuTsToUs(Snapshot.ts_wake - Snapshot.ts_sleep,
+			     Snapshot.ts_freq));
+	xil_printf("  PMU: wake-up processing:               %d us\r\n",
+		   PmuTsToUs(Snapshot.ts_active - Snapshot.ts_wake,
+			     Snapshot.ts_freq));
+	xil_printf("  resume to state known (no IPI):        %d ns\r\n",
+		   CountsToNs(StateKnown - ResumeStart));
+	xil_printf("  node state read: IPI %d ns, status page %d ns\r\n",
+		   IpiRoundTripNs, CachedReadNs);
+}
+
+/**
+ * PrepareSuspend() - request suspend and save context
+ */
+static void PrepareSuspend(void)
+{
+#ifdef __aarch64__
+	u64 rvbar;
+	u64 vector_base = (u64)&_vector_table;
+
+	/* APU */
+	XTime_GetTime(&SuspendStart);
+	XPm_SelfSuspend(NODE_APU_0, MAX_LATENCY, 0);
+	XTime_GetTime(&SuspendAck);
+	XPm_SetRequirement(NODE_OCM_BANK_0, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_OCM_BANK_1, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_OCM_BANK_2, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_OCM_BANK_3, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+
+	/*
+	 * Set RVBAR to ensure we resume at the expected address
+	 * FIXME: This should be communicated to FW which has to set this.
+	 */
+	rvbar = APU_RVBARADDR0L;
+	rvbar += 8 * GetCpuId();
+	Xil_Out32(rvbar, vector_base & 0xffffffff);
+	rvbar += 4;
+	Xil_Out32(rvbar, vector_base >> 32);
+#else
+	u32 reg, rpuctrl;
+	u32 vector_base = (u32)&_vector_table;
+
+	/* RPU */
+	XTime_GetTime(&SuspendStart);
+	XPm_SelfSuspend(NODE_RPU_0, MAX_LATENCY, 0);
+	XTime_GetTime(&SuspendAck);
+	XPm_SetRequirement(NODE_TCM_0_A, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_TCM_0_B, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_TCM_1_A, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+	XPm_SetRequirement(NODE_TCM_1_B, PM_CAP_CONTEXT, 0, REQUEST_ACK_NO);
+
+	/*
+	 * Set VINITH to ensure we resume at the expected address
+	 * FIXME: This should be communicated to FW which has to set this.
+	 */
+	if (GetCpuId() == 0U) {
+		rpuctrl = RPU_RPU_0_CFG;
+	} else {
+		rpuctrl = RPU_RPU_1_CFG;
+	}
+
+	reg = Xil_In32(rpuctrl);
+	if (vector_base == 0) {
+		reg &= ~RPU_RPU_0_CFG_VINITHI_MASK;
+	} else {
+		reg |= RPU_RPU_0_CFG_VINITHI_MASK;
+	}
+	Xil_Out32(rpuctrl, reg);
+#endif /* __aarch64__ */
+
+	/* Saved last, so the measured times are restored on resume */
+	SaveContext();
+}
+
+/**
+ * InitApp() - initialize interrupts, context and the status page
+ */
+static u32 InitApp(void)
+{
+	XTime ResumeStart, StateKnown;
+	u32 State;
+	enum XPmBootStatus status;
+
+	XTime_GetTime(&ResumeStart);
+	status = XPm_GetBootStatus();
+
+	if (PM_INITIAL_BOOT == status) {
+		/* Configure timer, if configuration fails return from main */
+		if (XST_FAILURE == TimerConfigure(TIMER_PERIOD)) {
+			xil_printf("Exiting main...\r\n");
+			return XST_FAILURE;
+		}
+		if (PM_RET_SUCCESS != XPm_SetStatusPage(StatusPage)) {
+			xil_printf("Status page is not supported by PMU\r\n");
+			return XST_FAILURE;
+		}
+		if (XST_SUCCESS != MeasureStatusRead()) {
+			return XST_FAILURE;
+		}
+	} else if (PM_RESUME == status) {
+		/* Registered status page pointer is part of the context */
+		RestoreContext();
+		(void)XPm_GetNodeStatusCached(SELF_NODE, &State);
+		XTime_GetTime(&StateKnown);
+		/* Timer is already counting, just enable interrupts */
+		Xil_ExceptionEnable();
+		ReportResume(ResumeStart, StateKnown);
+	} else {
+		xil_printf("ERROR cannot identify boot reason\r\n");
+	}
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	Xil_DCacheDisable();
+	u32 Status = InitApp();
+
+	if (XST_SUCCESS != Status) {
+		return XST_FAILURE;
+	}
+
+	/* Wait for 3 timer ticks */
+	while ((TickCount + 1) % 4);
+
+	PrepareSuspend();
+	__asm__("wfi");
+
+	/*
+	 * Can execute code below only if interrupt is generated between calling
+	 * the PrepareSuspend and executing wfi. Shouldn't happen.
+	 */
+	xil_printf("Error! WFI exit...\r\n");
+
+	return XST_FAILURE;
+}
@@ -34,6 +34,8 @@
 #include "pm_common.h"
 #include "pm_api_sys.h"
 #include "pm_ipi_buffer.h"
+#include <xil_cache.h>
+#include <xpseudo_asm.h>
 
 /**
  * Assigning of argument values into array elements.
@@ -453,3 +455,229 @@ enum XPmStatus XPm_GetNodeStatus(const enum XPmNodeId node)
 	PACK_PAYLOAD(payload, PM_GET_NODE_STATUS, node, 0, 0, 0);
 	return pm_ipi_send(primary_master, payload);
 }
+
+/* API functions for batching of PM calls */
+
+/**
+ * XPm_BatchInit() - Prepare an empty batch of PM calls
+ * @batch	Batch to be initialized
+ */
+void XPm_BatchInit(struct XPm_Batch *const batch)
+{
+	batch->count = 0;
+}
+
+/**
+ * XPm_BatchAdd() - Append a PM call to the batch
+ * @batch	Batch the call is added to
+ * @api		API id of the call
+ * @arg0..arg3	Arguments of the call, as they would be passed in IPI payload
+ *
+ * Calls are executed by the PMU in the order they were added. Calls which
+ * acknowledge through a callback (REQUEST_ACK_CB_STANDARD) are rejected by
+ * the PMU, use REQUEST_ACK_BLOCKING to get the status of such a call back in
+ * the batch.
+ *
+ * @return	Returns status, either success or error+reason
+ */
+enum XPmStatus XPm_BatchAdd(struct XPm_Batch *const batch,
+			    const enum XPmApiId api,
+			    const u32 arg0, const u32 arg1,
+			    const u32 arg2, const u32 arg3)
+{
+	struct XPm_BatchCall *call;
+
+	if ((PM_BATCH == api) || (batch->count >= PM_BATCH_MAX_CALLS))
+		return PM_RET_ERROR_ARGS;
+
+	call = &batch->call[batch->count];
+	call->api = api;
+	call->arg[0] = arg0;
+	call->arg[1] = arg1;
+	call->arg[2] = arg2;
+	call->arg[3] = arg3;
+	call->status = 0;
+	call->value = 0;
+	batch->count++;
+
+	return PM_RET_SUCCESS;
+}
+
+/**
+ * XPm_BatchSend() - PM call to execute all calls of the batch
+ * @batch	Batch to be executed
+ * @flags	PM_BATCH_STOP_ON_ERROR to skip the calls following a failed one
+ * @processed	Returns number of calls the PMU has processed (optional)
+ *
+ * This is a blocking call which costs a single IPI round trip regardless
+ * of the number of calls in the batch. Status and returned value of each
+ * call can be read afterwards using XPm_BatchGetStatus.
+ *
+ * @return	Returns status of the first failed call, or success
+ */
+enum XPmStatus XPm_BatchSend(struct XPm_Batch *const batch,
+			     const u32 flags, u32 *processed)
+{
+	enum XPmStatus ret;
+	u32 payload[PAYLOAD_ARG_CNT];
+	u32 len = batch->count * sizeof(struct XPm_BatchCall);
+	UINTPTR address = (UINTPTR)batch->call;
+
+	/* PMU can only address the lower 4GB */
+	if ((0 == batch->count) || (address != (UINTPTR)(u32)address))
+		return PM_RET_ERROR_ARGS;
+
+	/* Calls are read by the PMU from memory */
+	Xil_DCacheFlushRange((INTPTR)address, len);
+
+	PACK_PAYLOAD(payload, PM_BATCH, (u32)address, batch->count, flags, 0);
+	ret = pm_ipi_send(primary_master, payload);
+	if (PM_RET_SUCCESS != ret)
+		return ret;
+
+	ret = pm_ipi_buff_read32(primary_master, processed);
+
+	/* Discard stale lines, statuses are written back by the PMU */
+	Xil_DCacheInvalidateRange((INTPTR)address, len);
+
+	return ret;
+}
+
+/**
+ * XPm_BatchGetStatus() - Get outcome of a call from an executed batch
+ * @batch	Batch returned by XPm_BatchSend
+ * @index	Index of the call, in order the calls were added
+ * @value	Returns value the call has returned (optional)
+ *
+ * @return	Returns status of the call, either success or error+reason
+ */
+enum XPmStatus XPm_BatchGetStatus(const struct XPm_Batch *const batch,
+				  const u32 index, u32 *value)
+{
+	if (index >= batch->count)
+		return PM_RET_ERROR_ARGS;
+
+	if (NULL != value)
+		*value = batch->call[index].value;
+
+	return batch->call[index].status;
+}
+
+/* API functions for reading status without an IPI */
+
+/* Status page registered through XPm_SetStatusPage */
+static struct XPm_StatusPage *status_page;
+
+/**
+ * XPm_SetStatusPage() - PM call to register a page the PMU publishes into
+ * @page	Page to be written by the PMU, NULL to stop publishing
+ *
+ * After the page is registered the PMU keeps node states, wake count and
+ * suspend/resume time stamps of the primary processor up to date in it.
+ * The page must stay registered across suspend, so no IPI is needed to
+ * find out the state after resume.
+ *
+ * @return	Returns status, either success or error+reason
+ */
+enum XPmStatus XPm_SetStatusPage(struct XPm_StatusPage *const page)
+{
+	enum XPmStatus ret;
+	u32 payload[PAYLOAD_ARG_CNT];
+	UINTPTR address = (UINTPTR)page;
+
+	/* PMU can only address the lower 4GB */
+	if (address != (UINTPTR)(u32)address)
+		return PM_RET_ERROR_ARGS;
+
+	/* No dirty line may overwrite what the PMU writes into the page */
+	if (NULL != page)
+		Xil_DCacheFlushRange((INTPTR)address, sizeof(*page));
+
+	PACK_PAYLOAD(payload, PM_SET_STATUS_PAGE, (u32)address, 0, 0, 0);
+	ret = pm_ipi_send(primary_master, payload);
+	if (PM_RET_SUCCESS != ret)
+		return ret;
+
+	ret = pm_ipi_buff_read32(primary_master, NULL);
+	if (PM_RET_SUCCESS == ret)
+		status_page = page;
+
+	return ret;
+}
+
+/**
+ * pm_status_read32() - Read a word of the status page from memory
+ * @addr	Address of the word within the status page
+ *
+ * @return	Value written by the PMU
+ */
+static u32 pm_status_read32(u32 *const addr)
+{
+	Xil_DCacheInvalidateRange((INTPTR)addr, sizeof(u32));
+	return pm_read((UINTPTR)addr);
+}
+
+/**
+ * XPm_GetNodeStatusCached() - Get a node's current state from status page
+ * @node	Node id of the node
+ * @state	Returns current state of the node
+ *
+ * Unlike XPm_GetNodeStatus this call does not involve the PMU, the state
+ * is read from the page registered with XPm_SetStatusPage.
+ *
+ * @return	Returns status, PM_RET_ERROR_NOTSUPPORTED if no page is registered
+ */
+enum XPmStatus XPm_GetNodeStatusCached(const enum XPmNodeId node,
+				       u32 *const state)
+{
+	u32 seq;
+
+	if (NULL == status_page)
+		return PM_RET_ERROR_NOTSUPPORTED;
+	if ((NULL == state) || ((u32)node >= PM_STATUS_NODE_CNT))
+		return PM_RET_ERROR_ARGS;
+
+	/* Retry if the PMU has updated the page while it was being read */
+	do {
+		seq = pm_status_read32(&status_page->seq);
+		dmb();
+		*state = pm_status_read32(&status_page->node_state[node]);
+		dmb();
+	} while ((0 != (seq & 1U)) ||
+		 (seq != pm_status_read32(&status_page->seq)));
+
+	return PM_RET_SUCCESS;
+}
+
+/**
+ * XPm_GetStatusSnapshot() - Get a consistent copy of the whole status page
+ * @copy	Returns copy of the status page
+ *
+ * @return	Returns status, PM_RET_ERROR_NOTSUPPORTED if no page is registered
+ */
+enum XPmStatus XPm_GetStatusSnapshot(struct XPm_StatusPage *const copy)
+{
+	u32 seq, i;
+	u32 *src;
+	u32 *dst;
+
+	if (NULL == status_page)
+		return PM_RET_ERROR_NOTSUPPORTED;
+	if (NULL == copy)
+		return PM_RET_ERROR_ARGS;
+
+	do {
+		seq = pm_status_read32(&status_page->seq);
+		dmb();
+		Xil_DCacheInvalidateRange((INTPTR)status_page,
+					  sizeof(*status_page));
+		src = (u32 *)status_page;
+		dst = (u32 *)copy;
+		for (i = 0; i < (sizeof(*copy) / sizeof(u32)); i++)
+			dst[i] = pm_read((UINTPTR)&src[i]);
+		dmb();
+	} while ((0 != (seq & 1U)) ||
+		 (seq != pm_status_read32(&status_page->seq)));
+
+	return PM_RET_SUCCESS;
+}
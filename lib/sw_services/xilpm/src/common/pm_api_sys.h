@@ -80,4 +80,79 @@ enum XPmStatus XPm_GetApiVersion(u32 *version);
 
 enum XPmStatus XPm_GetNodeStatus(const enum XPmNodeId node);
 
+/**
+ * struct XPm_BatchCall - One API call within a batch
+ * @api		API id of the call
+ * @arg		Arguments of the call
+ * @status	Status of the call, written by the PMU
+ * @value	Value returned by the call, written by the PMU
+ *
+ * Layout is shared with the PMU and must stay 32 bytes long.
+ */
+struct XPm_BatchCall {
+	u32 api;
+	u32 arg[4];
+	u32 status;
+	u32 value;
+	u32 reserved;
+};
+
+/**
+ * struct XPm_Batch - List of API calls sent to the PMU in one request
+ * @call	API calls, read and updated by the PMU
+ * @count	Number of calls added to the batch
+ *
+ * Calls are exchanged through memory, so the batch is kept cache line
+ * aligned and must be placed in memory the PMU can access.
+ */
+struct XPm_Batch {
+	struct XPm_BatchCall call[PM_BATCH_MAX_CALLS];
+	u32 count;
+} __attribute__((aligned(64)));
+
+/* API functions for batching of PM calls */
+void XPm_BatchInit(struct XPm_Batch *const batch);
+enum XPmStatus XPm_BatchAdd(struct XPm_Batch *const batch,
+			    const enum XPmApiId api,
+			    const u32 arg0, const u32 arg1,
+			    const u32 arg2, const u32 arg3);
+enum XPmStatus XPm_BatchSend(struct XPm_Batch *const batch,
+			     const u32 flags, u32 *processed);
+enum XPmStatus XPm_BatchGetStatus(const struct XPm_Batch *const batch,
+				  const u32 index, u32 *value);
+
+/**
+ * struct XPm_StatusPage - Status published by the PMU into master's memory
+ * @seq		Sequence number, odd while the PMU updates the page
+ * @wake_count	Number of times the primary processor was woken up
+ * @ts_suspend	PMU time stamp when self suspend request was processed
+ * @ts_sleep	PMU time stamp when the primary processor was put to sleep
+ * @ts_wake	PMU time stamp when wake of the primary processor started
+ * @ts_active	PMU time stamp when the primary processor was released
+ * @ts_freq	Frequency of the PMU time stamp counter in Hz
+ * @node_state	Current state of each node, indexed by node id
+ *
+ * Layout is shared with the PMU. The page must be placed in memory the PMU
+ * can access and which is retained while the processor is suspended (e.g.
+ * OCM or TCM through its global address). Non-cacheable memory gives the
+ * shortest read latency, otherwise lines are invalidated on every read.
+ */
+struct XPm_StatusPage {
+	u32 seq;
+	u32 wake_count;
+	u32 ts_suspend;
+	u32 ts_sleep;
+	u32 ts_wake;
+	u32 ts_active;
+	u32 ts_freq;
+	u32 reserved;
+	u32 node_state[PM_STATUS_NODE_CNT];
+} __attribute__((aligned(64)));
+
+/* API functions for reading status without an IPI */
+enum XPmStatus XPm_SetStatusPage(struct XPm_StatusPage *const page);
+enum XPmStatus XPm_GetNodeStatusCached(const enum XPmNodeId node,
+				       u32 *const state);
+enum XPmStatus XPm_GetStatusSnapshot(struct XPm_StatusPage *const copy);
+
 #endif /* _PM_API_SYS_H_ */
@@ -70,10 +70,23 @@ enum XPmApiId {
 	PM_RESET_GET_STATUS,
 	PM_MMIO_WRITE,
 	PM_MMIO_READ,
+	/* Batch of API calls handled in one request: */
+	PM_BATCH,
+	/* Status page published by the PMU: */
+	PM_SET_STATUS_PAGE,
 };
 
 #define PM_API_MIN	PM_GET_API_VERSION
-#define PM_API_MAX	PM_MMIO_READ
+#define PM_API_MAX	PM_SET_STATUS_PAGE
+
+/* Maximum number of API calls in one batch */
+#define PM_BATCH_MAX_CALLS	32U
+
+/* Batch flags */
+#define PM_BATCH_STOP_ON_ERROR	0x1U
+
+/* Number of node states in the status page (indexed by node id) */
+#define PM_STATUS_NODE_CNT	64U
 
 enum XPmApiCbId {
 	PM_INIT_SUSPEND_CB = 30,